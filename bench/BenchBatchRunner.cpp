@@ -0,0 +1,42 @@
+#include "benchmark/benchmark.h"
+
+#include "game/BatchRunner.h"
+#include "game/GameTypes.h"
+#include "game/HeadlessMatch.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    // a batch of 16 matches of up to 500 ticks, 10 fighters each flying into each other unscripted: range(0) is the
+    // number of threads. Items per second is ticks per second across the batch, in wall clock time.
+    void BM_BatchRunner(benchmark::State& state)
+    {
+        std::vector<std::vector<vector::game::UnitData>> teamUnitData(2);
+        for(int i = 0; i < 10; ++i)
+        {
+            teamUnitData[i % 2].push_back(vector::game::UnitData{"fighter" + std::to_string(i), vector::game::UNIT_TYPE::FIGHTER});
+        }
+        auto scenario = [&teamUnitData](vector::game::HeadlessMatch& match, const uint64_t)
+        {
+            match.SetUnitData(1, teamUnitData[0]);
+            match.SetUnitData(2, teamUnitData[1]);
+        };
+
+        vector::game::BatchRunner batchRunner(static_cast<size_t>(state.range(0)));
+        uint64_t ticksRun = 0;
+        for(auto _ : state)
+        {
+            ticksRun += batchRunner.Run(scenario, 0, 16, 500).ticksRun;
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(ticksRun));
+    }
+    BENCHMARK(BM_BatchRunner)
+        ->Arg(1)
+        ->Arg(2)
+        ->Arg(4)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+} // namespace
@@ -0,0 +1,77 @@
+#include "benchmark/benchmark.h"
+
+#include "sim/CollisionSystem.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+#include "util/MathUtil.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Crowd bodies into a square box around the centre of the arena, all at top speed on random headings
+     *
+     */
+    void PopulateBox(vector::sim::CollisionSystem& collisions, const int numBodies, const vector::sim::coord halfWidth)
+    {
+        std::mt19937 generator(42);
+        const vector::sim::coord centre = vector::sim::X_COORD_MAX / 2;
+        std::uniform_real_distribution<vector::sim::coord> positionDistribution(centre - halfWidth, centre + halfWidth);
+        std::uniform_int_distribution<int> headingDistribution(vector::sim::HEADING_MIN, vector::sim::HEADING_MAX);
+
+        for(int i = 0; i < numBodies; ++i)
+        {
+            vector::sim::InertialData startData;
+            startData.xCoord = positionDistribution(generator);
+            startData.yCoord = positionDistribution(generator);
+
+            vector::util::VelocityComponents velocity = vector::util::MathUtil::GetVelocityComponents(vector::sim::FIGHTER_SPEED_MAX,
+                                                                                                    headingDistribution(generator));
+            vector::sim::InertialData endData = startData;
+            endData.xCoord += velocity.xComponent;
+            endData.yCoord += velocity.yComponent;
+
+            collisions.AddBody(static_cast<uint32_t>(i), startData, endData);
+        }
+    }
+
+    void RunDetect(benchmark::State& state, vector::sim::CollisionSystem& collisions, const int numBodies)
+    {
+        std::vector<vector::sim::CollisionSystem::Collision> found;
+
+        for(auto _ : state)
+        {
+            found.clear();
+            collisions.Detect(nullptr, found);
+            benchmark::DoNotOptimize(found.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * numBodies);
+    }
+
+    // one body per 2km square whatever the number of bodies, which should cost the same per body
+    void BM_CollisionSystemDetectSpread(benchmark::State& state)
+    {
+        const int numBodies = static_cast<int>(state.range(0));
+        vector::sim::CollisionSystem collisions(vector::sim::COLLISION_RADIUS, vector::sim::COLLISION_GRID_CELL_SIZE);
+        PopulateBox(collisions, numBodies, std::min(vector::sim::X_COORD_MAX / 2, 1000.0 * std::sqrt(static_cast<double>(numBodies))));
+
+        RunDetect(state, collisions, numBodies);
+    }
+    BENCHMARK(BM_CollisionSystemDetectSpread)->RangeMultiplier(10)->Range(1000, 10000);
+
+    // a furball a tenth of the arena across, which gets more crowded as bodies are added
+    void BM_CollisionSystemDetectFurball(benchmark::State& state)
+    {
+        const int numBodies = static_cast<int>(state.range(0));
+        vector::sim::CollisionSystem collisions(vector::sim::COLLISION_RADIUS, vector::sim::COLLISION_GRID_CELL_SIZE);
+        PopulateBox(collisions, numBodies, (vector::sim::X_COORD_MAX - vector::sim::X_COORD_MIN) / 20);
+
+        RunDetect(state, collisions, numBodies);
+    }
+    BENCHMARK(BM_CollisionSystemDetectFurball)->RangeMultiplier(10)->Range(1000, 10000);
+} // namespace
@@ -0,0 +1,53 @@
+#include "benchmark/benchmark.h"
+
+#include "sim/FighterMover.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // FighterMover::Move over range(0) heap-allocated fighters, half of them turning
+    void BM_FighterMoverMove(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::MoverParams fighterParams;
+        fighterParams.maxSpeed = vector::sim::FIGHTER_SPEED_MAX;
+        fighterParams.turnRate = vector::sim::FIGHTER_TURN_RATE;
+
+        std::vector<std::unique_ptr<vector::sim::FighterMover>> fighters;
+        for(int i = 0; i < numFighters; ++i)
+        {
+            auto fighterPtr = std::make_unique<vector::sim::FighterMover>("fighter" + std::to_string(i), i % 2, fighterParams);
+
+            vector::sim::InertialData initialPos;
+            initialPos.curHeading = (i * 7) % vector::sim::HEADING_FULL_CIRCLE;
+            initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+            initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+            initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+            fighterPtr->SetInitialInertialData(initialPos);
+
+            if(i % 2 == 0)
+            {
+                fighterPtr->SetNewHeading((initialPos.curHeading + vector::sim::HEADING_HALF_CIRCLE) % vector::sim::HEADING_FULL_CIRCLE);
+            }
+
+            fighters.push_back(std::move(fighterPtr));
+        }
+
+        for(auto _ : state)
+        {
+            for(auto& fighterPtr : fighters)
+            {
+                fighterPtr->Move();
+            }
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+    }
+    BENCHMARK(BM_FighterMoverMove)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+} // namespace
@@ -0,0 +1,336 @@
+#include "benchmark/benchmark.h"
+
+#include "sim/FighterMover.h"
+#include "sim/GameEngine.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+#include "util/Command.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // fighters keep this far from the edges, clear of the radius they circle on
+    const vector::sim::coord SPREAD_MARGIN = 20000.0;
+
+    /**
+     * @brief Place the i-th fighter on a low-discrepancy sequence across the arena, so that any
+     * number of fighters are spread about evenly rather than stacked on one point
+     *
+     */
+    void SpreadPosition(vector::sim::InertialData& inertialData, const int i)
+    {
+        const double xFraction = std::fmod(0.5 + i * 0.6180339887498949, 1.0);
+        const double yFraction = std::fmod(0.5 + i * 0.7548776662466927, 1.0);
+        inertialData.xCoord = SPREAD_MARGIN + xFraction * (vector::sim::X_COORD_MAX - 2 * SPREAD_MARGIN);
+        inertialData.yCoord = SPREAD_MARGIN + yFraction * (vector::sim::Y_COORD_MAX - 2 * SPREAD_MARGIN);
+    }
+
+    /**
+     * @brief Fill an engine with stored fighters spread across the arena, all turning.
+     * Radars are off unless asked for, so the movement benchmarks measure movement
+     *
+     */
+    void PopulateFighters(vector::sim::GameEngine& engine, const int numFighters, const vector::sim::coord radarRange = 0.0)
+    {
+        vector::sim::MoverParams fighterParams;
+        fighterParams.maxSpeed = vector::sim::FIGHTER_SPEED_MAX;
+        fighterParams.turnRate = vector::sim::FIGHTER_TURN_RATE;
+        fighterParams.radarRange = radarRange;
+
+        for(int i = 0; i < numFighters; ++i)
+        {
+            std::string moverID = "fighter" + std::to_string(i);
+            vector::sim::MoverHandle handle = engine.AddFighter(moverID, i % 2, fighterParams);
+
+            vector::sim::InertialData initialPos;
+            initialPos.curHeading = (i * 7) % vector::sim::HEADING_FULL_CIRCLE;
+            initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+            SpreadPosition(initialPos, i);
+
+            auto mover = engine.GetMover(handle);
+            mover->SetInitialInertialData(initialPos);
+            // circle forever so that fighters neither leave the arena nor stop turning
+            mover->SetNewHeading((initialPos.curHeading + vector::sim::HEADING_HALF_CIRCLE) % vector::sim::HEADING_FULL_CIRCLE);
+        }
+    }
+
+    /**
+     * @brief Fill an engine with FighterMover objects set up as PopulateFighters sets up stored fighters
+     *
+     */
+    void PopulateFighterMovers(vector::sim::GameEngine& engine, const int numFighters)
+    {
+        vector::sim::MoverParams fighterParams;
+        fighterParams.maxSpeed = vector::sim::FIGHTER_SPEED_MAX;
+        fighterParams.turnRate = vector::sim::FIGHTER_TURN_RATE;
+        fighterParams.radarRange = 0.0;
+
+        for(int i = 0; i < numFighters; ++i)
+        {
+            auto fighterPtr = std::make_shared<vector::sim::FighterMover>("fighter" + std::to_string(i), i % 2, fighterParams);
+
+            vector::sim::InertialData initialPos;
+            initialPos.curHeading = (i * 7) % vector::sim::HEADING_FULL_CIRCLE;
+            initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+            SpreadPosition(initialPos, i);
+
+            fighterPtr->SetInitialInertialData(initialPos);
+            fighterPtr->SetNewHeading((initialPos.curHeading + vector::sim::HEADING_HALF_CIRCLE) % vector::sim::HEADING_FULL_CIRCLE);
+            engine.AddMover(fighterPtr);
+        }
+    }
+
+    // serial Tick over stored fighters: range(0) is the number of fighters
+    void BM_GameEngineTick(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine;
+        PopulateFighters(engine, numFighters);
+
+        for(auto _ : state)
+        {
+            engine.Tick();
+        }
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+    }
+    BENCHMARK(BM_GameEngineTick)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+    // serial Tick with every fighter's radar on: range(0) is the number of fighters, range(1) the radar range.
+    // The sweep's cost follows the number of fighters times the number within radar range of each
+    void BM_GameEngineTickRadar(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine;
+        PopulateFighters(engine, numFighters, static_cast<vector::sim::coord>(state.range(1)));
+
+        for(auto _ : state)
+        {
+            engine.Tick();
+        }
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+    }
+    BENCHMARK(BM_GameEngineTickRadar)
+        ->ArgsProduct({{10, 100, 1000, 10000}, {20000, static_cast<int64_t>(vector::sim::FIGHTER_RADAR_RANGE)}})
+        ->Unit(benchmark::kMicrosecond);
+
+    // serial Tick over Mover objects, for comparison with the stored fighters
+    void BM_GameEngineTickMoverObjects(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine;
+        PopulateFighterMovers(engine, numFighters);
+
+        for(auto _ : state)
+        {
+            engine.Tick();
+        }
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+    }
+    BENCHMARK(BM_GameEngineTickMoverObjects)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+    // copying the published state out of the engine, as GetGameState callers do
+    void BM_GameEngineGetGameState(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine;
+        PopulateFighters(engine, numFighters);
+        engine.Tick();
+
+        for(auto _ : state)
+        {
+            vector::sim::GameState gameState = engine.GetGameState();
+            benchmark::DoNotOptimize(gameState.moverList.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+    }
+    BENCHMARK(BM_GameEngineGetGameState)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+    // Tick plus building and publishing the snapshot readers see, against one reader taking it every tick
+    void BM_GameEngineTickAndSnapshot(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine;
+        PopulateFighters(engine, numFighters);
+
+        for(auto _ : state)
+        {
+            engine.Tick();
+            auto snapshotPtr = engine.GetGameStateSnapshot();
+            benchmark::DoNotOptimize(snapshotPtr.get());
+        }
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+    }
+    BENCHMARK(BM_GameEngineTickAndSnapshot)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMicrosecond);
+
+    // Tick plus building both teams' views, radars on: range(0) is the number of fighters.
+    // Views are built in one pass over the snapshot, with a view range query per fighter
+    void BM_GameEngineTickAndTeamViews(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine;
+        PopulateFighters(engine, numFighters, 20000.0);
+
+        for(auto _ : state)
+        {
+            engine.Tick();
+            for(vector::sim::team_ID teamID = 0; teamID < 2; ++teamID)
+            {
+                auto viewPtr = engine.GetTeamGameStateSnapshot(teamID);
+                benchmark::DoNotOptimize(viewPtr.get());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+    }
+    BENCHMARK(BM_GameEngineTickAndTeamViews)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+    // a VECTOR command addressed by ID, cycling through every fighter so lookups miss the cache as they would in play
+    void BM_GameEngineInputCommand(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine;
+        PopulateFighters(engine, numFighters);
+
+        std::vector<vector::util::Command> commands;
+        for(int i = 0; i < numFighters; ++i)
+        {
+            vector::util::Command cmd;
+            cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+            cmd.subject = "fighter" + std::to_string(i);
+            cmd.payload = vector::util::HeadingPayload{static_cast<uint16_t>((i * 11) % vector::sim::HEADING_FULL_CIRCLE)};
+            commands.push_back(cmd);
+        }
+
+        size_t next = 0;
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(engine.InputCommand(commands[next]));
+            next = (next + 1) % commands.size();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_GameEngineInputCommand)->RangeMultiplier(10)->Range(10, 100000);
+
+    // the same commands addressed by handle, as GameManager issues them
+    void BM_GameEngineInputCommandByHandle(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine;
+        PopulateFighters(engine, numFighters);
+
+        std::vector<std::pair<vector::sim::MoverHandle, vector::util::Command>> commands;
+        for(int i = 0; i < numFighters; ++i)
+        {
+            vector::util::Command cmd;
+            cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+            cmd.payload = vector::util::HeadingPayload{static_cast<uint16_t>((i * 11) % vector::sim::HEADING_FULL_CIRCLE)};
+            commands.emplace_back(engine.GetMoverHandle("fighter" + std::to_string(i)), cmd);
+        }
+
+        size_t next = 0;
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(engine.InputCommand(commands[next].first, commands[next].second));
+            next = (next + 1) % commands.size();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_GameEngineInputCommandByHandle)->RangeMultiplier(10)->Range(10, 100000);
+
+    // a salvo of missiles launched through the engine, flown and expired out of fuel: range(0) is the salvo size.
+    // The launchers' radars reach a target beyond the missiles' range, so every missile flies its whole fuel.
+    // Items per second is missiles launched and expired, the ticks they fly included
+    void BM_GameEngineMissileChurn(benchmark::State& state)
+    {
+        const int salvo = static_cast<int>(state.range(0));
+
+        vector::sim::MoverParams launcherParams;
+        launcherParams.radarRange = 300000.0;
+        launcherParams.radarHalfAngle = vector::sim::HEADING_HALF_CIRCLE;
+        launcherParams.numMissiles = 1;
+
+        vector::util::Command aquireCmd;
+        aquireCmd.command = vector::util::COMMAND_TYPE::AQUIRE;
+        aquireCmd.payload = vector::util::TargetPayload{"target"};
+        vector::util::Command launchCmd = aquireCmd;
+        launchCmd.command = vector::util::COMMAND_TYPE::LAUNCH;
+
+        for(auto _ : state)
+        {
+            state.PauseTiming();
+            auto enginePtr = std::make_unique<vector::sim::GameEngine>();
+            vector::sim::InertialData initialPos;
+            initialPos.curHeading = 90;
+            initialPos.xCoord = 100000.0;
+            initialPos.yCoord = 300000.0;
+            enginePtr->GetMover(enginePtr->AddFighter("target", 2, vector::sim::MoverParams()))->SetInitialInertialData(initialPos);
+
+            std::vector<vector::sim::MoverHandle> launchers;
+            for(int i = 0; i < salvo; ++i)
+            {
+                initialPos.yCoord = 20000.0 + 100.0 * i;
+                launchers.push_back(enginePtr->AddFighter("launcher" + std::to_string(i), 1, launcherParams));
+                enginePtr->GetMover(launchers.back())->SetInitialInertialData(initialPos);
+            }
+            enginePtr->Tick();
+            for(const auto& launcher : launchers)
+            {
+                enginePtr->InputCommand(launcher, aquireCmd);
+            }
+            state.ResumeTiming();
+
+            int launched = 0;
+            for(const auto& launcher : launchers)
+            {
+                launched += enginePtr->InputCommand(launcher, launchCmd) ? 1 : 0;
+            }
+            if(launched != salvo)
+            {
+                state.SkipWithError("a launch was rejected");
+                break;
+            }
+            for(uint32_t tick = 0; tick <= vector::sim::MISSILE_FUEL_TICKS; ++tick)
+            {
+                enginePtr->Tick();
+            }
+
+            state.PauseTiming();
+            enginePtr.reset();
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * salvo);
+    }
+    BENCHMARK(BM_GameEngineMissileChurn)->Arg(16)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
+
+    // Tick scaling across tick threads: range(0) is the number of fighters, range(1) the number of tick threads
+    void BM_GameEngineTickParallel(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        vector::sim::GameEngine engine(static_cast<size_t>(state.range(1)));
+        PopulateFighters(engine, numFighters);
+
+        for(auto _ : state)
+        {
+            engine.Tick();
+        }
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+        state.counters["threads"] = static_cast<double>(engine.GetNumTickThreads());
+    }
+    BENCHMARK(BM_GameEngineTickParallel)
+        ->ArgsProduct({{10000, 100000}, {1, 2, 4, 8, 16, 32}})
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+} // namespace
@@ -0,0 +1,157 @@
+#include "benchmark/benchmark.h"
+
+#include "game/DogfightGameSettings.h"
+#include "game/GameConstants.h"
+#include "game/GameManager.h"
+#include "game/GameTypes.h"
+#include "game/PlayerInterface.h"
+#include "sim/GameEngine.h"
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Player that takes every update like a client would, and answers each one with a command
+     *
+     */
+    class BenchPlayer : public vector::game::PlayerInterface
+    {
+        public:
+            BenchPlayer(const std::string& playerID, const vector::sim::team_ID teamID, std::vector<std::string> callsigns)
+                : m_PlayerID(playerID)
+                , m_TeamID(teamID)
+                , m_Callsigns(std::move(callsigns))
+            {
+            }
+
+            std::string GetPlayerID() const override
+            {
+                return m_PlayerID;
+            }
+
+            vector::sim::team_ID GetTeamID() const override
+            {
+                return m_TeamID;
+            }
+
+            bool IsReady() const override
+            {
+                return true;
+            }
+
+            void UpdateGameState(std::shared_ptr<const vector::sim::GameState> gameStatePtr) override
+            {
+                benchmark::DoNotOptimize(gameStatePtr->moverList.data());
+                OnUpdate();
+            }
+
+            void UpdateGameStateDelta(const vector::sim::GameStateDelta& gameStateDelta) override
+            {
+                benchmark::DoNotOptimize(gameStateDelta.changed.data());
+                OnUpdate();
+            }
+
+            void RegisterCommandFunction(std::function<bool (const std::string playerID, const vector::util::Command cmd)> commandFunction) override
+            {
+                m_CommandFunction = std::move(commandFunction);
+            }
+
+            /**
+             * @brief Block until the Player has received numUpdates updates in total
+             *
+             */
+            void WaitForUpdates(const uint64_t numUpdates)
+            {
+                std::unique_lock<std::mutex> lock(m_UpdateMutex);
+                m_UpdateCondition.wait(lock, [this, numUpdates]{ return m_NumUpdates >= numUpdates; });
+            }
+
+            uint64_t GetNumUpdates()
+            {
+                std::scoped_lock<std::mutex> lock(m_UpdateMutex);
+                return m_NumUpdates;
+            }
+
+        private:
+            void OnUpdate()
+            {
+                vector::util::Command cmd;
+                cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+                cmd.subject = m_Callsigns[m_NumUpdates % m_Callsigns.size()];
+                cmd.payload = vector::util::HeadingPayload{static_cast<uint16_t>((m_NumUpdates * 11) % 360)};
+                m_CommandFunction(m_PlayerID, cmd);
+
+                {
+                    std::scoped_lock<std::mutex> lock(m_UpdateMutex);
+                    ++m_NumUpdates;
+                }
+                m_UpdateCondition.notify_all();
+            }
+
+            std::string m_PlayerID;
+            vector::sim::team_ID m_TeamID;
+            std::vector<std::string> m_Callsigns;
+            std::function<bool (const std::string playerID, const vector::util::Command cmd)> m_CommandFunction;
+            std::mutex m_UpdateMutex;
+            std::condition_variable m_UpdateCondition;
+            uint64_t m_NumUpdates{0};
+    };
+
+    // the whole game loop at the maximum tick rate: range(0) is the number of fighters across both teams,
+    // range(1) is 0 for full GameState updates and 1 for delta updates.
+    // Time per iteration is the time per delivered update, which bottoms out at the tick period.
+    void BM_GameManagerLoop(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+        const bool deltaUpdates = state.range(1) != 0;
+
+        vector::game::GameManager gameManager(std::make_unique<vector::sim::GameEngine>(), std::make_unique<vector::game::DogfightGameSettings>());
+        gameManager.SetGameType(vector::game::GAME_TYPE::DOGFIGHT);
+        gameManager.SetNumPlayerSlots(2);
+        gameManager.SetTickRateHz(vector::game::MAX_TICK_RATE_HZ);
+        gameManager.SetGameStateUpdateMode(deltaUpdates ? vector::game::GAME_STATE_UPDATE_MODE::DELTA : vector::game::GAME_STATE_UPDATE_MODE::FULL);
+
+        std::vector<std::shared_ptr<BenchPlayer>> players;
+        for(vector::sim::team_ID teamID = 1; teamID <= 2; ++teamID)
+        {
+            std::vector<vector::game::UnitData> unitData;
+            std::vector<std::string> callsigns;
+            for(int i = teamID - 1; i < numFighters; i += 2)
+            {
+                vector::game::UnitData unit;
+                unit.callsign = "fighter" + std::to_string(i);
+                unit.unitType = vector::game::UNIT_TYPE::FIGHTER;
+                unitData.push_back(unit);
+                callsigns.push_back(unit.callsign);
+            }
+            gameManager.SetUnitData(teamID, unitData);
+
+            players.push_back(std::make_shared<BenchPlayer>("player" + std::to_string(teamID), teamID, callsigns));
+            gameManager.AddPlayer(players.back());
+        }
+
+        gameManager.Start();
+        uint64_t numUpdates = players.front()->GetNumUpdates();
+
+        for(auto _ : state)
+        {
+            players.front()->WaitForUpdates(++numUpdates);
+        }
+
+        state.counters["overruns"] = static_cast<double>(gameManager.GetNumTickOverruns());
+        state.counters["skipped"] = static_cast<double>(gameManager.GetNumSkippedTicks());
+        gameManager.Stop();
+
+        state.SetItemsProcessed(state.iterations() * numFighters);
+    }
+    BENCHMARK(BM_GameManagerLoop)
+        ->ArgsProduct({{10, 100, 1000, 10000, 100000}, {0, 1}})
+        ->UseRealTime()
+        ->Unit(benchmark::kMicrosecond);
+} // namespace
@@ -0,0 +1,80 @@
+#include "benchmark/benchmark.h"
+
+#include "sim/GameState.h"
+#include "sim/GameStateBinaryDecoder.h"
+#include "sim/GameStateBinaryEncoder.h"
+#include "sim/SimConstants.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    vector::sim::GameState MakeGameState(const int numMovers)
+    {
+        vector::sim::GameState gameState;
+        for(int i = 0; i < numMovers; ++i)
+        {
+            vector::sim::MoverState moverState;
+            moverState.handle = vector::sim::MoverHandle{static_cast<uint32_t>(i), 0};
+            moverState.ID = "fighter" + std::to_string(i);
+            moverState.teamID = static_cast<vector::sim::team_ID>(i % 2);
+            moverState.inertialData.curHeading = static_cast<vector::sim::angle>((i * 7) % vector::sim::HEADING_FULL_CIRCLE);
+            moverState.inertialData.curSpeed = vector::sim::SPEED_MAX;
+            moverState.inertialData.xCoord = (i * 37) % static_cast<int>(vector::sim::X_COORD_MAX);
+            moverState.inertialData.yCoord = (i * 53) % static_cast<int>(vector::sim::Y_COORD_MAX);
+            gameState.moverList.push_back(moverState);
+        }
+        return gameState;
+    }
+
+    // encoding a GameState once its IDs have been sent, as every update but the first is:
+    // range(0) is the number of Movers, range(1) is 1 to quantize
+    void BM_GameStateBinaryEncode(benchmark::State& state)
+    {
+        const int numMovers = static_cast<int>(state.range(0));
+        vector::sim::GameState gameState = MakeGameState(numMovers);
+        vector::sim::GameStateBinaryEncoder encoder(state.range(1) != 0);
+        std::vector<uint8_t> buffer(encoder.GetMaxEncodedSize(gameState));
+        encoder.Encode(gameState, buffer.data(), buffer.size());
+
+        size_t size = 0;
+        for(auto _ : state)
+        {
+            size = encoder.Encode(gameState, buffer.data(), buffer.size());
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.counters["bytes"] = static_cast<double>(size);
+        state.SetItemsProcessed(state.iterations() * numMovers);
+        state.SetBytesProcessed(state.iterations() * size);
+    }
+    BENCHMARK(BM_GameStateBinaryEncode)
+        ->ArgsProduct({{10, 1000, 100000}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
+
+    // decoding the messages of BM_GameStateBinaryEncode, IDs looked up in the string table
+    void BM_GameStateBinaryDecode(benchmark::State& state)
+    {
+        const int numMovers = static_cast<int>(state.range(0));
+        vector::sim::GameState gameState = MakeGameState(numMovers);
+        vector::sim::GameStateBinaryEncoder encoder(state.range(1) != 0);
+        vector::sim::GameStateBinaryDecoder decoder;
+        std::vector<uint8_t> buffer(encoder.GetMaxEncodedSize(gameState));
+
+        vector::sim::GameState decoded;
+        decoder.Decode(buffer.data(), encoder.Encode(gameState, buffer.data(), buffer.size()), decoded);
+        const size_t size = encoder.Encode(gameState, buffer.data(), buffer.size());
+
+        for(auto _ : state)
+        {
+            benchmark::DoNotOptimize(decoder.Decode(buffer.data(), size, decoded));
+        }
+
+        state.SetItemsProcessed(state.iterations() * numMovers);
+        state.SetBytesProcessed(state.iterations() * size);
+    }
+    BENCHMARK(BM_GameStateBinaryDecode)
+        ->ArgsProduct({{10, 1000, 100000}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
+} // namespace
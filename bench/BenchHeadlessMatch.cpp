@@ -0,0 +1,48 @@
+#include "benchmark/benchmark.h"
+
+#include "game/GameTypes.h"
+#include "game/HeadlessMatch.h"
+#include "sim/GameEngine.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // whole matches of up to 500 ticks run back to back with no clock: range(0) is the number of fighters across
+    // both teams, who fly into each other unscripted. Items per second is ticks per second.
+    void BM_HeadlessMatch(benchmark::State& state)
+    {
+        const int numFighters = static_cast<int>(state.range(0));
+
+        std::vector<std::vector<vector::game::UnitData>> teamUnitData(2);
+        for(int i = 0; i < numFighters; ++i)
+        {
+            teamUnitData[i % 2].push_back(vector::game::UnitData{"fighter" + std::to_string(i), vector::game::UNIT_TYPE::FIGHTER});
+        }
+
+        uint64_t ticksRun = 0;
+        for(auto _ : state)
+        {
+            state.PauseTiming();
+            auto matchPtr = std::make_unique<vector::game::HeadlessMatch>(std::make_unique<vector::sim::GameEngine>());
+            matchPtr->SetUnitData(1, teamUnitData[0]);
+            matchPtr->SetUnitData(2, teamUnitData[1]);
+            state.ResumeTiming();
+
+            ticksRun += matchPtr->Run(500).ticksRun;
+
+            state.PauseTiming();
+            matchPtr.reset();
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(ticksRun));
+    }
+    BENCHMARK(BM_HeadlessMatch)
+        ->Arg(10)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace
@@ -0,0 +1,52 @@
+#include "benchmark/benchmark.h"
+
+#include "util/Command.h"
+#include "util/InputParser.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    // a mix of well formed, padded and malformed player input
+    const std::vector<std::string> INPUTS = {
+        "vector brot 123",
+        "  vector   marm   270  ",
+        "identify gnar tnir",
+        "aquire brot gnar",
+        "launch marm tnir",
+        "hover brot 90",
+        "",
+    };
+
+    void BM_InputParserParse(benchmark::State& state)
+    {
+        const std::vector<std::string>& inputs = INPUTS;
+
+        size_t next = 0;
+        for(auto _ : state)
+        {
+            vector::util::Command cmd = vector::util::InputParser::Parse(inputs[next]);
+            benchmark::DoNotOptimize(cmd);
+            next = (next + 1) % inputs.size();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_InputParserParse);
+
+    // the same input parsed in place, without building a Command
+    void BM_InputParserParseView(benchmark::State& state)
+    {
+        size_t next = 0;
+        for(auto _ : state)
+        {
+            vector::util::ParsedCommand cmd = vector::util::InputParser::ParseView(INPUTS[next]);
+            benchmark::DoNotOptimize(cmd);
+            next = (next + 1) % INPUTS.size();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_InputParserParseView);
+} // namespace
@@ -0,0 +1,57 @@
+#include "benchmark/benchmark.h"
+
+#include "sim/SimConstants.h"
+#include "sim/SimTypes.h"
+#include "util/MathUtil.h"
+
+#include <cmath>
+
+namespace
+{
+    // velocity components for every heading, as the kinematics do once per Mover per tick
+    void BM_MathUtilGetVelocityComponents(benchmark::State& state)
+    {
+        for(auto _ : state)
+        {
+            for(vector::sim::angle heading = 0; heading < vector::sim::HEADING_FULL_CIRCLE; ++heading)
+            {
+                benchmark::DoNotOptimize(vector::util::MathUtil::GetVelocityComponents(vector::sim::SPEED_MAX, heading));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * vector::sim::HEADING_FULL_CIRCLE);
+    }
+    BENCHMARK(BM_MathUtilGetVelocityComponents);
+
+    void BM_MathUtilGetXYComponentOfSpeed(benchmark::State& state)
+    {
+        for(auto _ : state)
+        {
+            for(vector::sim::angle heading = 0; heading < vector::sim::HEADING_FULL_CIRCLE; ++heading)
+            {
+                benchmark::DoNotOptimize(vector::util::MathUtil::GetXComponentOfSpeed(vector::sim::SPEED_MAX, heading));
+                benchmark::DoNotOptimize(vector::util::MathUtil::GetYComponentOfSpeed(vector::sim::SPEED_MAX, heading));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * vector::sim::HEADING_FULL_CIRCLE);
+    }
+    BENCHMARK(BM_MathUtilGetXYComponentOfSpeed);
+
+    // libm baseline for the trig tables
+    void BM_LibmSinCos(benchmark::State& state)
+    {
+        for(auto _ : state)
+        {
+            for(vector::sim::angle heading = 0; heading < vector::sim::HEADING_FULL_CIRCLE; ++heading)
+            {
+                double radians = heading * M_PI / 180.0;
+                benchmark::DoNotOptimize(std::sin(radians) * vector::sim::SPEED_MAX);
+                benchmark::DoNotOptimize(std::cos(radians) * vector::sim::SPEED_MAX);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * vector::sim::HEADING_FULL_CIRCLE);
+    }
+    BENCHMARK(BM_LibmSinCos);
+} // namespace
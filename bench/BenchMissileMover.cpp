@@ -0,0 +1,71 @@
+#include "benchmark/benchmark.h"
+
+#include "sim/InertialData.h"
+#include "sim/MissileMover.h"
+#include "sim/SimConstants.h"
+#include "util/ObjectPool.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    vector::sim::InertialData LaunchData()
+    {
+        vector::sim::InertialData launchData;
+        launchData.xCoord = vector::sim::X_COORD_MAX / 2;
+        launchData.yCoord = vector::sim::Y_COORD_MAX / 2;
+        return launchData;
+    }
+
+    // a salvo of missiles launched, flown for a tick and expired, over and over, as in a busy furball
+    void BM_MissileChurnPool(benchmark::State& state)
+    {
+        const size_t salvo = static_cast<size_t>(state.range(0));
+        const vector::sim::InertialData launchData = LaunchData();
+        const std::string ID = "brot-M1";
+        vector::util::ObjectPool<vector::sim::MissileMover> pool(salvo);
+        std::vector<vector::sim::MissileMover*> missiles;
+        missiles.reserve(salvo);
+
+        for(auto _ : state)
+        {
+            for(size_t i = 0; i < salvo; ++i)
+            {
+                missiles.push_back(pool.Allocate(ID, 1, launchData, vector::sim::MoverHandle()));
+                missiles.back()->Move();
+            }
+            for(auto missilePtr : missiles)
+            {
+                pool.Release(missilePtr);
+            }
+            missiles.clear();
+        }
+
+        state.SetItemsProcessed(state.iterations() * salvo);
+    }
+    BENCHMARK(BM_MissileChurnPool)->Arg(16)->Arg(256)->Arg(1024);
+
+    void BM_MissileChurnSharedPtr(benchmark::State& state)
+    {
+        const size_t salvo = static_cast<size_t>(state.range(0));
+        const vector::sim::InertialData launchData = LaunchData();
+        const std::string ID = "brot-M1";
+        std::vector<std::shared_ptr<vector::sim::MissileMover>> missiles;
+        missiles.reserve(salvo);
+
+        for(auto _ : state)
+        {
+            for(size_t i = 0; i < salvo; ++i)
+            {
+                missiles.push_back(std::make_shared<vector::sim::MissileMover>(ID, 1, launchData, vector::sim::MoverHandle()));
+                missiles.back()->Move();
+            }
+            missiles.clear();
+        }
+
+        state.SetItemsProcessed(state.iterations() * salvo);
+    }
+    BENCHMARK(BM_MissileChurnSharedPtr)->Arg(16)->Arg(256)->Arg(1024);
+} // namespace
@@ -0,0 +1,129 @@
+#include "benchmark/benchmark.h"
+
+#include "sim/SimConstants.h"
+#include "sim/SpatialGrid.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Point
+    {
+        vector::sim::coord xCoord;
+        vector::sim::coord yCoord;
+    };
+
+    /**
+     * @brief Scatter items uniformly over the arena and index them
+     *
+     */
+    std::vector<Point> PopulateGrid(vector::sim::SpatialGrid& grid, const int numItems)
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<vector::sim::coord> xDistribution(vector::sim::X_COORD_MIN, vector::sim::X_COORD_MAX);
+        std::uniform_real_distribution<vector::sim::coord> yDistribution(vector::sim::Y_COORD_MIN, vector::sim::Y_COORD_MAX);
+
+        std::vector<Point> points(numItems);
+        for(int i = 0; i < numItems; ++i)
+        {
+            points[i] = {xDistribution(generator), yDistribution(generator)};
+            grid.Update(static_cast<uint32_t>(i), points[i].xCoord, points[i].yCoord);
+        }
+
+        return points;
+    }
+
+    // one tick's worth of updates: every item moves as far as a fighter at top speed
+    void BM_SpatialGridUpdateAll(benchmark::State& state)
+    {
+        const int numItems = static_cast<int>(state.range(0));
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        std::vector<Point> points = PopulateGrid(grid, numItems);
+
+        vector::sim::coord step = vector::sim::SPEED_MAX;
+        for(auto _ : state)
+        {
+            for(int i = 0; i < numItems; ++i)
+            {
+                points[i].xCoord += (i % 2 == 0) ? step : -step;
+                grid.Update(static_cast<uint32_t>(i), points[i].xCoord, points[i].yCoord);
+            }
+            step = -step;
+        }
+
+        state.SetItemsProcessed(state.iterations() * numItems);
+    }
+    BENCHMARK(BM_SpatialGridUpdateAll)->RangeMultiplier(10)->Range(1000, 100000);
+
+    // radius queries of a typical sensor range, from every item in turn
+    void BM_SpatialGridQueryRadius(benchmark::State& state)
+    {
+        const int numItems = static_cast<int>(state.range(0));
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        std::vector<Point> points = PopulateGrid(grid, numItems);
+
+        std::vector<uint32_t> results;
+        size_t next = 0;
+        for(auto _ : state)
+        {
+            results.clear();
+            grid.QueryRadius(points[next].xCoord, points[next].yCoord, 20000.0, results);
+            benchmark::DoNotOptimize(results.data());
+            next = (next + 1) % points.size();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_SpatialGridQueryRadius)->RangeMultiplier(10)->Range(1000, 100000);
+
+    // the O(N) scan the grid replaces, for comparison
+    void BM_SpatialGridQueryRadiusBruteForce(benchmark::State& state)
+    {
+        const int numItems = static_cast<int>(state.range(0));
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        std::vector<Point> points = PopulateGrid(grid, numItems);
+        const vector::sim::coord radiusSquared = 20000.0 * 20000.0;
+
+        std::vector<uint32_t> results;
+        size_t next = 0;
+        for(auto _ : state)
+        {
+            results.clear();
+            for(int i = 0; i < numItems; ++i)
+            {
+                const vector::sim::coord xDelta = points[i].xCoord - points[next].xCoord;
+                const vector::sim::coord yDelta = points[i].yCoord - points[next].yCoord;
+                if(xDelta * xDelta + yDelta * yDelta <= radiusSquared)
+                {
+                    results.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            benchmark::DoNotOptimize(results.data());
+            next = (next + 1) % points.size();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_SpatialGridQueryRadiusBruteForce)->RangeMultiplier(10)->Range(1000, 100000);
+
+    void BM_SpatialGridQueryNearest(benchmark::State& state)
+    {
+        const int numItems = static_cast<int>(state.range(0));
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        std::vector<Point> points = PopulateGrid(grid, numItems);
+
+        std::vector<uint32_t> results;
+        size_t next = 0;
+        for(auto _ : state)
+        {
+            results.clear();
+            grid.QueryNearest(points[next].xCoord, points[next].yCoord, 8, results);
+            benchmark::DoNotOptimize(results.data());
+            next = (next + 1) % points.size();
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_SpatialGridQueryNearest)->RangeMultiplier(10)->Range(1000, 100000);
+} // namespace
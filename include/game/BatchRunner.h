@@ -0,0 +1,94 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include "game/BatchSummary.h"
+#include "game/HeadlessMatch.h"
+#include "game/MatchResult.h"
+#include "util/ThreadPool.h"
+
+#include <functional>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace game
+    {
+        /**
+         * @brief Runs a batch of independent headless matches in parallel and sums up how they ended.
+         *
+         * Each match is set up from its own seed by a scenario function, so a batch is reproduced exactly by
+         * running it again from the same first seed. Every match has an engine of its own and runs start to
+         * finish on one thread, and matches share nothing but the slot their result is written to, so the
+         * threads run without locking each other out. Results are summed up in seed order once all have run,
+         * so the summary does not depend on the number of threads.
+         *
+         */
+        class BatchRunner
+        {
+            public:
+                // sets up a match, its units and its script, from a seed
+                typedef std::function<void(HeadlessMatch& match, const uint64_t seed)> ScenarioFunction;
+
+                /**
+                 * @brief Constructor
+                 *
+                 * @param numThreads total threads the matches run on, including the calling thread (minimum 1)
+                 */
+                explicit BatchRunner(const size_t numThreads);
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~BatchRunner() = default;
+
+                /**
+                 * @brief Run a batch of matches, returning once all have run. The scenario function is called from
+                 * several threads at once, so must not change anything it shares between calls
+                 *
+                 * @param scenario      sets each match up
+                 * @param firstSeed     the seed of the first match, those after it are seeded one more each
+                 * @param numMatches    the number of matches
+                 * @param maxTicks      the most ticks any one match runs
+                 * @return BatchSummary the outcomes of the matches, taken together
+                 */
+                BatchSummary Run(const ScenarioFunction& scenario, const uint64_t firstSeed, const size_t numMatches, const uint64_t maxTicks);
+
+                /**
+                 * @brief Get the result of each match in the last batch run, in seed order
+                 *
+                 * @return const std::vector<MatchResult>& the results
+                 */
+                const std::vector<MatchResult>& GetResults() const;
+
+                /**
+                 * @brief Get the number of threads the matches run on, including the calling thread
+                 *
+                 * @return size_t the number of threads
+                 */
+                size_t GetNumThreads() const;
+
+                /**
+                 * @brief Sum up the results of a number of matches
+                 *
+                 * @param results the results
+                 * @return BatchSummary the summary, with no time taken
+                 */
+                static BatchSummary Summarize(const std::vector<MatchResult>& results);
+
+                // delete copy and move constructors and operators
+                BatchRunner(const BatchRunner&) = delete;
+                BatchRunner& operator=(const BatchRunner&) = delete;
+                BatchRunner(BatchRunner&&) = delete;
+                BatchRunner& operator=(BatchRunner&&) = delete;
+
+            private:
+                vector::util::ThreadPool m_ThreadPool;
+                std::vector<MatchResult> m_Results;
+        }; // class BatchRunner
+    } // namespace game
+} // namespace vector
+
+#endif // BATCH_RUNNER_H
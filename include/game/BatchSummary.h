@@ -0,0 +1,42 @@
+#ifndef BATCH_SUMMARY_H
+#define BATCH_SUMMARY_H
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace game
+    {
+        /**
+         * @brief Struct to hold the outcomes of a batch of headless matches, taken together
+         *
+         */
+        struct BatchSummary
+        {
+            size_t numMatches{0};
+            // matches that ended with at most one team left, rather than running out of ticks
+            size_t numDecided{0};
+            // matches won, by team ID
+            std::vector<size_t> wins;
+            // decided matches in which no team was left
+            size_t numNoneLeft{0};
+            // mean fighters left at the end of a match, by team ID
+            std::vector<double> meanSurvivors;
+            // matches in which a missile or collision destroyed a fighter, and the tick of the first such kill across them
+            size_t numFirstKills{0};
+            uint64_t minFirstKillTick{UINT64_MAX};
+            double meanFirstKillTick{0.0};
+            uint64_t maxFirstKillTick{0};
+            uint64_t commandsUnresolved{0};
+            uint64_t commandsRejected{0};
+            // ticks run across all matches, and the wall clock time the batch took
+            uint64_t ticksRun{0};
+            double elapsedSeconds{0.0};
+            double ticksPerSecond{0.0};
+        }; // struct BatchSummary
+    } // namespace game
+} // namespace vector
+
+#endif // BATCH_SUMMARY_H
@@ -1,8 +1,10 @@
 #ifndef GAME_CONSTANTS_H
 #define GAME_CONSTANTS_H
 
-#include <stdint.h>
+#include <array>
 #include <chrono>
+#include <stddef.h>
+#include <stdint.h>
 
 namespace vector
 {
@@ -17,7 +19,31 @@ namespace vector
         constexpr uint8_t DOGFIGHT_DEFAULT_NUM_PLAYERS = 2;
         constexpr uint8_t DOGFIGHT_DEFAULT_NUM_MOVERS_PER_SIDE = 5;
         
-        constexpr std::chrono::milliseconds GAME_THREAD_SLEEP_MILLIS = std::chrono::milliseconds(100);
+        // teams start this far from the centre of the arena, facing it, with their units line abreast
+        constexpr double SPAWN_DISTANCE = 60000.0;
+        constexpr double SPAWN_SPACING = 2000.0;
+        // a team too big for one line forms ranks behind it, squeezed closer together to stay within this width and depth
+        constexpr double SPAWN_FRONT_WIDTH = 80000.0;
+        constexpr double SPAWN_DEPTH = 40000.0;
+        // bearing from the centre of the arena of the spawn point of teams 1 to 4, so that two teams start face to face
+        constexpr std::array<uint16_t, MAX_NUM_PLAYERS> SPAWN_BEARINGS = {180, 0, 270, 90};
+
+        // in delta update mode, every Nth update is a full keyframe
+        constexpr size_t GAME_STATE_KEYFRAME_INTERVAL = 50;
+
+        // threads delivering updates to Players, off the game thread
+        constexpr size_t FAN_OUT_SENDER_THREADS = 2;
+        // updates waiting for a Player beyond which they are collapsed to the latest
+        constexpr size_t PLAYER_UPDATE_QUEUE_DEPTH = 4;
+
+        constexpr uint32_t MIN_TICK_RATE_HZ = 1;
+        constexpr uint32_t MAX_TICK_RATE_HZ = 1000;
+        constexpr uint32_t DEFAULT_TICK_RATE_HZ = 10;
+        // after an overrun, at most this many ticks are run back to back to catch up
+        constexpr size_t MAX_CATCH_UP_TICKS = 5;
+
+        // a queued command not applied within this long is reported as failed
+        constexpr std::chrono::milliseconds COMMAND_ACK_TIMEOUT{2000};
     } // namespace game
 } // namespace vector
 
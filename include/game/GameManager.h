@@ -5,15 +5,24 @@
 #include "game/PlayerInterface.h"
 #include "game/GameConstants.h"
 #include "game/GameSettingsInterface.h"
+#include "game/GameStateFanOut.h"
+#include "sim/EngineCheckpoint.h"
 #include "sim/GameEngine.h"
+#include "sim/ReplayRecorder.h"
+#include "sim/TickCommand.h"
+#include "util/Metrics.h"
+#include "util/TickScheduler.h"
 
 #include <vector>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <mutex>
 #include <atomic>
+#include <chrono>
 #include <thread>
 #include <functional>
+#include <future>
 
 namespace vector
 {
@@ -70,6 +79,102 @@ namespace vector
                  */
                 uint8_t GetNumPlayerSlots() const;
 
+                /**
+                 * @brief Set how GameState updates are pushed to Players
+                 * 
+                 * @param updateMode FULL to push the whole GameState every tick, DELTA to push only the changes
+                 *                   with a periodic keyframe
+                 * @return true if the update mode was set
+                 * @return false if the Game has started
+                 */
+                bool SetGameStateUpdateMode(const vector::game::GAME_STATE_UPDATE_MODE updateMode);
+
+                /**
+                 * @brief Get how GameState updates are pushed to Players
+                 * 
+                 * @return vector::game::GAME_STATE_UPDATE_MODE the update mode
+                 */
+                vector::game::GAME_STATE_UPDATE_MODE GetGameStateUpdateMode() const;
+
+                /**
+                 * @brief Set how close an enemy must be to one of a team's units for the team's Players to see it
+                 * without a radar contact. Players only ever see their own team's view of the GameState
+                 * 
+                 * @param viewRange the range, 0 for Players to see enemies by radar alone
+                 * @return true if the view range was set
+                 * @return false if the view range is negative or the Game has started
+                 */
+                bool SetViewRange(const vector::sim::coord viewRange);
+
+                /**
+                 * @brief Get how close an enemy must be to one of a team's units for the team's Players to see it
+                 * 
+                 * @return vector::sim::coord the view range
+                 */
+                vector::sim::coord GetViewRange() const;
+
+                /**
+                 * @brief Record the Game to a replay log, which a ReplayPlayer can re-run tick by tick.
+                 * The log is created on Start, and holds the units the Game starts with, the commands applied
+                 * each tick, and a keyframe of the GameState every REPLAY_KEYFRAME_INTERVAL ticks
+                 * 
+                 * @param replayPath the path of the log, empty to not record
+                 * @return true if the path was set
+                 * @return false if the Game has started
+                 */
+                bool SetReplayPath(const std::string& replayPath);
+
+                /**
+                 * @brief Get the path the Game is recorded to
+                 * 
+                 * @return std::string the path, empty if the Game is not recorded
+                 */
+                std::string GetReplayPath() const;
+
+                /**
+                 * @brief Set the rate the Game is ticked at
+                 * 
+                 * @param tickRateHz the number of ticks per second
+                 * @return true if the tick rate is between Min and Max allowed and the Game has not started
+                 * @return false if the tick rate is outside Min and Max allowed or the Game has started
+                 */
+                bool SetTickRateHz(const uint32_t tickRateHz);
+
+                /**
+                 * @brief Get the rate the Game is ticked at
+                 * 
+                 * @return uint32_t the number of ticks per second
+                 */
+                uint32_t GetTickRateHz() const;
+
+                /**
+                 * @brief Get the number of times the game thread fell behind its tick schedule
+                 * 
+                 * @return uint64_t the number of overruns
+                 */
+                uint64_t GetNumTickOverruns() const;
+
+                /**
+                 * @brief Get the number of ticks dropped because the game thread fell too far behind to catch up
+                 * 
+                 * @return uint64_t the number of skipped ticks
+                 */
+                uint64_t GetNumSkippedTicks() const;
+
+                /**
+                 * @brief Dump the GameEngine's and this GameManager's metrics as text, one metric per line
+                 * 
+                 * @return std::string the metrics, engine metrics prefixed "engine." and game loop metrics "game."
+                 */
+                std::string GetMetricsText() const;
+
+                /**
+                 * @brief Dump the GameEngine's and this GameManager's metrics as JSON
+                 * 
+                 * @return std::string a JSON object with "engine" and "game" objects of metrics
+                 */
+                std::string GetMetricsJson() const;
+
                 /**
                  * @brief Add a Player to this game
                  * 
@@ -113,13 +218,41 @@ namespace vector
                 bool Start();
 
                 /**
-                 * @brief Stop the Game
+                 * @brief Start the Game without a game thread of its own, for a host to run it by calling RunDueTicks
+                 * 
+                 * @return true if the Game was successfully started
+                 * @return false if the Game was not able to be Started, if some component of the Game had not been set yet
+                 */
+                bool StartHosted();
+
+                /**
+                 * @brief Run the ticks of a hosted Game that are due by now, and hand the Players their update.
+                 * Only one thread may run a Game's ticks at a time, and it acts as the game thread while it does
+                 * 
+                 * @return std::chrono::steady_clock::time_point when the next tick is due, time_point::max() if the
+                 *         Game is not hosted, not started, or has ended
+                 */
+                std::chrono::steady_clock::time_point RunDueTicks();
+
+                /**
+                 * @brief Stop the Game. A hosted Game's ticks must keep being run until Stop returns, and none are
+                 * run after
                  * 
                  * @return true if the Game was successfully stopped
                  * @return false if the game was not sucessfully stopped
                  */
                 bool Stop();
 
+                /**
+                 * @brief Get where a unit starts the game, spread so that no two units start on top of each other
+                 * 
+                 * @param teamID    ID of the unit's team
+                 * @param unitIndex position of the unit in its team's formation
+                 * @param numUnits  number of units in the team
+                 * @return vector::sim::InertialData the unit's starting inertial data
+                 */
+                static vector::sim::InertialData GetSpawnData(const vector::sim::team_ID teamID, const size_t unitIndex, const size_t numUnits);
+
                 // delete copy and move constructors and operators
                 GameManager(const GameManager&) = delete;
                 GameManager& operator=(const GameManager&) = delete;
@@ -139,44 +272,109 @@ namespace vector
                 bool InputCommand(const std::string playerID, const vector::util::Command cmd);
 
                 /**
-                 * @brief Map user issued commands to commands acceptable to the GameEngine
-                 * Command.subject is the Player's ID + the input Subject to allow for Players to have
-                 * units with the same callsign
+                 * @brief Resolve the unit a Player's command is for.
+                 * The engine keeps callsigns unique across the whole Game, and a unit whose callsign another team already
+                 * uses is not added. The callsign is looked up among the Player's team's units only, so a Player cannot
+                 * command another team's units
                  * 
                  * @param playerID The ID of the Player issuing the command
-                 * @param cmd The command issued by the Player
-                 * @return vector::util::Command A command suitable for the GameEngine
+                 * @param callsign The callsign of the unit the command is for
+                 * @return vector::sim::MoverHandle handle of the unit, an invalid handle if the Player has no such unit
+                 */
+                vector::sim::MoverHandle ResolveSubject(const std::string& playerID, const std::string& callsign) const;
+
+                /**
+                 * @brief Find a Player by ID. Caller must hold m_GameSetupMutex
+                 * 
+                 * @param playerID the ID of the Player
+                 * @return std::shared_ptr<vector::game::PlayerInterface> the Player, nullptr if the Player has not joined
                  */
-                vector::util::Command DeconflictCommand(const std::string playerID, const vector::util::Command cmd);
+                std::shared_ptr<vector::game::PlayerInterface> FindPlayer(const std::string& playerID) const;
 
                 /**
-                 * @brief Get the GameState from the GameEngine
+                 * @brief Hand each team's view of the GameEngine's latest snapshot to the fan-out for delivery to the team's Players
                  * 
-                 * @return the current GameState
                  */
                 void UpdateGameState();
 
+                /**
+                 * @brief Create the replay log and record the units the Game starts with
+                 * 
+                 * @return true if the log was created
+                 */
+                bool StartRecording();
+
+                /**
+                 * @brief Record a keyframe of the GameEngine's latest snapshot, and the engine's checkpoint with it
+                 * 
+                 */
+                void RecordKeyframe();
+
+                /**
+                 * @brief Set the Game up to be run and mark it started, short of running it
+                 * 
+                 * @return true if the Game was set up
+                 */
+                bool BeginGame();
+
                 /**
                  * @brief Game thread
                  * 
                  */
                 void Run();
 
+                /**
+                 * @brief Run ticks back to back, then hand the Players their update
+                 * 
+                 * @param dueTicks the number of ticks
+                 */
+                void RunTicks(const size_t dueTicks);
+
                 /**
                  * @brief Randomly generate callsigns for unset units
                  */
                 void AssignCallsignsAsNeeded();
 
                 vector::game::GAME_TYPE m_GameType{vector::game::GAME_TYPE::UNK};
-                std::unordered_map<std::string, std::shared_ptr<vector::game::PlayerInterface>> m_PlayerMap;
+                // in the order they joined
+                std::vector<std::shared_ptr<vector::game::PlayerInterface>> m_Players;
                 uint8_t m_NumPlayerSlots{MIN_NUM_PLAYERS};
                 std::atomic<bool> m_Started{false};
                 std::atomic<bool> m_Ended{false};
                 std::unordered_map<vector::sim::team_ID, bool> m_UnitDataSetMap;
+                std::unordered_map<vector::sim::team_ID, std::unordered_map<std::string, vector::sim::MoverHandle>> m_TeamUnitHandles;
                 mutable std::mutex m_GameSetupMutex;
                 std::unique_ptr<vector::sim::GameEngine> m_GameEnginePtr{nullptr};
                 std::unique_ptr<std::thread> m_GameThreadPtr{nullptr};
+                std::atomic<std::thread::id> m_GameThreadId;
+                // held while a host runs the Game's ticks, so Stop can wait out a run in progress
+                std::mutex m_HostedRunMutex;
+                bool m_Hosted{false};
                 std::unique_ptr<GameSettingsInterface> m_GameSettingsPtr{nullptr};
+                vector::game::GAME_STATE_UPDATE_MODE m_GameStateUpdateMode{vector::game::GAME_STATE_UPDATE_MODE::FULL};
+                vector::util::TickScheduler m_TickScheduler{DEFAULT_TICK_RATE_HZ, MAX_CATCH_UP_TICKS};
+                // the teams of the Players, set on Start, and the view of each published to them, by team ID
+                std::vector<vector::sim::team_ID> m_ViewTeams;
+                std::vector<std::shared_ptr<const vector::sim::GameState>> m_TeamStatePtrs;
+                // recording, when a replay path is set; the batch is only touched on the game thread
+                std::string m_ReplayPath;
+                std::unique_ptr<vector::sim::ReplayRecorder> m_ReplayRecorderPtr{nullptr};
+                std::vector<vector::sim::TickCommand> m_TickCommands;
+                vector::sim::EngineCheckpoint m_Checkpoint;
+
+                vector::util::Metrics m_Metrics;
+                std::atomic<uint64_t>& m_UpdatesSentCounter{m_Metrics.AddCounter("updates_sent")};
+                std::atomic<uint64_t>& m_UpdatesCoalescedCounter{m_Metrics.AddCounter("updates_coalesced")};
+                std::atomic<uint64_t>& m_CommandsReceivedCounter{m_Metrics.AddCounter("commands_received")};
+                std::atomic<uint64_t>& m_CommandsUnresolvedCounter{m_Metrics.AddCounter("commands_unresolved")};
+                std::atomic<uint64_t>& m_CommandsTimedOutCounter{m_Metrics.AddCounter("commands_timed_out")};
+                std::atomic<uint64_t>& m_TickOverrunsCounter{m_Metrics.AddCounter("tick_overruns")};
+                std::atomic<uint64_t>& m_SkippedTicksCounter{m_Metrics.AddCounter("skipped_ticks")};
+                vector::util::LatencyHistogram& m_LoopHistogram{m_Metrics.AddHistogram("loop")};
+                vector::util::LatencyHistogram& m_FanOutHistogram{m_Metrics.AddHistogram("fan_out")};
+
+                // created on Start, and declared last so its senders stop before anything they call into is destroyed
+                std::unique_ptr<GameStateFanOut> m_FanOutPtr{nullptr};
 
         }; // class GameManager
     } // namespace game
@@ -0,0 +1,158 @@
+#ifndef GAME_STATE_FAN_OUT_H
+#define GAME_STATE_FAN_OUT_H
+
+#include "game/GameTypes.h"
+#include "game/PlayerInterface.h"
+#include "sim/GameState.h"
+#include "sim/GameStateDeltaEncoder.h"
+#include "sim/SimConstants.h"
+#include "sim/SimTypes.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace game
+    {
+        /**
+         * @brief Delivers GameState snapshots to Players from a pool of sender threads, off the game thread.
+         *
+         * Every Player has its own bounded queue of snapshots. All queues share the immutable snapshot
+         * published by the GameEngine, or the Players of a team share their team's view, rather than a copy each. A Player is served by one sender at a time,
+         * in the order updates were published, so a Player never sees updates concurrently or out of order.
+         * A sender delivers one update per turn before moving the Player to the back of the line, so slow
+         * Players cannot hold every sender while others wait.
+         * A Player that falls a full queue behind has its queue collapsed to the latest snapshot, so a slow
+         * Player only costs itself updates, never the game thread or the other Players. In delta update
+         * mode each Player has its own encoder, so a delta always applies to whatever that Player last received.
+         *
+         */
+        class GameStateFanOut
+        {
+            public:
+                /**
+                 * @brief Constructor, starts the sender threads
+                 *
+                 * @param numSenderThreads          the number of threads delivering updates (minimum 1)
+                 * @param queueDepth                the most updates waiting for a Player before they are coalesced (minimum 1)
+                 * @param updateMode                FULL to deliver whole GameStates, DELTA to deliver changes with a periodic keyframe
+                 * @param updatesSentCounter        incremented for each update delivered
+                 * @param updatesCoalescedCounter   incremented for each update dropped in favour of a later one
+                 */
+                GameStateFanOut(const size_t numSenderThreads, const size_t queueDepth, const GAME_STATE_UPDATE_MODE updateMode,
+                                std::atomic<uint64_t>& updatesSentCounter, std::atomic<uint64_t>& updatesCoalescedCounter);
+
+                /**
+                 * @brief Destructor, stops the sender threads
+                 *
+                 */
+                virtual ~GameStateFanOut();
+
+                /**
+                 * @brief Add a Player to deliver updates to. Players are served in the order they are added.
+                 * Not safe to call once updates are being published
+                 *
+                 * @param playerPtr the Player
+                 */
+                void AddPlayer(std::shared_ptr<PlayerInterface> playerPtr);
+
+                /**
+                 * @brief Queue a snapshot for every Player. Never waits on a Player
+                 *
+                 * @param gameStatePtr the snapshot, shared by every Player's queue
+                 */
+                void Publish(std::shared_ptr<const vector::sim::GameState> gameStatePtr);
+
+                /**
+                 * @brief Queue each Player the snapshot of its own team's view. Never waits on a Player
+                 *
+                 * @param teamStatePtrs the snapshot of each team's view, by team ID, shared by the queues of the team's
+                 *                      Players. Players of a team without a snapshot are sent an empty GameState
+                 */
+                void Publish(const std::vector<std::shared_ptr<const vector::sim::GameState>>& teamStatePtrs);
+
+                /**
+                 * @brief Block until every queued update has been delivered
+                 *
+                 */
+                void Flush();
+
+                /**
+                 * @brief Stop the sender threads once they finish the updates they are delivering.
+                 * Updates still queued are dropped, and later ones are ignored
+                 *
+                 */
+                void Stop();
+
+                GameStateFanOut(const GameStateFanOut&) = delete;
+                GameStateFanOut& operator=(const GameStateFanOut&) = delete;
+                GameStateFanOut(GameStateFanOut&&) = delete;
+                GameStateFanOut& operator=(GameStateFanOut&&) = delete;
+
+            private:
+                /**
+                 * @brief Struct to hold a Player's queue of updates
+                 *
+                 */
+                struct Channel
+                {
+                    std::shared_ptr<PlayerInterface> playerPtr{nullptr};
+                    vector::sim::team_ID teamID{vector::sim::UNK_TEAM_ID};
+                    std::deque<std::shared_ptr<const vector::sim::GameState>> pending;
+                    // in the ready list or being served by a sender
+                    bool scheduled{false};
+                    // delta update mode only, used by the one sender serving the Player
+                    std::unique_ptr<vector::sim::GameStateDeltaEncoder> encoderPtr{nullptr};
+                }; // struct Channel
+
+                /**
+                 * @brief Queue a snapshot for a Player, coalescing its queue if it is full. Caller must hold m_Mutex
+                 *
+                 * @param channel       the Player's channel
+                 * @param gameStatePtr  the snapshot
+                 * @return true if the channel was not scheduled, and is now ready for a sender
+                 */
+                bool Enqueue(Channel& channel, std::shared_ptr<const vector::sim::GameState> gameStatePtr);
+
+                /**
+                 * @brief Sender thread
+                 *
+                 */
+                void Run();
+
+                /**
+                 * @brief Deliver one update to a Player
+                 *
+                 * @param channel       the Player's channel
+                 * @param gameStatePtr  the snapshot
+                 */
+                void Deliver(Channel& channel, std::shared_ptr<const vector::sim::GameState> gameStatePtr);
+
+                size_t m_QueueDepth;
+                GAME_STATE_UPDATE_MODE m_UpdateMode;
+                std::atomic<uint64_t>& m_UpdatesSentCounter;
+                std::atomic<uint64_t>& m_UpdatesCoalescedCounter;
+
+                std::vector<std::unique_ptr<Channel>> m_Channels;
+                std::shared_ptr<const vector::sim::GameState> m_EmptyStatePtr{std::make_shared<const vector::sim::GameState>()};
+                // channels with updates waiting and no sender serving them, in the order they became ready
+                std::deque<Channel*> m_ReadyChannels;
+                size_t m_NumScheduled{0};
+                bool m_Stopping{false};
+                std::mutex m_Mutex;
+                std::condition_variable m_ReadyCondition;
+                std::condition_variable m_IdleCondition;
+                std::vector<std::thread> m_Senders;
+        }; // class GameStateFanOut
+    } // namespace game
+} // namespace vector
+
+#endif // GAME_STATE_FAN_OUT_H
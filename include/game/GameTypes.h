@@ -2,11 +2,15 @@
 #define GAME_TYPES_H
 
 #include <string>
+#include <stdint.h>
 
 namespace vector
 {
     namespace game
     {
+        // identifies a Game hosted by a MatchHost, 0 is never used
+        typedef uint64_t match_ID;
+
         enum class GAME_TYPE
         {
             UNK,
@@ -19,6 +23,12 @@ namespace vector
             FIGHTER
         };
 
+        enum class GAME_STATE_UPDATE_MODE
+        {
+            FULL,
+            DELTA
+        };
+
         struct UnitData
         {
             std::string callsign;
@@ -0,0 +1,136 @@
+#ifndef HEADLESS_MATCH_H
+#define HEADLESS_MATCH_H
+
+#include "game/GameTypes.h"
+#include "game/MatchResult.h"
+#include "game/ScriptedCommand.h"
+#include "sim/GameEngine.h"
+#include "sim/MoverHandle.h"
+#include "sim/SimTypes.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace game
+    {
+        /**
+         * @brief Runs a match with no Players and no clock, ticking the GameEngine back to back as fast as it goes.
+         *
+         * Units are set up and spawned as a GameManager does, and given their commands from a script rather
+         * than by Players. The match runs on the calling thread until one team is left or a number of ticks
+         * has run, and reports how it ended and how many ticks a second it ran at. Nothing is shared between
+         * matches, so any number can run at once on different threads.
+         *
+         */
+        class HeadlessMatch
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param gameEnginePtr the engine to run the match in
+                 */
+                explicit HeadlessMatch(std::unique_ptr<vector::sim::GameEngine> gameEnginePtr);
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~HeadlessMatch() = default;
+
+                /**
+                 * @brief Add a team's units, spawned in the team's formation
+                 *
+                 * @param teamID    ID of the team
+                 * @param unitData  the team's units
+                 * @return true if the units were added
+                 * @return false if the team has units already, the team ID is UNK_TEAM_ID or above MAX_NUM_PLAYERS,
+                 *         a unit type is unknown, or the match has run
+                 */
+                bool SetUnitData(const vector::sim::team_ID teamID, const std::vector<vector::game::UnitData>& unitData);
+
+                /**
+                 * @brief Add a command to the script. Commands are applied in order of their tick, and those for the
+                 * same tick in the order they were added. A command for a tick already run is applied before the next
+                 *
+                 * @param scriptedCommand the command
+                 */
+                void AddScriptedCommand(const ScriptedCommand& scriptedCommand);
+
+                /**
+                 * @brief Run the match until at most one team has fighters left, or it has run a number of ticks in
+                 * all. A match of a single team runs the whole number of ticks
+                 *
+                 * @param maxTicks the most ticks the match runs
+                 * @return MatchResult the outcome of the match so far
+                 */
+                MatchResult Run(const uint64_t maxTicks);
+
+                /**
+                 * @brief Get the engine the match runs in
+                 *
+                 * @return vector::sim::GameEngine& the engine
+                 */
+                vector::sim::GameEngine& GetGameEngine();
+
+                // delete copy and move constructors and operators
+                HeadlessMatch(const HeadlessMatch&) = delete;
+                HeadlessMatch& operator=(const HeadlessMatch&) = delete;
+                HeadlessMatch(HeadlessMatch&&) = delete;
+                HeadlessMatch& operator=(HeadlessMatch&&) = delete;
+
+            private:
+                struct Fighter
+                {
+                    vector::sim::MoverHandle handle;
+                    vector::sim::team_ID teamID{vector::sim::UNK_TEAM_ID};
+                    bool alive{false};
+                }; // struct Fighter
+
+                /**
+                 * @brief Apply the scripted commands due before the next tick
+                 *
+                 */
+                void ApplyScriptedCommands();
+
+                /**
+                 * @brief Take fighters destroyed in the last tick out of their teams, and decide the match if at
+                 * most one team is left
+                 *
+                 */
+                void ReadEvents();
+
+                /**
+                 * @brief Mark a fighter destroyed
+                 *
+                 * @param fighter the fighter
+                 */
+                void RemoveFighter(Fighter& fighter);
+
+                std::unique_ptr<vector::sim::GameEngine> m_GameEnginePtr{nullptr};
+                vector::sim::GameEngine::EventCursor m_EventCursor;
+
+                std::unordered_map<vector::sim::team_ID, std::unordered_map<std::string, vector::sim::MoverHandle>> m_TeamUnitHandles;
+                // by handle index, an invalid handle for entries that are not fighters
+                std::vector<Fighter> m_Fighters;
+                // fighters left, by team ID
+                std::vector<size_t> m_TeamFightersLeft;
+                size_t m_NumTeams{0};
+
+                // sorted by tick from the next command on
+                std::vector<ScriptedCommand> m_Script;
+                size_t m_NextScriptedCommand{0};
+                bool m_ScriptSorted{true};
+
+                MatchResult m_Result;
+        }; // class HeadlessMatch
+    } // namespace game
+} // namespace vector
+
+#endif // HEADLESS_MATCH_H
@@ -0,0 +1,181 @@
+#ifndef MATCH_HOST_H
+#define MATCH_HOST_H
+
+#include "game/GameManager.h"
+#include "game/GameTypes.h"
+#include "util/Metrics.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace game
+    {
+        /**
+         * @brief Hosts many Games on a fixed set of threads, rather than a thread per Game.
+         *
+         * Each Game is started hosted and run by whichever worker takes it when its next tick is due. Every worker
+         * keeps the Games it last ran in a queue of its own ordered by deadline, so the Games it runs stay on
+         * the same thread while it keeps up. A worker with nothing due of its own steals an overdue Game from the
+         * top of another worker's queue, so one slow Game holds up no others while a thread is free. Workers with
+         * nothing due anywhere sleep until the earliest deadline across all queues, and a worker about to run a
+         * Game while others wait in its queue wakes one of them to steal any that fall due meanwhile.
+         *
+         */
+        class MatchHost
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param numThreads the number of workers (minimum 1)
+                 */
+                explicit MatchHost(const size_t numThreads);
+
+                /**
+                 * @brief Destructor, stops every Game still hosted then the workers
+                 *
+                 */
+                virtual ~MatchHost();
+
+                /**
+                 * @brief Start a Game and host it until it is removed
+                 *
+                 * @param gameManagerPtr the Game, set up and ready to start
+                 * @return match_ID the ID the Game is hosted under, 0 if it could not be started, in which case it is destroyed
+                 */
+                match_ID AddMatch(std::unique_ptr<GameManager> gameManagerPtr);
+
+                /**
+                 * @brief Stop a Game and stop hosting it
+                 *
+                 * @param matchID the ID of the Game
+                 * @return true if the Game was stopped
+                 * @return false if no Game is hosted under the ID
+                 */
+                bool RemoveMatch(const match_ID matchID);
+
+                /**
+                 * @brief Get a hosted Game, to inspect it or set Players up. It stays valid until it is removed
+                 *
+                 * @param matchID the ID of the Game
+                 * @return GameManager* the Game, nullptr if no Game is hosted under the ID
+                 */
+                GameManager* GetMatch(const match_ID matchID) const;
+
+                /**
+                 * @brief Get the number of Games hosted
+                 *
+                 * @return size_t the number of Games
+                 */
+                size_t GetNumMatches() const;
+
+                /**
+                 * @brief Get the number of workers
+                 *
+                 * @return size_t the number of workers
+                 */
+                size_t GetNumThreads() const;
+
+                /**
+                 * @brief Get the host's metrics: runs of Games' ticks, steals between workers, and how late and long runs were
+                 *
+                 * @return const vector::util::Metrics& the metrics
+                 */
+                const vector::util::Metrics& GetMetrics() const;
+
+                // delete copy and move constructors and operators
+                MatchHost(const MatchHost&) = delete;
+                MatchHost& operator=(const MatchHost&) = delete;
+                MatchHost(MatchHost&&) = delete;
+                MatchHost& operator=(MatchHost&&) = delete;
+
+            private:
+                struct HostedMatch
+                {
+                    match_ID matchID{0};
+                    std::unique_ptr<GameManager> gameManagerPtr{nullptr};
+                    // set once the Game is stopped, after which workers drop it rather than run it
+                    std::atomic<bool> removed{false};
+                }; // struct HostedMatch
+
+                struct ScheduledMatch
+                {
+                    std::chrono::steady_clock::time_point deadline;
+                    std::shared_ptr<HostedMatch> matchPtr{nullptr};
+                }; // struct ScheduledMatch
+
+                // a worker's Games, a heap with the earliest deadline on top
+                struct WorkerQueue
+                {
+                    mutable std::mutex mutex;
+                    std::vector<ScheduledMatch> heap;
+                }; // struct WorkerQueue
+
+                /**
+                 * @brief Worker thread
+                 *
+                 * @param workerIndex the worker's index
+                 */
+                void Run(const size_t workerIndex);
+
+                /**
+                 * @brief Take the Game on top of a worker's queue if it is due
+                 *
+                 * @param workerIndex   the worker whose queue to take from
+                 * @param now           the time
+                 * @param scheduled     set to the Game taken
+                 * @return true if a Game was taken
+                 */
+                bool TakeDue(const size_t workerIndex, const std::chrono::steady_clock::time_point now, ScheduledMatch& scheduled);
+
+                /**
+                 * @brief Add a Game to a worker's queue
+                 *
+                 * @param workerIndex   the worker
+                 * @param scheduled     the Game and its deadline
+                 */
+                void Schedule(const size_t workerIndex, ScheduledMatch scheduled);
+
+                /**
+                 * @brief Get the earliest deadline in any worker's queue
+                 *
+                 * @return std::chrono::steady_clock::time_point the deadline, time_point::max() if no Game is queued
+                 */
+                std::chrono::steady_clock::time_point GetEarliestDeadline() const;
+
+                std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+                std::vector<std::thread> m_Workers;
+                std::atomic<size_t> m_NextQueue{0};
+
+                mutable std::mutex m_MatchesMutex;
+                std::unordered_map<match_ID, std::shared_ptr<HostedMatch>> m_Matches;
+                match_ID m_NextMatchID{1};
+
+                // sleeping workers wake when a Game is added, as it may be due before anything they wait on
+                std::mutex m_WakeMutex;
+                std::condition_variable m_WakeCondition;
+                uint64_t m_WakeGeneration{0};
+                bool m_Stopping{false};
+
+                vector::util::Metrics m_Metrics;
+                std::atomic<uint64_t>& m_MatchesAddedCounter{m_Metrics.AddCounter("matches_added")};
+                std::atomic<uint64_t>& m_MatchesRemovedCounter{m_Metrics.AddCounter("matches_removed")};
+                std::atomic<uint64_t>& m_RunsCounter{m_Metrics.AddCounter("runs")};
+                std::atomic<uint64_t>& m_StealsCounter{m_Metrics.AddCounter("steals")};
+                vector::util::LatencyHistogram& m_LatenessHistogram{m_Metrics.AddHistogram("lateness")};
+                vector::util::LatencyHistogram& m_RunHistogram{m_Metrics.AddHistogram("run")};
+        }; // class MatchHost
+    } // namespace game
+} // namespace vector
+
+#endif // MATCH_HOST_H
@@ -0,0 +1,39 @@
+#ifndef MATCH_RESULT_H
+#define MATCH_RESULT_H
+
+#include "sim/SimConstants.h"
+#include "sim/SimTypes.h"
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace game
+    {
+        /**
+         * @brief Struct to hold the outcome of a headless match
+         *
+         */
+        struct MatchResult
+        {
+            uint64_t ticksRun{0};
+            // true if the match ended with at most one team left, rather than running out of ticks
+            bool decided{false};
+            // the team left, UNK_TEAM_ID if the match was not decided or no team was left
+            vector::sim::team_ID winningTeamID{vector::sim::UNK_TEAM_ID};
+            // fighters left at the end, by team ID
+            std::vector<size_t> survivors;
+            // the tick, counted from 0, in which a missile or collision first destroyed a fighter, UINT64_MAX if none did
+            uint64_t firstKillTick{UINT64_MAX};
+            // scripted commands whose subject was not one of the team's fighters, and those the engine did not apply
+            uint64_t commandsUnresolved{0};
+            uint64_t commandsRejected{0};
+            double elapsedSeconds{0.0};
+            double ticksPerSecond{0.0};
+        }; // struct MatchResult
+    } // namespace game
+} // namespace vector
+
+#endif // MATCH_RESULT_H
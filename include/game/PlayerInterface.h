@@ -3,10 +3,12 @@
 
 #include "game/GameTypes.h"
 #include "sim/GameState.h"
+#include "sim/GameStateDelta.h"
 #include "sim/SimTypes.h"
 #include "util/Command.h"
 
 #include <functional>
+#include <memory>
 
 namespace vector
 {
@@ -40,11 +42,20 @@ namespace vector
                 virtual bool IsReady() const = 0;
 
                 /**
-                 * @brief Update the locally held GameState, to be pushed to the client connection
+                 * @brief Update the locally held GameState, to be pushed to the client connection.
+                 * Called from a sender thread rather than the game thread, one update at a time
                  * 
-                 * @param gameState the current locall held game state
+                 * @param gameStatePtr the latest game state, an immutable snapshot shared with every other Player
                  */
-                virtual void UpdateGameState(const vector::sim::GameState gameState) = 0;
+                virtual void UpdateGameState(std::shared_ptr<const vector::sim::GameState> gameStatePtr) = 0;
+
+                /**
+                 * @brief Update the locally held GameState with the changes since the last update,
+                 * used in place of UpdateGameState when the Game is in delta update mode
+                 * 
+                 * @param gameStateDelta the changes since the previous update, or a keyframe
+                 */
+                virtual void UpdateGameStateDelta(const vector::sim::GameStateDelta& gameStateDelta) = 0;
 
                 /**
                  * @brief Register the function Clients will invoke to input commands
@@ -0,0 +1,28 @@
+#ifndef SCRIPTED_COMMAND_H
+#define SCRIPTED_COMMAND_H
+
+#include "sim/SimTypes.h"
+#include "util/Command.h"
+
+#include <stdint.h>
+
+namespace vector
+{
+    namespace game
+    {
+        /**
+         * @brief Struct to hold a command a headless match gives one of a team's units at a set point
+         *
+         */
+        struct ScriptedCommand
+        {
+            // applied once this many ticks have run, before the next
+            uint64_t tick{0};
+            // the team of the unit named by the command's subject
+            vector::sim::team_ID teamID{0};
+            vector::util::Command cmd;
+        }; // struct ScriptedCommand
+    } // namespace game
+} // namespace vector
+
+#endif // SCRIPTED_COMMAND_H
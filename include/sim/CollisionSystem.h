@@ -0,0 +1,129 @@
+#ifndef COLLISION_SYSTEM_H
+#define COLLISION_SYSTEM_H
+
+#include "sim/InertialData.h"
+#include "sim/SimTypes.h"
+#include "sim/SpatialGrid.h"
+#include "util/ThreadPool.h"
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Mid-air collision detection between Movers, run once per tick after they have moved.
+         *
+         * Each body is the straight path a Mover flew this tick. The broad phase is one radius query
+         * per body on a grid of where the bodies ended the tick, wide enough to take in anything whose
+         * path could have come near its own; the narrow phase finds the closest approach of each candidate
+         * pair over the tick from their relative motion. Checking the whole of both paths, rather than
+         * where the Movers ended up, catches fast Movers that pass through each other between ticks.
+         * The grid's cells are sized to the search rather than shared with the coarser spatial index, so
+         * the cost grows with the number of bodies times the number near each, not with the square of the
+         * number of bodies.
+         *
+         * Bodies are referred to by their Mover table index.
+         *
+         */
+        class CollisionSystem
+        {
+            public:
+                /**
+                 * @brief Struct to hold a pair of bodies that collided
+                 *
+                 */
+                struct Collision
+                {
+                    // firstIndex < secondIndex
+                    uint32_t firstIndex;
+                    uint32_t secondIndex;
+                }; // struct Collision
+
+                /**
+                 * @brief Constructor
+                 *
+                 * @param radius   bodies whose paths pass within this distance of each other collide
+                 * @param cellSize width and height of each broad phase grid cell
+                 */
+                CollisionSystem(const coord radius, const coord cellSize);
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~CollisionSystem() = default;
+
+                /**
+                 * @brief Forget the bodies of the last detection
+                 *
+                 */
+                void ClearBodies();
+
+                /**
+                 * @brief Add a body to the next detection
+                 *
+                 * @param index     the Mover's index
+                 * @param startData the Mover's inertial data at the start of the tick
+                 * @param endData   the Mover's inertial data at the end of the tick
+                 */
+                void AddBody(const uint32_t index, const InertialData& startData, const InertialData& endData);
+
+                /**
+                 * @brief Find every pair of bodies that collided
+                 *
+                 * @param poolPtr       pool to spread bodies across, nullptr to detect serially
+                 * @param collisions    the pairs found are appended, ordered by first then second index
+                 */
+                void Detect(vector::util::ThreadPool* poolPtr, std::vector<Collision>& collisions);
+
+                CollisionSystem(const CollisionSystem&) = delete;
+                CollisionSystem& operator=(const CollisionSystem&) = delete;
+                CollisionSystem(CollisionSystem&&) = delete;
+                CollisionSystem& operator=(CollisionSystem&&) = delete;
+
+            private:
+                /**
+                 * @brief Struct to hold what detection needs to know of a body
+                 *
+                 */
+                struct Body
+                {
+                    uint32_t index;
+                    coord startX;
+                    coord startY;
+                    coord endX;
+                    coord endY;
+                    // distance flown this tick
+                    coord step;
+                }; // struct Body
+
+                /**
+                 * @brief Detect the collisions of a range of bodies with bodies of higher index
+                 *
+                 * @param begin         first body
+                 * @param end           one past the last body
+                 * @param collisions    the pairs found are appended
+                 */
+                void DetectRange(const size_t begin, const size_t end, std::vector<Collision>& collisions) const;
+
+                static constexpr uint32_t NO_BODY = UINT32_MAX;
+
+                coord m_Radius;
+                // end positions of the bodies, keyed by index
+                SpatialGrid m_Grid;
+                std::vector<Body> m_Bodies;
+                // body of each index, NO_BODY for indices that are not bodies
+                std::vector<uint32_t> m_BodyOfIndex;
+                // the longest step of any body, which bounds how far apart two colliding bodies can end the tick
+                coord m_MaxStep{0.0};
+                // per parallel task
+                std::vector<std::vector<Collision>> m_TaskCollisions;
+        }; // class CollisionSystem
+    } // namespace sim
+} // namespace vector
+
+#endif // COLLISION_SYSTEM_H
@@ -0,0 +1,79 @@
+#ifndef ENGINE_CHECKPOINT_H
+#define ENGINE_CHECKPOINT_H
+
+#include "sim/InertialData.h"
+#include "sim/MoverHandle.h"
+#include "sim/RadarSystem.h"
+#include "sim/SimParams.h"
+#include "sim/SimTypes.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Enum to denote what a Mover table entry held when it was checkpointed
+         *
+         */
+        enum class CHECKPOINT_ENTRY_TYPE : uint8_t
+        {
+            FREE = 0,
+            FIGHTER = 1,
+            MISSILE = 2
+        };
+
+        /**
+         * @brief Struct to store a Mover table entry as it was between Ticks
+         *
+         */
+        struct EntryCheckpoint
+        {
+            CHECKPOINT_ENTRY_TYPE type{CHECKPOINT_ENTRY_TYPE::FREE};
+            // of the entry, whether free or not, so handles issued before and after the checkpoint keep their meaning
+            uint32_t generation{0};
+            team_ID teamID{UNK_TEAM_ID};
+            std::string ID;
+            InertialData inertialData;
+            angle desiredHeading{0};
+            bool status{true};
+            bool inSpatialIndex{false};
+
+            // fighters only
+            MoverParams performanceValues;
+            MoverHandle lockedTarget;
+            uint32_t missilesRemaining{0};
+
+            // missiles only
+            MoverHandle target;
+            uint32_t fuelTicks{0};
+        }; // struct EntryCheckpoint
+
+        /**
+         * @brief Struct to store everything a GameEngine of stored fighters and missiles needs to carry on ticking
+         * exactly as it would have from the point it was checkpointed
+         *
+         */
+        struct EngineCheckpoint
+        {
+            // the number of Ticks run before the checkpoint
+            uint64_t ticks{0};
+            uint64_t numMissilesLaunched{0};
+            // by Mover table index
+            std::vector<EntryCheckpoint> entries;
+            // free entry indices, the next to be reused last
+            std::vector<uint32_t> freeEntries;
+            // entry indices of the stored fighters, in the MoverStore's dense order
+            std::vector<uint32_t> storeOrder;
+            // entry indices of the missiles in flight, in launch order
+            std::vector<uint32_t> missileEntries;
+            // each team's radar contacts, by team
+            std::vector<std::vector<RadarSystem::Contact>> teamContacts;
+        }; // struct EngineCheckpoint
+    } // namespace sim
+} // namespace vector
+
+#endif // ENGINE_CHECKPOINT_H
@@ -0,0 +1,64 @@
+#ifndef ENGINE_EVENT_H
+#define ENGINE_EVENT_H
+
+#include "sim/MoverHandle.h"
+#include "sim/SimTypes.h"
+#include "sim/SimConstants.h"
+#include "util/Command.h"
+
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Enum to denote what happened in an EngineEvent
+         *
+         */
+        enum class ENGINE_EVENT_TYPE
+        {
+            // a Mover was added, or a missile launched
+            MOVER_ADDED,
+            // a Mover was destroyed by a collision or a missile
+            MOVER_DESTROYED,
+            // a Mover was destroyed by leaving the arena
+            OUT_OF_BOUNDS,
+            // a destroyed Mover was removed, and its handle is now stale
+            MOVER_REMOVED,
+            // a command was not applied
+            COMMAND_REJECTED
+        };
+
+        /**
+         * @brief Enum to denote what destroyed a Mover
+         *
+         */
+        enum class DESTRUCTION_CAUSE
+        {
+            COLLISION,
+            MISSILE_HIT
+        };
+
+        /**
+         * @brief Struct to store something that happened to a Mover in a GameEngine.
+         * Plain data, so events are published into the engine's ring by copying
+         *
+         */
+        struct EngineEvent
+        {
+            ENGINE_EVENT_TYPE type{ENGINE_EVENT_TYPE::MOVER_ADDED};
+            // the number of Ticks run before the event
+            uint64_t tick{0};
+            // the Mover the event is about, or the subject of a rejected command
+            MoverHandle handle;
+            // the launcher of an added missile, the Mover collided with, or the missile that hit
+            MoverHandle otherHandle;
+            team_ID teamID{UNK_TEAM_ID};
+            DESTRUCTION_CAUSE cause{DESTRUCTION_CAUSE::COLLISION};
+            vector::util::COMMAND_TYPE command{vector::util::COMMAND_TYPE::UNK};
+        }; // struct EngineEvent
+    } // namespace sim
+} // namespace vector
+
+#endif // ENGINE_EVENT_H
@@ -0,0 +1,127 @@
+#ifndef FIGHTER_KINEMATICS_H
+#define FIGHTER_KINEMATICS_H
+
+#include "sim/InertialData.h"
+#include "sim/SimTypes.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Enum to denote the instruction set used by the batched kinematics kernel
+         * 
+         */
+        enum class KINEMATICS_ISA
+        {
+            SCALAR,
+            SSE2,
+            AVX2
+        };
+
+        /**
+         * @brief Struct to point the batched kinematics kernel at N fighters stored as arrays.
+         * Fighters whose status is false are left untouched.
+         * 
+         */
+        struct FighterBatch
+        {
+            angle* headings{nullptr};
+            const angle* desiredHeadings{nullptr};
+            speed* speeds{nullptr};
+            coord* xCoords{nullptr};
+            coord* yCoords{nullptr};
+            uint8_t* statuses{nullptr};
+            size_t count{0};
+        }; // struct FighterBatch
+
+        /**
+         * @brief Stateless fighter flight model.
+         *
+         * Shared by FighterMover and MoverStore so that object-based and
+         * array-based fighters advance identically.
+         *
+         */
+        class FighterKinematics
+        {
+            public:
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~FighterKinematics() = default;
+
+                /**
+                 * @brief Advance a fighter's inertial data by one tick, slewing towards the desired heading
+                 *
+                 * @param inertialData      the fighter's inertial data, updated in place
+                 * @param desiredHeading    the heading the fighter is slewing to
+                 * @return true if the fighter is still within the arena bounds after the move
+                 * @return false if the fighter has left the arena
+                 */
+                static bool Move(InertialData& inertialData, const angle desiredHeading);
+
+                /**
+                 * @brief Advance every functioning fighter in a batch by one tick using the best
+                 * instruction set supported by this CPU. Results are bit-identical to calling Move
+                 * on each fighter, and fighters that leave the arena have their status cleared.
+                 * 
+                 * @param batch the fighters to advance
+                 */
+                static void MoveBatch(const FighterBatch& batch);
+
+                /**
+                 * @brief Advance every functioning fighter in a batch by one tick using the given instruction set
+                 * 
+                 * @param batch the fighters to advance
+                 * @param isa   the instruction set to use, must be supported by this CPU
+                 */
+                static void MoveBatch(const FighterBatch& batch, const KINEMATICS_ISA isa);
+
+                /**
+                 * @brief Determine whether this CPU supports an instruction set for MoveBatch
+                 * 
+                 * @param isa the instruction set to check
+                 * @return true if MoveBatch can run with the instruction set
+                 * @return false otherwise
+                 */
+                static bool IsIsaSupported(const KINEMATICS_ISA isa);
+
+                /**
+                 * @brief Get the widest instruction set supported by this CPU, detected once at runtime
+                 * 
+                 * @return KINEMATICS_ISA the instruction set MoveBatch uses by default
+                 */
+                static KINEMATICS_ISA GetBestIsa();
+
+                /**
+                 * @brief Determine whether inertial data is a valid starting state for a fighter
+                 *
+                 * @param inertialData the inertial data to validate
+                 * @return true if heading, speed and position are all within limits
+                 * @return false otherwise
+                 */
+                static bool IsValidInitialInertialData(const InertialData& inertialData);
+
+                /**
+                 * @brief Determine whether a heading is a valid desired heading (0-359)
+                 *
+                 * @param heading the heading to validate
+                 * @return true if the heading is valid
+                 * @return false otherwise
+                 */
+                static bool IsValidHeading(const angle heading);
+
+                FighterKinematics() = delete;
+                FighterKinematics(const FighterKinematics&) = delete;
+                FighterKinematics& operator=(const FighterKinematics&) = delete;
+                FighterKinematics(FighterKinematics&&) = delete;
+                FighterKinematics& operator=(FighterKinematics&&) = delete;
+        }; // class FighterKinematics
+    } // namespace sim
+} // namespace vector
+
+#endif // FIGHTER_KINEMATICS_H
@@ -29,7 +29,7 @@ namespace vector
                  * @brief Default Destructor
                  * 
                  */
-                virtual FighterMover::~FighterMover() = default;
+                virtual ~FighterMover() = default;
 
                 /**
                  * @brief Get this Mover's unique ID
@@ -53,6 +53,13 @@ namespace vector
                  */
                 bool SetNewHeading(const angle newHeadingDegrees) override;
 
+                /**
+                 * @brief Get the heading this Mover is slewing to
+                 * 
+                 * @return angle the desired heading
+                 */
+                angle GetDesiredHeading() const override;
+
                 /**
                  * @brief Set the initial position of this Mover
                  * 
@@ -90,6 +97,13 @@ namespace vector
                  */
                 vector::sim::team_ID GetTeam() const override;
 
+                /**
+                 * @brief Get this Mover's performance characteristics
+                 * 
+                 * @return MoverParams this Mover's performance characteristics
+                 */
+                MoverParams GetPerformanceValues() const override;
+
                 /**
                  * @brief Get a string representation of this Mover
                  * 
@@ -1,10 +1,28 @@
 #ifndef GAME_ENGINE_H
 #define GAME_ENGINE_H
 
+#include "sim/CollisionSystem.h"
+#include "sim/EngineCheckpoint.h"
+#include "sim/EngineEvent.h"
+#include "sim/MissileMover.h"
+#include "sim/MoverHandle.h"
 #include "sim/MoverInterface.h"
+#include "sim/MoverStore.h"
+#include "sim/RadarSystem.h"
 #include "sim/GameState.h"
+#include "sim/SimParams.h"
+#include "sim/SpatialGrid.h"
+#include "sim/TickCommand.h"
+#include "util/BroadcastRingBuffer.h"
 #include "util/Command.h"
+#include "util/Metrics.h"
+#include "util/MpscRingBuffer.h"
+#include "util/ObjectPool.h"
+#include "util/ThreadPool.h"
 
+#include <array>
+#include <atomic>
+#include <future>
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -24,12 +42,23 @@ namespace vector
         class GameEngine
         {
             public:
+                // a subscriber's place in the engine's event stream
+                typedef vector::util::BroadcastRingBuffer<EngineEvent>::Cursor EventCursor;
+
                 /**
                  * @brief Constructor
                  * 
                  */
                 GameEngine() = default;
 
+                /**
+                 * @brief Constructor for an engine that ticks in parallel
+                 * 
+                 * @param numTickThreads the number of threads, including the calling thread, that
+                 *                       Tick partitions Movers across (1 ticks serially)
+                 */
+                explicit GameEngine(const size_t numTickThreads);
+
                 /**
                  * @brief Destructor
                  * 
@@ -40,10 +69,33 @@ namespace vector
                  * @brief Add a Mover to this GameEngine
                  * 
                  * @param mover Mover to be added
-                 * @return true If the Mover was successfully added
-                 * @return false If the Mover was unable to be added (non-unique ID, etc)
+                 * @return MoverHandle the handle assigned to the Mover,
+                 *          an invalid handle if the Mover was unable to be added (non-unique ID, etc)
+                 */
+                MoverHandle AddMover(std::shared_ptr<MoverInterface> moverPtr);
+
+                /**
+                 * @brief Add a fighter to this GameEngine's structure-of-arrays MoverStore.
+                 * Stored fighters are advanced together in one linear pass per Tick,
+                 * and are reachable through GetMover as thin MoverInterface views.
+                 * 
+                 * @param ID                The fighter's unique ID
+                 * @param teamID            The ID of the team the fighter belongs to
+                 * @param performanceValues Performance characteristics of the fighter
+                 * @return MoverHandle the handle assigned to the fighter,
+                 *          an invalid handle if the fighter was unable to be added (non-unique ID, etc)
+                 */
+                MoverHandle AddFighter(const std::string& ID, const vector::sim::team_ID teamID, const MoverParams performanceValues);
+
+                /**
+                 * @brief Look up the handle of a Mover by its ID.
+                 * Intended for the edges of the game (setup, text commands); everything else should hold on to handles.
+                 * Missiles are not commanded, so are not found by ID: their handles come with MOVER_ADDED events
+                 * 
+                 * @param moverID ID of the Mover
+                 * @return MoverHandle the Mover's handle, an invalid handle if the specified Mover does not exist
                  */
-                bool AddMover(std::shared_ptr<MoverInterface> moverPtr);
+                MoverHandle GetMoverHandle(const std::string& moverID) const;
 
                 /**
                  * @brief Retrieve the specified Mover
@@ -55,28 +107,496 @@ namespace vector
                 std::shared_ptr<MoverInterface> GetMover(const std::string& moverID);
 
                 /**
-                 * @brief Handle a command to the GameEngine
+                 * @brief Retrieve the specified Mover
+                 * 
+                 * @param handle handle of the Mover to be retrieved
+                 * @return MoverInterface Ptr to the specified Mover,
+                 *          nullptr if the handle is stale or was never assigned, or the Mover is a missile
+                 *          (missiles belong to the engine's missile pool and are only seen through the GameState)
+                 */
+                std::shared_ptr<MoverInterface> GetMover(const MoverHandle handle);
+
+                /**
+                 * @brief Handle a command to the GameEngine, resolving the subject by ID
                  * 
                  * @param cmd Command to be handled
                  */
                 bool InputCommand(util::Command cmd);
 
                 /**
-                 * @brief Get a snapshot representation of this GameEngine's state
+                 * @brief Handle a command to the GameEngine. The command's subject string is ignored
                  * 
-                 * @return this GameEngine's state (Mover intertial data, etc)
+                 * @param subjectHandle   handle of the Mover the command is for
+                 * @param cmd             Command to be handled
+                 * @return true if the command was applied
+                 * @return false if the handle is stale or the command could not be applied
+                 */
+                bool InputCommand(const MoverHandle subjectHandle, const util::Command& cmd);
+
+                /**
+                 * @brief Queue a command to be applied at the start of the next Tick.
+                 * Lock-free, so callers never contend with a running Tick; commands are applied
+                 * in the order they were queued
+                 * 
+                 * @param subjectHandle   handle of the Mover the command is for
+                 * @param cmd             Command to be handled
+                 * @return std::future<bool> becomes true once the command has been applied, false if it could
+                 *                           not be applied or the queue was full
+                 */
+                std::future<bool> QueueCommand(const MoverHandle subjectHandle, const util::Command& cmd);
+
+                /**
+                 * @brief Get a copy of the latest published snapshot of this GameEngine's state
+                 * 
+                 * @return this GameEngine's state (Mover intertial data, etc), ordered by handle index
                  */
                 GameState GetGameState() const;
 
                 /**
-                 * @brief Run the Engine for one tick
+                 * @brief Get the latest published snapshot of this GameEngine's state.
+                 * A snapshot is published at the end of every Tick and is immutable, so readers never wait on,
+                 * or hold up, a Tick. Changes made outside of Tick (adding Movers, or altering Movers retrieved
+                 * through GetMover) are captured the first time a snapshot is requested after them.
+                 * 
+                 * @return std::shared_ptr<const GameState> the snapshot, which remains valid for as long as it is held
+                 */
+                std::shared_ptr<const GameState> GetGameStateSnapshot() const;
+
+                /**
+                 * @brief Get the latest snapshot of what a team can see: every one of its own Movers, and the enemies
+                 * its radars held at the end of the last Tick or that are within the view range of one of its Movers.
+                 * Every team's view is built in one pass over the latest snapshot, the first time any team's view is
+                 * requested after it is published. Like the full snapshot, a view is immutable
+                 * 
+                 * @param teamID the team
+                 * @return std::shared_ptr<const GameState> the team's view, ordered by handle index; empty for a team with no Movers
+                 */
+                std::shared_ptr<const GameState> GetTeamGameStateSnapshot(const team_ID teamID) const;
+
+                /**
+                 * @brief Set how close an enemy must be to one of a team's Movers to be in the team's view
+                 * without being held by the team's radars
+                 * 
+                 * @param viewRange the range, 0 for teams to see enemies by radar alone
+                 * @return true if the view range was set
+                 * @return false if the view range is negative
+                 */
+                bool SetViewRange(const coord viewRange);
+
+                /**
+                 * @brief Get how close an enemy must be to one of a team's Movers to be in the team's view
+                 * 
+                 * @return coord the view range
+                 */
+                coord GetViewRange() const;
+
+                /**
+                 * @brief Run the Engine for one tick.
+                 * With more than one tick thread, Movers are partitioned across the tick pool;
+                 * the results and the order in which destroyed Movers are removed are the same as a serial tick.
                  * 
                  */
                 void Tick();
+
+                /**
+                 * @brief Run the Engine for one tick, as Tick, recording the commands it drains from the queue.
+                 * Queueing the same commands before each Tick of an engine set up the same way replays the tick exactly
+                 * 
+                 * @param drainedCommands the commands applied at the start of the tick are appended, in the order applied
+                 */
+                void Tick(std::vector<TickCommand>& drainedCommands);
+
+                /**
+                 * @brief Find the Movers within a radius of a point, as positioned at the end of the last Tick
+                 * 
+                 * @param xCoord    x coordinate of the point
+                 * @param yCoord    y coordinate of the point
+                 * @param radius    the radius
+                 * @param results   handles of the Movers found are appended, in no particular order
+                 */
+                void GetMoversInRadius(const coord xCoord, const coord yCoord, const coord radius, std::vector<MoverHandle>& results) const;
+
+                /**
+                 * @brief Find the Movers nearest a point, as positioned at the end of the last Tick
+                 * 
+                 * @param xCoord    x coordinate of the point
+                 * @param yCoord    y coordinate of the point
+                 * @param count     the most Movers to find
+                 * @param results   handles of the Movers found are appended, nearest first
+                 */
+                void GetNearestMovers(const coord xCoord, const coord yCoord, const size_t count, std::vector<MoverHandle>& results) const;
+
+                /**
+                 * @brief Get the enemy Movers a team's radars held at the end of the last Tick
+                 * 
+                 * @param teamID    the team
+                 * @param results   the team's contacts are appended, ordered by handle index
+                 */
+                void GetTeamContacts(const team_ID teamID, std::vector<RadarContact>& results) const;
+
+                /**
+                 * @brief Get the target a Mover has acquired. A lock is lost once the target is no longer
+                 * one of its team's radar contacts
+                 * 
+                 * @param handle handle of the Mover
+                 * @return MoverHandle the target's handle, an invalid handle if there is no lock
+                 */
+                MoverHandle GetLockedTarget(const MoverHandle handle) const;
+
+                /**
+                 * @brief Get the number of missiles a Mover has left to launch
+                 * 
+                 * @param handle handle of the Mover
+                 * @return uint32_t the missiles remaining, 0 if the handle is stale
+                 */
+                uint32_t GetMissilesRemaining(const MoverHandle handle) const;
+
+                /**
+                 * @brief Checkpoint this GameEngine as it stands between Ticks: every fighter and missile, missile guidance
+                 * and fuel, target locks and missiles remaining, the generation of every entry and the free list, and
+                 * every team's radar contacts with their identification. Mover objects added with AddMover cannot be
+                 * copied, so an engine holding any is not checkpointed
+                 * 
+                 * @param checkpoint assigned the checkpoint, over its existing storage
+                 * @return true if the engine was checkpointed
+                 * @return false if the engine holds Mover objects
+                 */
+                bool GetCheckpoint(EngineCheckpoint& checkpoint) const;
+
+                /**
+                 * @brief Restore a checkpoint into this GameEngine, after which it ticks on, and issues handles, exactly as
+                 * the engine the checkpoint was taken from. Events published afterwards are stamped from the checkpoint's
+                 * tick; none are published for the Movers restored
+                 * 
+                 * @param checkpoint the checkpoint
+                 * @return true if the checkpoint was restored
+                 * @return false if anything has been added to, or run in, this engine, or the checkpoint is inconsistent,
+                 *          in which case nothing is restored
+                 */
+                bool RestoreCheckpoint(const EngineCheckpoint& checkpoint);
+
+                /**
+                 * @brief Subscribe to this GameEngine's event stream, from the next event published on.
+                 * Each subscriber owns its cursor, so there is nothing to unsubscribe
+                 * 
+                 * @return EventCursor the subscriber's cursor
+                 */
+                EventCursor SubscribeEvents() const;
+
+                /**
+                 * @brief Take the next event at a subscriber's cursor. Lock-free, so it may be called while the GameEngine runs.
+                 * Events come in the order they happened, stamped with the number of Ticks run before them.
+                 * A subscriber that falls more than ENGINE_EVENT_CAPACITY events behind skips the oldest, which are
+                 * counted in the cursor's numMissed
+                 * 
+                 * @param cursor the subscriber's cursor, advanced past the event
+                 * @param event  assigned the event
+                 * @return true if an event was taken
+                 * @return false if the subscriber is up to date
+                 */
+                bool PollEvent(EventCursor& cursor, EngineEvent& event) const;
+
+                /**
+                 * @brief Get this GameEngine's counters and latency histograms (tick phases, snapshot builds,
+                 * waits on the Movers mutex, commands, Movers added and removed)
+                 * 
+                 * @return const vector::util::Metrics& the metrics, which may be read while the GameEngine runs
+                 */
+                const vector::util::Metrics& GetMetrics() const;
+
+                /**
+                 * @brief Get the number of threads Tick partitions Movers across
+                 * 
+                 * @return size_t the number of tick threads, 1 if ticking serially
+                 */
+                size_t GetNumTickThreads() const;
             
             private:
-                std::unordered_map<std::string, std::shared_ptr<MoverInterface>> m_AllMoversMap;
+                /**
+                 * @brief Struct to hold a Mover's slot in the Mover table
+                 * 
+                 */
+                struct MoverEntry
+                {
+                    uint32_t generation{0};
+                    bool occupied{false};
+                    // the Mover object, nullptr for a fighter held in the MoverStore
+                    std::shared_ptr<MoverInterface> moverPtr{nullptr};
+                    store_slot storeSlot{INVALID_STORE_SLOT};
+                    // a missile allocated from m_MissilePool, nullptr for every other Mover
+                    MissileMover* missilePtr{nullptr};
+                    // target acquired with AQUIRE
+                    MoverHandle lockedTarget;
+                    uint32_t missilesRemaining{0};
+                }; // struct MoverEntry
+
+                /**
+                 * @brief Struct to hold a command waiting for the next Tick, and the channel its result is returned on
+                 * 
+                 */
+                struct QueuedCommand
+                {
+                    MoverHandle subjectHandle;
+                    util::Command cmd;
+                    std::promise<bool> resultPromise;
+                }; // struct QueuedCommand
+
+                /**
+                 * @brief Determine whether an ID is held by a Mover in this GameEngine. Caller must hold m_MoversMutex
+                 * 
+                 * @param moverID the ID to check
+                 * @return true if a current Mover has the ID
+                 * @return false otherwise
+                 */
+                bool IsIDInUse(const std::string& moverID) const;
+
+                /**
+                 * @brief Determine whether a handle refers to a current Mover. Caller must hold m_MoversMutex
+                 * 
+                 * @param handle the handle to check
+                 * @return true if the handle's index is occupied by the generation it was issued for
+                 * @return false otherwise
+                 */
+                bool IsCurrent(const MoverHandle handle) const;
+
+                /**
+                 * @brief Take an entry from the free list, or grow the Mover table. Caller must hold m_MoversMutex
+                 * 
+                 * @return MoverHandle handle to the new entry
+                 */
+                MoverHandle AllocateEntry();
+
+                /**
+                 * @brief Return an entry to the free list, invalidating all handles to it. Caller must hold m_MoversMutex
+                 * 
+                 * @param index index of the entry to release
+                 */
+                void ReleaseEntry(const uint32_t index);
+
+                /**
+                 * @brief Apply a command to a Mover. Caller must hold m_MoversMutex
+                 * 
+                 * @param subjectHandle   handle of the Mover the command is for
+                 * @param cmd             Command to be applied
+                 * @return true if the command was applied
+                 * @return false if the handle is stale or the command could not be applied
+                 */
+                bool ApplyCommand(const MoverHandle subjectHandle, const util::Command& cmd);
+
+                /**
+                 * @brief Find a Mover by handle, wrapping stored fighters in a view. Caller must hold m_MoversMutex
+                 * 
+                 * @param handle handle of the Mover to be found
+                 * @return MoverInterface Ptr to the specified Mover, nullptr if it does not exist
+                 */
+                std::shared_ptr<MoverInterface> FindMover(const MoverHandle handle);
+
+                /**
+                 * @brief Advance the stored fighters, split into contiguous ranges across the tick pool
+                 * 
+                 */
+                void MoveStoredFighters();
+
+                /**
+                 * @brief Move functioning Mover objects and collect the indices of destroyed ones,
+                 * partitioned across the tick pool and merged back in index order
+                 * 
+                 * @param markForRemove filled with the entry indices of destroyed Mover objects
+                 */
+                void MoveMoverObjects(std::vector<uint32_t>& markForRemove);
+
+                /**
+                 * @brief Guide each missile toward its target's current position and move it, destroying both the
+                 * missile and the target if the missile's path this tick passes within its proximity radius of the target.
+                 * Missiles that are destroyed or out of fuel are taken out of the missile list. Caller must hold m_MoversMutex
+                 * 
+                 * @param markForRemove filled with the entry indices of missiles to be released
+                 */
+                void MoveMissiles(std::vector<uint32_t>& markForRemove);
+
+                /**
+                 * @brief Launch a missile from a Mover at a target. Caller must hold m_MoversMutex
+                 * 
+                 * @param launcherIndex entry index of the launching Mover
+                 * @param targetHandle  handle of the target
+                 * @return true if the missile was launched
+                 * @return false if the launcher has no missiles left or the missile pool is exhausted
+                 */
+                bool LaunchMissile(const uint32_t launcherIndex, const MoverHandle targetHandle);
+
+                /**
+                 * @brief Get the inertial data of any kind of Mover. Caller must hold m_MoversMutex
+                 * 
+                 * @param index entry index of the Mover, which must be occupied
+                 * @return InertialData the Mover's inertial data
+                 */
+                InertialData GetEntryInertialData(const uint32_t index) const;
+
+                /**
+                 * @brief Get whether any kind of Mover is functioning. Caller must hold m_MoversMutex
+                 * 
+                 * @param index entry index of the Mover, which must be occupied
+                 * @return true if the Mover is functioning
+                 * @return false if the Mover is destroyed
+                 */
+                bool GetEntryStatus(const uint32_t index) const;
+
+                /**
+                 * @brief Mark any kind of Mover as destroyed. Caller must hold m_MoversMutex
+                 * 
+                 * @param index entry index of the Mover, which must be occupied
+                 */
+                void DestroyEntry(const uint32_t index);
+
+                /**
+                 * @brief Publish an event to subscribers, stamped with the current tick. Caller must hold m_MoversMutex,
+                 * which makes it the event stream's only producer
+                 * 
+                 * @param event the event
+                 */
+                void PublishEvent(EngineEvent event);
+
+                /**
+                 * @brief Build a snapshot of the current state and publish it to readers. Caller must hold m_MoversMutex
+                 * 
+                 */
+                void PublishGameState() const;
+
+                /**
+                 * @brief Build every team's view of the published snapshot. Caller must hold m_MoversMutex
+                 * 
+                 */
+                void BuildTeamViews() const;
+
+                /**
+                 * @brief Bring the spatial index up to date with every Mover's position, taking out stored fighters
+                 * destroyed since, and publishing those that left the arena. Caller must hold m_MoversMutex
+                 * 
+                 */
+                void UpdateSpatialIndex();
+
+                /**
+                 * @brief Record every Mover's inertial data before it moves, as the start of the path it flies this Tick.
+                 * Caller must hold m_MoversMutex
+                 * 
+                 */
+                void RecordStartData();
+
+                /**
+                 * @brief Destroy every pair of Movers, other than missiles, whose paths crossed this Tick, take them
+                 * out of the spatial index and publish their destruction. Caller must hold m_MoversMutex
+                 * 
+                 */
+                void DetectCollisions();
+
+                /**
+                 * @brief Convert spatial index IDs to handles. Caller must hold m_MoversMutex
+                 * 
+                 * @param IDs       the IDs, which are Mover table indices
+                 * @param results   the handles are appended in the same order
+                 */
+                void ToMoverHandles(const std::vector<uint32_t>& IDs, std::vector<MoverHandle>& results) const;
+
+                /**
+                 * @brief Run one tick. Caller must not hold m_MoversMutex
+                 * 
+                 * @param drainedCommandsPtr the commands applied are appended here, nullptr not to record them
+                 */
+                void RunTick(std::vector<TickCommand>* drainedCommandsPtr);
+
+                /**
+                 * @brief Find every team's radar contacts, and drop target locks on Movers no longer held.
+                 * Caller must hold m_MoversMutex
+                 * 
+                 */
+                void SweepRadar();
+
+                /**
+                 * @brief Resolve the target of a command by callsign. Caller must hold m_MoversMutex
+                 * 
+                 * @param cmd the command
+                 * @return MoverHandle the target's handle, an invalid handle if there is no current target
+                 */
+                MoverHandle ResolveTarget(const util::Command& cmd) const;
+
+                // wider than team_ID, so that all 256 teams can have a row apart from it
+                static constexpr uint16_t NO_VIEW_ROW = UINT16_MAX;
+
+                std::vector<MoverEntry> m_MoverEntries;
+                std::vector<uint32_t> m_FreeEntries;
+                size_t m_NumMoverObjects{0};
+                // ID to handle of every Mover but missiles, only consulted at the edges; stale handles are replaced when their
+                // ID is reused
+                std::unordered_map<std::string, MoverHandle> m_MoverHandles;
+                MoverStore m_MoverStore;
+                std::vector<uint32_t> m_StoreSlotToEntry;
+                std::vector<store_slot> m_RemovedStoreSlots;
+                std::vector<uint32_t> m_RemovedEntries;
+                // missiles live in the pool's fixed storage, so launching and expiring them never touches the heap
+                vector::util::ObjectPool<MissileMover> m_MissilePool{MISSILE_POOL_CAPACITY};
+                // entry indices of missiles in flight, in launch order
+                std::vector<uint32_t> m_MissileEntries;
+                std::vector<uint32_t> m_RemovedMissiles;
+                uint64_t m_NumMissilesLaunched{0};
+                // keyed by Mover table index
+                SpatialGrid m_SpatialGrid{SPATIAL_GRID_CELL_SIZE};
+                RadarSystem m_Radar;
+                CollisionSystem m_Collisions{COLLISION_RADIUS, COLLISION_GRID_CELL_SIZE};
+                std::vector<CollisionSystem::Collision> m_CollisionPairs;
+                // inertial data of each Mover at the start of the Tick, by Mover table index
+                std::vector<InertialData> m_StartData;
+                // team of each Mover, by Mover table index
+                std::vector<team_ID> m_EntryTeams;
+                std::unique_ptr<vector::util::ThreadPool> m_TickPoolPtr{nullptr};
                 mutable std::mutex m_MoversMutex;
+                vector::util::MpscRingBuffer<QueuedCommand> m_CommandQueue{COMMAND_QUEUE_CAPACITY};
+                vector::util::BroadcastRingBuffer<EngineEvent> m_Events{ENGINE_EVENT_CAPACITY};
+
+                // double buffered snapshots: readers load m_PublishedStatePtr atomically; the back buffer is
+                // rebuilt in place once no reader holds it any more
+                mutable std::shared_ptr<const GameState> m_PublishedStatePtr{nullptr};
+                mutable std::shared_ptr<GameState> m_FrontStatePtr{nullptr};
+                mutable std::shared_ptr<GameState> m_BackStatePtr{nullptr};
+                mutable std::atomic<bool> m_StateStale{true};
+                mutable uint64_t m_NumStatesPublished{0};
+
+                // each team's view of the published snapshot, by team, built from the m_TeamViewsBuiltFrom'th snapshot;
+                // a view's storage is rebuilt in place once no reader holds it any more
+                coord m_ViewRange{DEFAULT_VIEW_RANGE};
+                mutable std::vector<std::shared_ptr<GameState>> m_TeamStatePtrs;
+                mutable uint64_t m_TeamViewsBuiltFrom{0};
+                std::shared_ptr<const GameState> m_EmptyStatePtr{std::make_shared<const GameState>()};
+                // row of each team in m_InView, NO_VIEW_ROW for teams with no Movers
+                mutable std::array<uint16_t, UINT8_MAX + 1> m_ViewRows;
+                // a row per team of a flag per Mover table index, set for each Mover in the team's view
+                mutable std::vector<uint8_t> m_InView;
+                mutable std::vector<uint32_t> m_ViewQueryResults;
+
+                vector::util::Metrics m_Metrics;
+                std::atomic<uint64_t>& m_TicksCounter{m_Metrics.AddCounter("ticks")};
+                std::atomic<uint64_t>& m_CommandsProcessedCounter{m_Metrics.AddCounter("commands_processed")};
+                std::atomic<uint64_t>& m_CommandsRejectedCounter{m_Metrics.AddCounter("commands_rejected")};
+                std::atomic<uint64_t>& m_CommandsQueuedCounter{m_Metrics.AddCounter("commands_queued")};
+                std::atomic<uint64_t>& m_CommandsDroppedCounter{m_Metrics.AddCounter("commands_dropped")};
+                std::atomic<uint64_t>& m_MoversAddedCounter{m_Metrics.AddCounter("movers_added")};
+                std::atomic<uint64_t>& m_MoversRemovedCounter{m_Metrics.AddCounter("movers_removed")};
+                std::atomic<uint64_t>& m_MissilesLaunchedCounter{m_Metrics.AddCounter("missiles_launched")};
+                std::atomic<uint64_t>& m_MissileHitsCounter{m_Metrics.AddCounter("missile_hits")};
+                std::atomic<uint64_t>& m_CollisionsCounter{m_Metrics.AddCounter("collisions")};
+                std::atomic<uint64_t>& m_EventsPublishedCounter{m_Metrics.AddCounter("events_published")};
+                vector::util::LatencyHistogram& m_TickHistogram{m_Metrics.AddHistogram("tick")};
+                vector::util::LatencyHistogram& m_TickLockWaitHistogram{m_Metrics.AddHistogram("tick_lock_wait")};
+                vector::util::LatencyHistogram& m_TickCommandsHistogram{m_Metrics.AddHistogram("tick_commands")};
+                vector::util::LatencyHistogram& m_TickRemoveHistogram{m_Metrics.AddHistogram("tick_remove")};
+                vector::util::LatencyHistogram& m_TickMissilesHistogram{m_Metrics.AddHistogram("tick_missiles")};
+                vector::util::LatencyHistogram& m_TickMoveStoredHistogram{m_Metrics.AddHistogram("tick_move_stored")};
+                vector::util::LatencyHistogram& m_TickSpatialIndexHistogram{m_Metrics.AddHistogram("tick_spatial_index")};
+                vector::util::LatencyHistogram& m_TickCollisionsHistogram{m_Metrics.AddHistogram("tick_collisions")};
+                vector::util::LatencyHistogram& m_TickRadarHistogram{m_Metrics.AddHistogram("tick_radar")};
+                vector::util::LatencyHistogram& m_TickMoveObjectsHistogram{m_Metrics.AddHistogram("tick_move_objects")};
+                vector::util::LatencyHistogram& m_SnapshotHistogram{m_Metrics.AddHistogram("snapshot_build")};
+                vector::util::LatencyHistogram& m_TeamViewsHistogram{m_Metrics.AddHistogram("team_views_build")};
+                vector::util::LatencyHistogram& m_CommandLockWaitHistogram{m_Metrics.AddHistogram("command_lock_wait")};
         };
     } // namespace sim
 } // namespace vector
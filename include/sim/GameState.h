@@ -2,6 +2,7 @@
 #define GAME_STATE_H
 
 #include "sim/InertialData.h"
+#include "sim/MoverHandle.h"
 #include "sim/SimTypes.h"
 
 #include "game/GameTypes.h"
@@ -19,17 +20,29 @@ namespace vector
          */
         struct MoverState
         {
+            MoverHandle handle;
             std::string ID;
             vector::sim::team_ID teamID;
             vector::sim::InertialData inertialData;
         }; // struct MoverState
 
+        /**
+         * @brief Struct to store a radar contact held by a team
+         * 
+         */
+        struct RadarContact
+        {
+            MoverHandle handle;
+            bool identified{false};
+        }; // struct RadarContact
+
         /**
          * @brief Struct to store a Game's state
          * 
          */
         struct GameState
         {
+            // ordered by handle index
             std::vector<MoverState> moverList;
         }; // struct GameState
     } // namespace sim
@@ -0,0 +1,75 @@
+#ifndef GAME_STATE_BINARY_DECODER_H
+#define GAME_STATE_BINARY_DECODER_H
+
+#include "sim/GameState.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Decodes the messages of a GameStateBinaryEncoder back into GameStates on the receiving side,
+         * keeping the string table of IDs the encoder has sent.
+         *
+         * Messages are treated as untrusted: every length and count is checked against the bytes left, so
+         * a truncated or corrupted message is rejected rather than read past its end.
+         *
+         */
+        class GameStateBinaryDecoder
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 */
+                GameStateBinaryDecoder() = default;
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~GameStateBinaryDecoder() = default;
+
+                /**
+                 * @brief Decode a message
+                 *
+                 * @param buffer    the message
+                 * @param size      the size of the message in bytes
+                 * @param gameState assigned the decoded GameState
+                 * @return true if the message was decoded
+                 * @return false if the message is malformed, of another version, or refers to an ID that has not
+                 *               been received; gameState is left unchanged, and the encoder needs a Reset in the last case
+                 */
+                bool Decode(const uint8_t* buffer, const size_t size, GameState& gameState);
+
+                GameStateBinaryDecoder(const GameStateBinaryDecoder&) = delete;
+                GameStateBinaryDecoder& operator=(const GameStateBinaryDecoder&) = delete;
+                GameStateBinaryDecoder(GameStateBinaryDecoder&&) = delete;
+                GameStateBinaryDecoder& operator=(GameStateBinaryDecoder&&) = delete;
+
+            private:
+                /**
+                 * @brief Struct to hold the ID received for a handle index
+                 *
+                 */
+                struct KnownID
+                {
+                    uint32_t generation;
+                    std::string ID;
+                }; // struct KnownID
+
+                // keyed by handle index; a map, since indices in a corrupted message are unbounded
+                std::unordered_map<uint32_t, KnownID> m_IDs;
+                // the Movers are decoded into here, then swapped in, so a bad message leaves the caller's state intact
+                std::vector<MoverState> m_ScratchList;
+        }; // class GameStateBinaryDecoder
+    } // namespace sim
+} // namespace vector
+
+#endif // GAME_STATE_BINARY_DECODER_H
@@ -0,0 +1,89 @@
+#ifndef GAME_STATE_BINARY_ENCODER_H
+#define GAME_STATE_BINARY_ENCODER_H
+
+#include "sim/GameState.h"
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Encodes a stream of GameStates into a compact, versioned binary wire format.
+         *
+         * Every field is fixed width and little-endian. A message is:
+         *
+         *      u16 magic, u8 version, u8 flags
+         *      u32 number of IDs, then for each:     u32 handle index, u32 generation, u16 length, the ID's bytes
+         *      u32 number of Movers, then for each:  u32 handle index, u32 generation, u8 team, u16 heading,
+         *                                            then f64 speed, f64 x, f64 y
+         *                                            or, quantized, u16 speed, i32 x, i32 y in quantum steps
+         *
+         * IDs make up a string table on the receiving side: each one is sent once, in the first message to
+         * carry its Mover, and Movers are matched to their IDs by handle after that. The first message, and
+         * the first after Reset, restarts the receiver's table.
+         *
+         */
+        class GameStateBinaryEncoder
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param quantize true to send speeds and coordinates in GAME_STATE_SPEED_QUANTUM and
+                 *                 GAME_STATE_COORD_QUANTUM steps, false to send them exactly
+                 */
+                explicit GameStateBinaryEncoder(const bool quantize);
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~GameStateBinaryEncoder() = default;
+
+                /**
+                 * @brief Get the most bytes a GameState can take to encode, as when every ID is sent
+                 *
+                 * @param gameState the GameState
+                 * @return size_t a buffer size that always fits the encoded GameState
+                 */
+                size_t GetMaxEncodedSize(const GameState& gameState) const;
+
+                /**
+                 * @brief Encode a GameState into the caller's buffer. IDs are only counted as sent once a message
+                 * carrying them has been encoded in full
+                 *
+                 * @param gameState the GameState
+                 * @param buffer    the buffer to encode into
+                 * @param capacity  the size of the buffer in bytes
+                 * @return size_t the size of the message, 0 if it did not fit or an ID is too long to send
+                 */
+                size_t Encode(const GameState& gameState, uint8_t* buffer, const size_t capacity);
+
+                /**
+                 * @brief Forget which IDs have been sent, so the next message carries every ID and restarts the
+                 * receiver's table, e.g. when a message has been lost
+                 *
+                 */
+                void Reset();
+
+                GameStateBinaryEncoder(const GameStateBinaryEncoder&) = delete;
+                GameStateBinaryEncoder& operator=(const GameStateBinaryEncoder&) = delete;
+                GameStateBinaryEncoder(GameStateBinaryEncoder&&) = delete;
+                GameStateBinaryEncoder& operator=(GameStateBinaryEncoder&&) = delete;
+
+            private:
+                bool m_Quantize;
+                bool m_ResetPending{true};
+                // generation plus one of the Mover whose ID was last sent for each handle index, 0 for none
+                std::vector<uint64_t> m_SentIDs;
+                // positions in the Mover list of the Movers whose IDs the message being encoded carries
+                std::vector<size_t> m_NewIDs;
+        }; // class GameStateBinaryEncoder
+    } // namespace sim
+} // namespace vector
+
+#endif // GAME_STATE_BINARY_ENCODER_H
@@ -0,0 +1,53 @@
+#ifndef GAME_STATE_DELTA_H
+#define GAME_STATE_DELTA_H
+
+#include "sim/GameState.h"
+#include "sim/InertialData.h"
+#include "sim/MoverHandle.h"
+
+#include <vector>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        typedef uint8_t mover_field_mask;
+
+        static const mover_field_mask MOVER_FIELD_HEADING = 1 << 0;
+        static const mover_field_mask MOVER_FIELD_SPEED = 1 << 1;
+        static const mover_field_mask MOVER_FIELD_X_COORD = 1 << 2;
+        static const mover_field_mask MOVER_FIELD_Y_COORD = 1 << 3;
+
+        /**
+         * @brief Struct to store the fields of a Mover that changed since the previous GameState.
+         * Only the inertial data fields flagged in changedFields are meaningful
+         *
+         */
+        struct MoverStateChange
+        {
+            MoverHandle handle;
+            mover_field_mask changedFields{0};
+            vector::sim::InertialData inertialData;
+        }; // struct MoverStateChange
+
+        /**
+         * @brief Struct to store the difference between two consecutive GameStates.
+         * A keyframe carries every Mover in added and replaces the receiver's state outright.
+         * All lists are ordered by handle index
+         *
+         */
+        struct GameStateDelta
+        {
+            uint64_t sequence{0};
+            // the sequence this delta applies on top of, ignored for keyframes
+            uint64_t baseSequence{0};
+            bool keyframe{false};
+            std::vector<MoverState> added;
+            std::vector<MoverHandle> removed;
+            std::vector<MoverStateChange> changed;
+        }; // struct GameStateDelta
+    } // namespace sim
+} // namespace vector
+
+#endif // GAME_STATE_DELTA_H
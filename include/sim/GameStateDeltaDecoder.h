@@ -0,0 +1,80 @@
+#ifndef GAME_STATE_DELTA_DECODER_H
+#define GAME_STATE_DELTA_DECODER_H
+
+#include "sim/GameState.h"
+#include "sim/GameStateDelta.h"
+
+#include <vector>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Reconstructs full GameStates on the receiving side from a stream of GameStateDeltas.
+         *
+         */
+        class GameStateDeltaDecoder
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 */
+                GameStateDeltaDecoder() = default;
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~GameStateDeltaDecoder() = default;
+
+                /**
+                 * @brief Apply a delta to the reconstructed GameState
+                 *
+                 * @param delta the delta to apply
+                 * @return true if the delta was applied
+                 * @return false if the delta does not follow the last applied one, or does not match the
+                 *               reconstructed state; the state is left unchanged and a keyframe is needed
+                 */
+                bool Apply(const GameStateDelta& delta);
+
+                /**
+                 * @brief Get the reconstructed GameState
+                 *
+                 * @return const GameState& the GameState as of the last applied delta, ordered by handle index
+                 */
+                const GameState& GetGameState() const;
+
+                /**
+                 * @brief Determine whether a keyframe has been applied, and the state is being tracked
+                 *
+                 * @return true if the reconstructed GameState is usable
+                 * @return false if no keyframe has been applied yet
+                 */
+                bool IsSynchronised() const;
+
+                /**
+                 * @brief Get the sequence of the last applied delta
+                 *
+                 * @return uint64_t sequence of the last applied delta
+                 */
+                uint64_t GetSequence() const;
+
+                GameStateDeltaDecoder(const GameStateDeltaDecoder&) = delete;
+                GameStateDeltaDecoder& operator=(const GameStateDeltaDecoder&) = delete;
+                GameStateDeltaDecoder(GameStateDeltaDecoder&&) = delete;
+                GameStateDeltaDecoder& operator=(GameStateDeltaDecoder&&) = delete;
+
+            private:
+                GameState m_GameState;
+                // the next state is merged into here, then swapped in, so a bad delta leaves m_GameState intact
+                std::vector<MoverState> m_ScratchList;
+                uint64_t m_Sequence{0};
+                bool m_Synchronised{false};
+        }; // class GameStateDeltaDecoder
+    } // namespace sim
+} // namespace vector
+
+#endif // GAME_STATE_DELTA_DECODER_H
@@ -0,0 +1,76 @@
+#ifndef GAME_STATE_DELTA_ENCODER_H
+#define GAME_STATE_DELTA_ENCODER_H
+
+#include "sim/GameState.h"
+#include "sim/GameStateDelta.h"
+
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Turns a sequence of GameState snapshots into GameStateDeltas.
+         *
+         * The previous snapshot is held rather than copied; since snapshots are immutable
+         * and ordered by handle index, the dirty fields of every Mover fall out of a single
+         * merge of the two Mover lists.
+         *
+         */
+        class GameStateDeltaEncoder
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param keyframeInterval every keyframeInterval-th delta is a keyframe (1 makes every delta a keyframe)
+                 */
+                explicit GameStateDeltaEncoder(const size_t keyframeInterval);
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~GameStateDeltaEncoder() = default;
+
+                /**
+                 * @brief Encode a snapshot as a delta against the previously encoded snapshot
+                 *
+                 * @param gameStatePtr the snapshot to encode, ordered by handle index
+                 * @return GameStateDelta the changes since the previous snapshot, or a keyframe
+                 */
+                GameStateDelta Encode(std::shared_ptr<const GameState> gameStatePtr);
+
+                /**
+                 * @brief Force the next delta to be a keyframe, e.g. when a receiver has lost track
+                 *
+                 */
+                void RequestKeyframe();
+
+                GameStateDeltaEncoder(const GameStateDeltaEncoder&) = delete;
+                GameStateDeltaEncoder& operator=(const GameStateDeltaEncoder&) = delete;
+                GameStateDeltaEncoder(GameStateDeltaEncoder&&) = delete;
+                GameStateDeltaEncoder& operator=(GameStateDeltaEncoder&&) = delete;
+
+            private:
+                /**
+                 * @brief Fill a delta with the differences between the previous snapshot and the given one
+                 *
+                 * @param gameState the snapshot being encoded
+                 * @param delta     the delta to fill
+                 */
+                void Diff(const GameState& gameState, GameStateDelta& delta) const;
+
+                size_t m_KeyframeInterval;
+                size_t m_DeltasSinceKeyframe{0};
+                bool m_KeyframeRequested{true};
+                uint64_t m_Sequence{0};
+                std::shared_ptr<const GameState> m_PreviousStatePtr{nullptr};
+        }; // class GameStateDeltaEncoder
+    } // namespace sim
+} // namespace vector
+
+#endif // GAME_STATE_DELTA_ENCODER_H
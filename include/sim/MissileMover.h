@@ -0,0 +1,185 @@
+#ifndef MISSILE_MOVER_H
+#define MISSILE_MOVER_H
+
+#include "MoverInterface.h"
+#include "MoverHandle.h"
+
+#include "SimConstants.h"
+#include "SimTypes.h"
+#include "SimParams.h"
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Missile that flies pure pursuit toward a target until it hits or its fuel runs out.
+         *
+         * Missiles are short lived and launched in numbers, so GameEngine allocates them from a
+         * fixed capacity ObjectPool rather than the heap. Each tick the engine steers the missile
+         * at its target's current position with Guide, then moves it. The ID is held in place too,
+         * so launching and expiring a missile allocates nothing.
+         *
+         */
+        class MissileMover : public MoverInterface
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param ID            This missile's unique ID, cut to MISSILE_ID_SIZE characters
+                 * @param teamID        The ID of the team that launched this missile
+                 * @param launchData    The launcher's inertial data, which the missile starts with
+                 * @param targetHandle  Handle of the Mover this missile is guided toward
+                 */
+                MissileMover(const std::string_view ID, const vector::sim::team_ID teamID, const InertialData launchData, const MoverHandle targetHandle);
+
+                /**
+                 * @brief Default Destructor
+                 *
+                 */
+                virtual ~MissileMover() = default;
+
+                /**
+                 * @brief Get this Mover's unique ID
+                 *
+                 * @return std::string this Mover's unique ID
+                 */
+                std::string GetID() const override;
+
+                /**
+                 * @brief Get this Mover's unique ID without copying it, valid for as long as the missile
+                 *
+                 * @return std::string_view this Mover's unique ID
+                 */
+                std::string_view GetIDView() const;
+
+                /**
+                 * @brief Turn toward the desired heading, accelerate and advance one tick, burning a tick of fuel.
+                 *          The missile is destroyed once out of fuel or out of the arena
+                 *
+                 */
+                void Move() override;
+
+                /**
+                 * @brief Set a new heading (0-359) for this missile, which it will slew to at its turn rate
+                 *
+                 * @param newHeading The new heading the missile will slew to
+                 * @return true if the heading was successfully updated, false otherwise
+                 */
+                bool SetNewHeading(const angle newHeadingDegrees) override;
+
+                /**
+                 * @brief Get the heading this missile is slewing to
+                 *
+                 * @return angle the desired heading
+                 */
+                angle GetDesiredHeading() const override;
+
+                /**
+                 * @brief Steer toward a point, ie. set the heading to the bearing of the point
+                 *
+                 * @param xCoord x coordinate of the point
+                 * @param yCoord y coordinate of the point
+                 */
+                void Guide(const coord xCoord, const coord yCoord);
+
+                /**
+                 * @brief Set the initial position of this Mover
+                 *
+                 * @param initialPosition this Mover's initial position
+                 * @return true if the initial position is valid
+                 * @return false if the initial position is not valid
+                 */
+                bool SetInitialInertialData(const InertialData initialInertialData) override;
+
+                /**
+                 * @brief Get the PositionalData for this Mover
+                 *
+                 * @return PositionalData The PositionalData of this Mover
+                 */
+                InertialData GetInertialData() const override;
+
+                /**
+                 * @brief Mark this Mover as destroyed.
+                 *
+                 */
+                void Destroy() override;
+
+                /**
+                 * @brief Get whether this Mover is destroyed or not
+                 *
+                 * @return true if this Mover is functioning
+                 * @return false if this mover is destroyed
+                 */
+                bool GetStatus() const override;
+
+                /**
+                 * @brief Get this Mover's team ID
+                 *
+                 * @return this Mover's team ID
+                 */
+                vector::sim::team_ID GetTeam() const override;
+
+                /**
+                 * @brief Get this Mover's performance characteristics
+                 *
+                 * @return MoverParams this Mover's performance characteristics
+                 */
+                MoverParams GetPerformanceValues() const override;
+
+                /**
+                 * @brief Get a string representation of this Mover
+                 *
+                 * @return std::string string representation of this Mover
+                 */
+                std::string ToString() const override;
+
+                /**
+                 * @brief Get the handle of the Mover this missile is guided toward
+                 *
+                 * @return MoverHandle the target's handle
+                 */
+                MoverHandle GetTarget() const;
+
+                /**
+                 * @brief Get the ticks of flight this missile has left
+                 *
+                 * @return uint32_t the remaining fuel, in ticks
+                 */
+                uint32_t GetFuelTicks() const;
+
+                /**
+                 * @brief Restore this missile to the state it was checkpointed in, nothing is range checked
+                 *
+                 * @param inertialData      the missile's inertial data
+                 * @param desiredHeading    the heading the missile was last guided to
+                 * @param fuelTicks         the ticks of flight the missile has left
+                 * @param status            true if the missile is functioning, false if destroyed
+                 */
+                void Restore(const InertialData inertialData, const angle desiredHeading, const uint32_t fuelTicks, const bool status);
+
+                MissileMover(const MissileMover&) = delete;
+                MissileMover& operator=(const MissileMover&) = delete;
+                MissileMover(MissileMover&&) = delete;
+                MissileMover& operator=(MissileMover&&) = delete;
+
+            private:
+                InertialData m_InertialData;
+                angle m_DesiredHeading;
+                MoverHandle m_TargetHandle;
+                uint32_t m_FuelTicks{MISSILE_FUEL_TICKS};
+                std::array<char, MISSILE_ID_SIZE> m_ID;
+                uint8_t m_IDLength{0};
+                bool m_Status{true};
+                vector::sim::team_ID m_TeamID{UNK_TEAM_ID};
+        };
+    }
+}
+
+#endif // MISSILE_MOVER_H
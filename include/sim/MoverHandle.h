@@ -0,0 +1,48 @@
+#ifndef MOVER_HANDLE_H
+#define MOVER_HANDLE_H
+
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        static const uint32_t INVALID_MOVER_INDEX = UINT32_MAX;
+
+        /**
+         * @brief Struct to compactly identify a Mover within a GameEngine.
+         *
+         * The index addresses the engine's Mover table directly. Indices are reused once
+         * a Mover is removed, so the generation distinguishes the current occupant from
+         * stale handles to earlier ones.
+         *
+         */
+        struct MoverHandle
+        {
+            uint32_t index{INVALID_MOVER_INDEX};
+            uint32_t generation{0};
+
+            /**
+             * @brief Determine whether this handle was ever assigned to a Mover
+             *
+             * @return true if the handle was assigned, false for a default constructed handle
+             */
+            bool IsValid() const
+            {
+                return index != INVALID_MOVER_INDEX;
+            }
+        }; // struct MoverHandle
+
+        inline bool operator==(const MoverHandle& lhs, const MoverHandle& rhs)
+        {
+            return lhs.index == rhs.index && lhs.generation == rhs.generation;
+        }
+
+        inline bool operator!=(const MoverHandle& lhs, const MoverHandle& rhs)
+        {
+            return !(lhs == rhs);
+        }
+    } // namespace sim
+} // namespace vector
+
+#endif // MOVER_HANDLE_H
@@ -2,6 +2,7 @@
 #define MOVER_INTERFACE_h
 
 #include "InertialData.h"
+#include "SimParams.h"
 
 #include "game/GameTypes.h"
 
@@ -39,6 +40,13 @@ namespace vector
                  */
                 virtual bool SetNewHeading(const angle newHeadingDegrees) = 0;
 
+                /**
+                 * @brief Get the heading this Mover is slewing to
+                 * 
+                 * @return angle the desired heading
+                 */
+                virtual angle GetDesiredHeading() const = 0;
+
                 /**
                  * @brief Set the initial position of this Mover
                  * 
@@ -76,6 +84,13 @@ namespace vector
                  */
                 virtual vector::sim::team_ID GetTeam() const = 0;
 
+                /**
+                 * @brief Get this Mover's performance characteristics
+                 * 
+                 * @return MoverParams this Mover's performance characteristics
+                 */
+                virtual MoverParams GetPerformanceValues() const = 0;
+
                 /**
                  * @brief Get a string representation of this Mover
                  * 
@@ -0,0 +1,182 @@
+#ifndef MOVER_STORE_H
+#define MOVER_STORE_H
+
+#include "sim/InertialData.h"
+#include "sim/SimParams.h"
+#include "sim/SimTypes.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        typedef uint32_t store_slot;
+
+        static const store_slot INVALID_STORE_SLOT = UINT32_MAX;
+
+        /**
+         * @brief Structure-of-arrays storage for fighters.
+         *
+         * Each field of every stored fighter lives in its own contiguous array so that
+         * a tick can advance all fighters in one linear pass. Fighters are addressed by a
+         * stable slot, which is mapped to a dense index that is kept packed on removal.
+         * The slots of removed fighters are reused, and a slot's generation tells its fighters apart.
+         *
+         */
+        class MoverStore
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 */
+                MoverStore() = default;
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~MoverStore() = default;
+
+                /**
+                 * @brief Add a fighter to the store
+                 *
+                 * @param ID                This fighter's unique ID
+                 * @param teamID            The ID of the team this fighter belongs to
+                 * @param performanceValues Performance characteristics of this fighter
+                 * @return store_slot the stable slot of the new fighter
+                 */
+                store_slot Add(const std::string& ID, const vector::sim::team_ID teamID, const MoverParams performanceValues);
+
+                /**
+                 * @brief Remove a fighter from the store
+                 *
+                 * @param slot the slot of the fighter to remove
+                 * @return true if the fighter was removed
+                 * @return false if the slot does not hold a fighter
+                 */
+                bool Remove(const store_slot slot);
+
+                /**
+                 * @brief Remove every fighter whose status is false (destroyed)
+                 *
+                 * @param removedSlots filled with the slots of the fighters that were removed, in dense order
+                 */
+                void RemoveDestroyed(std::vector<store_slot>& removedSlots);
+
+                /**
+                 * @brief Advance every functioning fighter by one tick in a single linear pass
+                 *
+                 */
+                void MoveAll();
+
+                /**
+                 * @brief Advance the functioning fighters in a contiguous range of dense indices by one tick.
+                 * Disjoint ranges touch disjoint memory and may be moved concurrently
+                 *
+                 * @param begin first dense index to move
+                 * @param count number of fighters to move
+                 */
+                void MoveRange(const size_t begin, const size_t count);
+
+                /**
+                 * @brief Advance a single fighter by one tick
+                 *
+                 * @param slot the slot of the fighter to move
+                 */
+                void Move(const store_slot slot);
+
+                /**
+                 * @brief Determine whether a slot currently holds a fighter
+                 *
+                 * @param slot the slot to check
+                 * @return true if the slot holds a fighter
+                 * @return false otherwise
+                 */
+                bool IsValid(const store_slot slot) const;
+
+                /**
+                 * @brief Get the generation of a slot, which changes each time a fighter is removed from it
+                 *
+                 * @param slot the slot
+                 * @return uint32_t the slot's generation, 0 for a slot never used
+                 */
+                uint32_t GetGeneration(const store_slot slot) const;
+
+                /**
+                 * @brief Get the number of fighters in the store
+                 *
+                 * @return size_t the number of fighters in the store
+                 */
+                size_t GetSize() const;
+
+                /**
+                 * @brief Get the slot of the fighter at a dense index
+                 *
+                 * @param index dense index in [0, GetSize())
+                 * @return store_slot the slot of the fighter at that index
+                 */
+                store_slot GetSlot(const size_t index) const;
+
+                /**
+                 * @brief Restore a fighter to the state it was checkpointed in. Unlike SetInitialInertialData nothing
+                 * is range checked, so a destroyed fighter can be restored where it left the arena
+                 *
+                 * @param slot              the slot of the fighter
+                 * @param inertialData      the fighter's inertial data
+                 * @param desiredHeading    the heading the fighter is slewing to
+                 * @param status            true if the fighter is functioning, false if destroyed
+                 * @return true if the fighter was restored
+                 * @return false if the slot does not hold a fighter
+                 */
+                bool RestoreState(const store_slot slot, const InertialData& inertialData, const angle desiredHeading, const bool status);
+
+                /**
+                 * @brief Per-fighter accessors, mirroring MoverInterface for the fighter in the given slot
+                 *
+                 */
+                std::string GetID(const store_slot slot) const;
+                std::string_view GetIDView(const store_slot slot) const;
+                bool SetNewHeading(const store_slot slot, const angle newHeadingDegrees);
+                angle GetDesiredHeading(const store_slot slot) const;
+                bool SetInitialInertialData(const store_slot slot, const InertialData initialInertialData);
+                InertialData GetInertialData(const store_slot slot) const;
+                void Destroy(const store_slot slot);
+                bool GetStatus(const store_slot slot) const;
+                vector::sim::team_ID GetTeam(const store_slot slot) const;
+                MoverParams GetPerformanceValues(const store_slot slot) const;
+
+                MoverStore(const MoverStore&) = delete;
+                MoverStore& operator=(const MoverStore&) = delete;
+                MoverStore(MoverStore&&) = delete;
+                MoverStore& operator=(MoverStore&&) = delete;
+
+            private:
+                InertialData LoadInertialData(const size_t index) const;
+                void StoreInertialData(const size_t index, const InertialData& inertialData);
+
+                std::vector<angle> m_Headings;
+                std::vector<speed> m_Speeds;
+                std::vector<coord> m_XCoords;
+                std::vector<coord> m_YCoords;
+                std::vector<angle> m_DesiredHeadings;
+                std::vector<uint8_t> m_Statuses;
+                std::vector<vector::sim::team_ID> m_Teams;
+
+                // cold data, only touched outside the tick loop
+                std::vector<std::string> m_IDs;
+                std::vector<MoverParams> m_PerformanceValues;
+
+                std::vector<store_slot> m_DenseToSlot;
+                std::vector<uint32_t> m_SlotToDense;
+                std::vector<uint32_t> m_SlotGenerations;
+                std::vector<store_slot> m_FreeSlots;
+        }; // class MoverStore
+    } // namespace sim
+} // namespace vector
+
+#endif // MOVER_STORE_H
@@ -0,0 +1,68 @@
+#ifndef MOVER_STORE_VIEW_H
+#define MOVER_STORE_VIEW_H
+
+#include "sim/MoverInterface.h"
+#include "sim/MoverStore.h"
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Thin MoverInterface over a fighter held in a MoverStore.
+         *
+         * Holds no state of its own; every call is forwarded to the store slot.
+         * Once the fighter is removed from the store the view reports a destroyed Mover, even after
+         * another fighter takes its slot.
+         *
+         */
+        class MoverStoreView : public MoverInterface
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param store the store holding the fighter, must outlive this view
+                 * @param slot  the fighter's slot in the store
+                 */
+                MoverStoreView(MoverStore& store, const store_slot slot);
+
+                /**
+                 * @brief Default Destructor
+                 *
+                 */
+                virtual ~MoverStoreView() = default;
+
+                std::string GetID() const override;
+                void Move() override;
+                bool SetNewHeading(const angle newHeadingDegrees) override;
+                angle GetDesiredHeading() const override;
+                bool SetInitialInertialData(const InertialData initialInertialData) override;
+                InertialData GetInertialData() const override;
+                void Destroy() override;
+                bool GetStatus() const override;
+                vector::sim::team_ID GetTeam() const override;
+                MoverParams GetPerformanceValues() const override;
+                std::string ToString() const override;
+
+                MoverStoreView(const MoverStoreView&) = delete;
+                MoverStoreView& operator=(const MoverStoreView&) = delete;
+                MoverStoreView(MoverStoreView&&) = delete;
+                MoverStoreView& operator=(MoverStoreView&&) = delete;
+
+            private:
+                /**
+                 * @brief Get the fighter's slot, INVALID_STORE_SLOT once it has been removed
+                 *
+                 * @return store_slot the slot
+                 */
+                store_slot GetSlot() const;
+
+                MoverStore& m_Store;
+                store_slot m_Slot;
+                uint32_t m_Generation;
+        }; // class MoverStoreView
+    } // namespace sim
+} // namespace vector
+
+#endif // MOVER_STORE_VIEW_H
@@ -0,0 +1,185 @@
+#ifndef RADAR_SYSTEM_H
+#define RADAR_SYSTEM_H
+
+#include "sim/InertialData.h"
+#include "sim/SimParams.h"
+#include "sim/SimTypes.h"
+#include "sim/SpatialGrid.h"
+#include "util/ThreadPool.h"
+
+#include <array>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Radar model for every Mover, swept once per tick.
+         *
+         * Each emitter sees enemies within its range and within a cone either side of its
+         * heading. A sweep runs one radius query on the spatial grid per emitter and a dot
+         * product cone test per candidate, so its cost grows with the number of Movers times
+         * the number within radar range of each, rather than with the square of the number of
+         * Movers. Detections are deduplicated into a flag per team and Mover as they are made,
+         * and a team's remaining emitters are skipped once it holds every enemy.
+         * Contacts are pooled per team; a contact's identification is kept for as long as the
+         * team holds the contact.
+         *
+         * Movers are referred to by their spatial grid ID, ie. their Mover table index.
+         *
+         */
+        class RadarSystem
+        {
+            public:
+                /**
+                 * @brief Struct to hold a team's contact
+                 *
+                 */
+                struct Contact
+                {
+                    uint32_t index;
+                    bool identified;
+                }; // struct Contact
+
+                /**
+                 * @brief Constructor
+                 *
+                 */
+                RadarSystem() = default;
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~RadarSystem() = default;
+
+                /**
+                 * @brief Forget the emitters of the last sweep
+                 *
+                 */
+                void ClearEmitters();
+
+                /**
+                 * @brief Add an emitter to the next sweep, Movers with no radar range are ignored
+                 *
+                 * @param index             the Mover's index
+                 * @param teamID            the Mover's team
+                 * @param inertialData      the Mover's position and heading
+                 * @param performanceValues the Mover's radar range and half angle
+                 */
+                void AddEmitter(const uint32_t index, const team_ID teamID, const InertialData& inertialData, const MoverParams& performanceValues);
+
+                /**
+                 * @brief Find every team's contacts
+                 *
+                 * @param grid          spatial index of every Mover
+                 * @param teamsByIndex  the team of every Mover, by index
+                 * @param poolPtr       pool to spread emitters across, nullptr to sweep serially
+                 */
+                void Sweep(const SpatialGrid& grid, const std::vector<team_ID>& teamsByIndex, vector::util::ThreadPool* poolPtr);
+
+                /**
+                 * @brief Get a team's contacts from the last sweep
+                 *
+                 * @param teamID the team
+                 * @return const std::vector<Contact>& the contacts, ordered by index
+                 */
+                const std::vector<Contact>& GetContacts(const team_ID teamID) const;
+
+                /**
+                 * @brief Determine whether a team held a Mover as a contact in the last sweep
+                 *
+                 * @param teamID    the team
+                 * @param index     the Mover's index
+                 * @return true if the Mover is one of the team's contacts
+                 */
+                bool IsContact(const team_ID teamID, const uint32_t index) const;
+
+                /**
+                 * @brief Mark one of a team's contacts as identified
+                 *
+                 * @param teamID    the team
+                 * @param index     the Mover's index
+                 * @return true if the Mover is one of the team's contacts
+                 * @return false otherwise, in which case nothing is identified
+                 */
+                bool Identify(const team_ID teamID, const uint32_t index);
+
+                /**
+                 * @brief Set a team's contacts, as checkpointed, in place of those of the last sweep. The next sweep
+                 * carries their identification over as it would from one of its own
+                 *
+                 * @param teamID    the team
+                 * @param contacts  the contacts, ordered by index
+                 */
+                void SetContacts(const team_ID teamID, const std::vector<Contact>& contacts);
+
+                /**
+                 * @brief Determine whether a point lies in a radar's cone. Range is not checked
+                 *
+                 * @param headingSine       sine of the radar's heading
+                 * @param headingCosine     cosine of the radar's heading
+                 * @param halfAngleCosine   cosine of the radar's half angle
+                 * @param xDelta            x offset of the point from the radar
+                 * @param yDelta            y offset of the point from the radar
+                 * @return true if the point is within the half angle either side of the heading
+                 */
+                static bool IsInCone(const double headingSine, const double headingCosine, const double halfAngleCosine,
+                                        const coord xDelta, const coord yDelta);
+
+                RadarSystem(const RadarSystem&) = delete;
+                RadarSystem& operator=(const RadarSystem&) = delete;
+                RadarSystem(RadarSystem&&) = delete;
+                RadarSystem& operator=(RadarSystem&&) = delete;
+
+            private:
+                /**
+                 * @brief Struct to hold what a sweep needs to know of an emitter
+                 *
+                 */
+                struct Emitter
+                {
+                    uint32_t index;
+                    team_ID teamID;
+                    coord xCoord;
+                    coord yCoord;
+                    coord range;
+                    double headingSine;
+                    double headingCosine;
+                    double halfAngleCosine;
+                }; // struct Emitter
+
+                /**
+                 * @brief Sweep a range of emitters
+                 *
+                 * @param begin         first emitter
+                 * @param end           one past the last emitter
+                 * @param grid          spatial index of every Mover
+                 * @param teamsByIndex  the team of every Mover, by index
+                 * @param detected      a row per team with a radar, of a flag per index, set for each Mover detected
+                 */
+                void SweepRange(const size_t begin, const size_t end, const SpatialGrid& grid, const std::vector<team_ID>& teamsByIndex,
+                                    std::vector<uint8_t>& detected) const;
+
+                // wider than team_ID, so that all 256 teams can have a row apart from it
+                static constexpr uint16_t NO_TEAM_ROW = UINT16_MAX;
+
+                std::vector<Emitter> m_Emitters;
+                // row of each team in the detection bitmaps, NO_TEAM_ROW for teams with no radar this sweep
+                std::array<uint16_t, UINT8_MAX + 1> m_TeamRows;
+                // enemies in the grid for the team with each row
+                std::vector<size_t> m_RowEnemies;
+                // per parallel task
+                std::vector<std::vector<uint8_t>> m_TaskDetections;
+                // indexed by team
+                std::vector<std::vector<Contact>> m_TeamContacts;
+                std::vector<Contact> m_PreviousContacts;
+                std::vector<Contact> m_NoContacts;
+        }; // class RadarSystem
+    } // namespace sim
+} // namespace vector
+
+#endif // RADAR_SYSTEM_H
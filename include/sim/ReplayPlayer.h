@@ -0,0 +1,253 @@
+#ifndef REPLAY_PLAYER_H
+#define REPLAY_PLAYER_H
+
+#include "sim/EngineCheckpoint.h"
+#include "sim/GameEngine.h"
+#include "sim/GameState.h"
+#include "sim/InertialData.h"
+#include "sim/MoverHandle.h"
+#include "sim/SimParams.h"
+#include "sim/SimTypes.h"
+#include "sim/TickCommand.h"
+#include "util/MappedFile.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Re-runs a match recorded by a ReplayRecorder.
+         *
+         * The log is memory mapped and indexed once on Open; tick records are then read in place as the
+         * match is stepped through, so a long log costs no more memory than its index. The match is rebuilt
+         * in a GameEngine of its own from the recorded fighters and re-run tick by tick with the recorded
+         * commands. Keyframes give the GameState at points of the match without running it, and each one
+         * reached while running is checked against the engine, counting any divergence. The engine checkpoint
+         * recorded with each keyframe lets the match be run to any point from the nearest one before it.
+         *
+         */
+        class ReplayPlayer
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 */
+                ReplayPlayer() = default;
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~ReplayPlayer() = default;
+
+                /**
+                 * @brief Map and index a log, and set up its match ready to run the first tick. A record cut short
+                 * at the end of the log ends it
+                 *
+                 * @param path the path of the log
+                 * @return true if the log was read and its match set up
+                 * @return false if the file could not be mapped, is not a log of this version, or its records are inconsistent
+                 */
+                bool Open(const std::string& path);
+
+                /**
+                 * @brief Get the number of ticks in the log
+                 *
+                 * @return uint64_t the number of ticks
+                 */
+                uint64_t GetNumTicks() const;
+
+                /**
+                 * @brief Get the number of ticks run so far
+                 *
+                 * @return uint64_t the number of ticks
+                 */
+                uint64_t GetTicksRun() const;
+
+                /**
+                 * @brief Run the next tick with the commands recorded for it
+                 *
+                 * @return true if a tick was run
+                 * @return false if the log has no more ticks, or nothing is open
+                 */
+                bool Step();
+
+                /**
+                 * @brief Run the match to the given number of ticks. The nearest checkpoint at or before them is restored
+                 * into a new engine when going back, or when it is ahead of the ticks run so far, and the match is run on
+                 * from there, so it costs at most a keyframe interval of ticks. Without such a checkpoint, going back sets
+                 * the match up again and re-runs it from the start
+                 *
+                 * @param ticks the number of ticks to have run
+                 * @return true if the match has run the given number of ticks
+                 * @return false if the log does not have that many ticks, or nothing is open
+                 */
+                bool RunTo(const uint64_t ticks);
+
+                /**
+                 * @brief Get the GameState as of the ticks run so far
+                 *
+                 * @return std::shared_ptr<const GameState> the GameState, nullptr if nothing is open
+                 */
+                std::shared_ptr<const GameState> GetGameState() const;
+
+                /**
+                 * @brief Get the last keyframe recorded at or before a number of ticks, without running the match
+                 *
+                 * @param ticks         the number of ticks
+                 * @param gameState     set to the keyframe's GameState
+                 * @param keyframeTicks set to the number of ticks the keyframe was recorded after
+                 * @return true if there is such a keyframe
+                 * @return false otherwise, leaving gameState and keyframeTicks alone
+                 */
+                bool GetKeyframe(const uint64_t ticks, GameState& gameState, uint64_t& keyframeTicks) const;
+
+                /**
+                 * @brief Get the number of keyframes in the log
+                 *
+                 * @return size_t the number of keyframes
+                 */
+                size_t GetNumKeyframes() const;
+
+                /**
+                 * @brief Get the number of engine checkpoints in the log
+                 *
+                 * @return size_t the number of checkpoints
+                 */
+                size_t GetNumCheckpoints() const;
+
+                /**
+                 * @brief Get the number of keyframes reached since the match was last set up, or a checkpoint restored, that did not match the engine's GameState
+                 *
+                 * @return uint64_t the number of divergences, 0 for a faithful replay
+                 */
+                uint64_t GetNumDivergences() const;
+
+                /**
+                 * @brief Get the engine the match is re-run in, to inspect it further. It is replaced when a checkpoint is
+                 * restored or the match is set up again
+                 *
+                 * @return GameEngine* the engine, nullptr if nothing is open
+                 */
+                GameEngine* GetGameEngine() const;
+
+                ReplayPlayer(const ReplayPlayer&) = delete;
+                ReplayPlayer& operator=(const ReplayPlayer&) = delete;
+                ReplayPlayer(ReplayPlayer&&) = delete;
+                ReplayPlayer& operator=(ReplayPlayer&&) = delete;
+
+            private:
+                struct FighterRecord
+                {
+                    MoverHandle handle;
+                    std::string ID;
+                    team_ID teamID{0};
+                    MoverParams performanceValues;
+                    InertialData initialData;
+                    angle desiredHeading{0};
+                }; // struct FighterRecord
+
+                // where a record's payload lies in the log
+                struct RecordSpan
+                {
+                    size_t offset{0};
+                    size_t size{0};
+                }; // struct RecordSpan
+
+                struct KeyframeSpan
+                {
+                    uint64_t ticks{0};
+                    RecordSpan span;
+                }; // struct KeyframeSpan
+
+                /**
+                 * @brief Read a FIGHTER payload
+                 *
+                 * @param span  where the payload lies
+                 * @return true if the payload was whole
+                 */
+                bool ReadFighter(const RecordSpan span);
+
+                /**
+                 * @brief Read a TICK payload into m_TickCommands
+                 *
+                 * @param span  where the payload lies
+                 * @return true if the payload was whole
+                 */
+                bool ReadTick(const RecordSpan span);
+
+                /**
+                 * @brief Decode a KEYFRAME payload
+                 *
+                 * @param span      where the payload lies
+                 * @param gameState set to the keyframe's GameState
+                 * @return true if the keyframe was decoded
+                 */
+                bool ReadKeyframe(const RecordSpan span, GameState& gameState) const;
+
+                /**
+                 * @brief Decode a CHECKPOINT payload
+                 *
+                 * @param span          where the payload lies
+                 * @param checkpoint    set to the checkpoint
+                 * @return true if the payload was whole
+                 */
+                bool ReadCheckpoint(const RecordSpan span, EngineCheckpoint& checkpoint) const;
+
+                /**
+                 * @brief Set the match up in a new engine, ready to run the first tick
+                 *
+                 * @return true if every fighter took the handle it was recorded with
+                 */
+                bool Restart();
+
+                /**
+                 * @brief Restore a checkpoint into a new engine, ready to run the tick after it
+                 *
+                 * @param checkpoint the checkpoint's ticks and where it lies
+                 * @return true if the checkpoint was restored
+                 * @return false if it could not be decoded or restored, in which case the engine is left as it was
+                 */
+                bool RestoreCheckpoint(const KeyframeSpan& checkpoint);
+
+                /**
+                 * @brief Check the keyframe recorded after the ticks run so far, if there is one, against the engine
+                 *
+                 */
+                void CheckKeyframe();
+
+                /**
+                 * @brief Drop everything read from the log
+                 *
+                 */
+                void Reset();
+
+                vector::util::MappedFile m_File;
+                std::vector<FighterRecord> m_Fighters;
+                std::vector<RecordSpan> m_Ticks;
+                // in order of ticks
+                std::vector<KeyframeSpan> m_Keyframes;
+                // in order of ticks
+                std::vector<KeyframeSpan> m_Checkpoints;
+
+                std::unique_ptr<GameEngine> m_GameEnginePtr{nullptr};
+                uint64_t m_TicksRun{0};
+                size_t m_NextKeyframe{0};
+                uint64_t m_NumDivergences{0};
+
+                // reused from tick to tick
+                std::vector<TickCommand> m_TickCommands;
+                GameState m_Keyframe;
+                EngineCheckpoint m_Checkpoint;
+        }; // class ReplayPlayer
+    } // namespace sim
+} // namespace vector
+
+#endif // REPLAY_PLAYER_H
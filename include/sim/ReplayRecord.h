@@ -0,0 +1,39 @@
+#ifndef REPLAY_RECORD_H
+#define REPLAY_RECORD_H
+
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Enum to denote what a record in a replay log holds
+         *
+         */
+        enum class REPLAY_RECORD_TYPE : uint8_t
+        {
+            // a fighter added before the first tick, in the order they were added
+            FIGHTER = 1,
+            // the commands applied at the start of a tick, one record for every tick run
+            TICK = 2,
+            // the GameState after a number of ticks
+            KEYFRAME = 3,
+            // the engine's whole state after a number of ticks, recorded with a keyframe
+            CHECKPOINT = 4
+        };
+
+        /**
+         * @brief Enum to denote which payload a recorded command carries
+         *
+         */
+        enum class REPLAY_PAYLOAD_KIND : uint8_t
+        {
+            NONE = 0,
+            HEADING = 1,
+            TARGET = 2
+        };
+    } // namespace sim
+} // namespace vector
+
+#endif // REPLAY_RECORD_H
@@ -0,0 +1,190 @@
+#ifndef REPLAY_RECORDER_H
+#define REPLAY_RECORDER_H
+
+#include "sim/EngineCheckpoint.h"
+#include "sim/GameState.h"
+#include "sim/GameStateBinaryEncoder.h"
+#include "sim/InertialData.h"
+#include "sim/MoverHandle.h"
+#include "sim/ReplayRecord.h"
+#include "sim/SimParams.h"
+#include "sim/SimTypes.h"
+#include "sim/TickCommand.h"
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Records a match to an append-only binary log that a ReplayPlayer can re-run exactly.
+         *
+         * A GameEngine ticks deterministically from its setup and the commands it applies, so the log holds
+         * the fighters the match started with, then one record per tick of the commands that tick drained,
+         * with a GameState keyframe and an engine checkpoint every few ticks. A player restores the checkpoint
+         * nearest a point of the match rather than re-running it from the start. The log is a header then a
+         * stream of records:
+         *
+         *      u32 magic, u16 version, u16 reserved
+         *      records of u8 type, u32 payload length, payload
+         *
+         *      FIGHTER    u32 handle index, u32 generation, u8 team, u16 ID length, the ID,
+         *                 f64 max speed, u16 turn rate, f64 radar range, u16 radar half angle, u32 missiles,
+         *                 u16 heading, f64 speed, f64 x, f64 y, u16 desired heading
+         *      TICK       u64 ticks run before it, u32 number of commands, then for each:
+         *                 u32 subject index, u32 subject generation, u8 command type, u16 subject length, the subject,
+         *                 u8 payload kind (0 none, 1 heading, 2 target), then u16 heading or u16 length and the callsign
+         *      KEYFRAME   u64 ticks run, then a self-contained GameStateBinaryEncoder message
+         *      CHECKPOINT u64 ticks run, u64 missiles launched, u32 number of entries, then for each:
+         *                 u8 type (0 free, 1 fighter, 2 missile), u32 generation, u8 team, and for fighters and missiles
+         *                 u16 ID length, the ID, u16 heading, f64 speed, f64 x, f64 y, u16 desired heading, u8 status,
+         *                 u8 spatially indexed, then for fighters f64 max speed, u16 turn rate, f64 radar range,
+         *                 u16 radar half angle, u32 missiles, u32 locked target index, u32 locked target generation,
+         *                 u32 missiles remaining, or for missiles u32 target index, u32 target generation, u32 fuel ticks;
+         *                 then the free entries, the fighters in store order and the missiles in launch order, each as
+         *                 u32 count and u32 entry indices; then u16 number of teams, and for each u32 number of contacts,
+         *                 then u32 index and u8 identified for each
+         *
+         * Every field is little-endian. Records are built in a buffer and written in large blocks, so recording
+         * a tick costs no allocation and, most ticks, no system call. A reader can follow the log as it grows,
+         * and a record cut short by a crash is simply the end of the log.
+         *
+         */
+        class ReplayRecorder
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param keyframeInterval a keyframe is due every keyframeInterval ticks (minimum 1)
+                 */
+                explicit ReplayRecorder(const uint64_t keyframeInterval);
+
+                /**
+                 * @brief Destructor, closes the log
+                 *
+                 */
+                virtual ~ReplayRecorder();
+
+                /**
+                 * @brief Create the log, replacing any file at the path, and write its header
+                 *
+                 * @param path the path of the log
+                 * @return true if the log was created
+                 * @return false if the file could not be created, or a log is already open
+                 */
+                bool Open(const std::string& path);
+
+                /**
+                 * @brief Record a fighter the match starts with. Fighters must be recorded in the order they were
+                 * added to the GameEngine, before the first tick
+                 *
+                 * @param handle            the fighter's handle
+                 * @param ID                the fighter's ID
+                 * @param teamID            the fighter's team
+                 * @param performanceValues the fighter's performance values
+                 * @param initialData       the fighter's inertial data before the first tick
+                 * @param desiredHeading    the heading the fighter is slewing to, which a command before the first tick may have set
+                 */
+                void RecordFighter(const MoverHandle handle, const std::string& ID, const team_ID teamID,
+                                    const MoverParams& performanceValues, const InertialData& initialData, const angle desiredHeading);
+
+                /**
+                 * @brief Record the commands a tick drained
+                 *
+                 * @param drainedCommands the commands, in the order they were applied
+                 */
+                void RecordTick(const std::vector<TickCommand>& drainedCommands);
+
+                /**
+                 * @brief Determine whether a keyframe is due, ie. the number of ticks recorded is a multiple of the interval
+                 * and no keyframe has been recorded since
+                 *
+                 * @return true if a keyframe should be recorded now
+                 */
+                bool IsKeyframeDue() const;
+
+                /**
+                 * @brief Record the GameState as of the ticks recorded so far
+                 *
+                 * @param gameState the GameState
+                 */
+                void RecordKeyframe(const GameState& gameState);
+
+                /**
+                 * @brief Record the engine's checkpoint as of the ticks recorded so far, alongside the keyframe
+                 *
+                 * @param checkpoint the checkpoint
+                 */
+                void RecordCheckpoint(const EngineCheckpoint& checkpoint);
+
+                /**
+                 * @brief Write out every record so far
+                 *
+                 * @return true if everything recorded has been written
+                 * @return false if a write failed, after which nothing more is recorded
+                 */
+                bool Flush();
+
+                /**
+                 * @brief Flush and close the log
+                 *
+                 * @return true if everything recorded has been written
+                 */
+                bool Close();
+
+                /**
+                 * @brief Get the number of ticks recorded
+                 *
+                 * @return uint64_t the number of ticks
+                 */
+                uint64_t GetNumTicks() const;
+
+                /**
+                 * @brief Get the number of bytes recorded, written or not
+                 *
+                 * @return uint64_t the size of the log once flushed
+                 */
+                uint64_t GetNumBytes() const;
+
+                ReplayRecorder(const ReplayRecorder&) = delete;
+                ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+                ReplayRecorder(ReplayRecorder&&) = delete;
+                ReplayRecorder& operator=(ReplayRecorder&&) = delete;
+
+            private:
+                /**
+                 * @brief Make room for a record at the end of the buffer, writing the buffer out first if it is full
+                 *
+                 * @param type          the type of the record
+                 * @param payloadSize   the most bytes the payload can take
+                 * @return uint8_t* where to write the payload, nullptr if the log has failed or is not open
+                 */
+                uint8_t* BeginRecord(const REPLAY_RECORD_TYPE type, const size_t payloadSize);
+
+                /**
+                 * @brief Finish the record begun last, fixing its payload length
+                 *
+                 * @param payloadSize the bytes the payload took
+                 */
+                void EndRecord(const size_t payloadSize);
+
+                uint64_t m_KeyframeInterval;
+                int m_FileDescriptor{-1};
+                bool m_Failed{false};
+                uint64_t m_NumTicks{0};
+                uint64_t m_LastKeyframeTicks{UINT64_MAX};
+                uint64_t m_NumBytes{0};
+                std::vector<uint8_t> m_Buffer;
+                size_t m_BufferSize{0};
+                size_t m_RecordStart{0};
+                GameStateBinaryEncoder m_KeyframeEncoder{false};
+        }; // class ReplayRecorder
+    } // namespace sim
+} // namespace vector
+
+#endif // REPLAY_RECORDER_H
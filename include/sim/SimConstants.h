@@ -3,6 +3,7 @@
 
 #include "SimTypes.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace vector
@@ -22,6 +23,55 @@ namespace vector
         static const coord Y_COORD_MAX = 375500.0;
 
         static const uint8_t UNK_TEAM_ID = 0;
+
+        static const size_t MAX_TICK_THREADS = 64;
+
+        // commands queued between two Ticks, beyond which QueueCommand rejects them
+        static const size_t COMMAND_QUEUE_CAPACITY = 4096;
+
+        // engine events held for subscribers that fall behind, beyond which they miss the oldest
+        static const size_t ENGINE_EVENT_CAPACITY = 8192;
+
+        // side of a spatial index cell, sized so a cell is crossed in a few ticks at top speed
+        static const coord SPATIAL_GRID_CELL_SIZE = 5000.0;
+
+        // Movers whose paths pass within this distance of each other in a tick collide, and are both destroyed
+        static const coord COLLISION_RADIUS = 50.0;
+        // side of a collision grid cell, about as wide as the search around a fighter for others it could have hit in a tick
+        static const coord COLLISION_GRID_CELL_SIZE = 2000.0;
+
+        // enemies this close to one of a team's Movers are in the team's view whether or not its radars hold them
+        static const coord DEFAULT_VIEW_RANGE = 10000.0;
+
+        // binary GameState wire format, see GameStateBinaryEncoder
+        static const uint16_t GAME_STATE_CODEC_MAGIC = 0x5347;
+        static const uint8_t GAME_STATE_CODEC_VERSION = 1;
+        static const uint8_t GAME_STATE_CODEC_FLAG_QUANTIZED = 1 << 0;
+        static const uint8_t GAME_STATE_CODEC_FLAG_RESET_IDS = 1 << 1;
+        // bytes taken by the header and the two counts, by each ID before its string, and by each Mover
+        static const size_t GAME_STATE_CODEC_HEADER_SIZE = 12;
+        static const size_t GAME_STATE_CODEC_ID_SIZE = 10;
+        static const size_t GAME_STATE_CODEC_MOVER_SIZE = 35;
+        static const size_t GAME_STATE_CODEC_QUANTIZED_MOVER_SIZE = 21;
+        // quantized coordinates are sent in steps of this many metres, and speeds in steps of this many metres per second
+        static const coord GAME_STATE_COORD_QUANTUM = 0.01;
+        static const speed GAME_STATE_SPEED_QUANTUM = 0.1;
+
+        // replay log format, see ReplayRecorder
+        static const uint32_t REPLAY_MAGIC = 0x4C505256;
+        static const uint16_t REPLAY_VERSION = 3;
+        // bytes taken by the file header, and by the type and payload length of each record
+        static const size_t REPLAY_HEADER_SIZE = 8;
+        static const size_t REPLAY_RECORD_HEADER_SIZE = 5;
+        // a GameState keyframe and engine checkpoint are recorded every this many ticks
+        static const uint64_t REPLAY_KEYFRAME_INTERVAL = 100;
+        // records are gathered into writes of about this many bytes
+        static const size_t REPLAY_WRITE_BUFFER_SIZE = 64 * 1024;
+
+        // missiles in flight at once across all teams, LAUNCH is rejected beyond this
+        static const size_t MISSILE_POOL_CAPACITY = 1024;
+        // most characters in a missile's ID, which is held in place rather than on the heap
+        static const size_t MISSILE_ID_SIZE = 32;
         
     } // namespace sim
 }  // namespace vector
@@ -12,11 +12,27 @@ namespace vector
         static const speed FIGHTER_SPEED_MAX = 838;
         static const angle FIGHTER_TURN_RATE = 10;
         static const speed FIGHTER_ACCL_DCCL = 5;
+        static const coord FIGHTER_RADAR_RANGE = 80000.0;
+        // the radar sees this many degrees either side of the current heading
+        static const angle FIGHTER_RADAR_HALF_ANGLE = 60;
+        static const uint32_t FIGHTER_NUM_MISSILES = 4;
+
+        static const speed MISSILE_SPEED_MAX = 2500;
+        static const angle MISSILE_TURN_RATE = 20;
+        static const speed MISSILE_ACCL = 250;
+        // ticks of flight before the motor burns out and the missile is lost
+        static const uint32_t MISSILE_FUEL_TICKS = 60;
+        // a missile detonates on passing this close to its target
+        static const coord MISSILE_PROXIMITY_RADIUS = 500.0;
 
         struct MoverParams
         {
             speed maxSpeed{SPEED_MAX};
             angle turnRate{DEFAULT_TURN_RATE};
+            // a range of 0 fits no radar
+            coord radarRange{FIGHTER_RADAR_RANGE};
+            angle radarHalfAngle{FIGHTER_RADAR_HALF_ANGLE};
+            uint32_t numMissiles{FIGHTER_NUM_MISSILES};
         };
     } // namespace sim
 } // namespace vector
@@ -0,0 +1,177 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "sim/SimTypes.h"
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Uniform grid spatial index over the arena.
+         *
+         * The arena is split into square cells, each holding the IDs and positions of the
+         * items inside it. An item that stays in its cell is updated in place; one that
+         * crosses into another cell is swap-removed from the old cell and appended to the
+         * new, so updating every item each tick is a linear pass. Items outside the arena
+         * are kept in the nearest border cell. IDs are small dense integers, such as
+         * MoverHandle indices.
+         *
+         */
+        class SpatialGrid
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param cellSize width and height of each cell
+                 */
+                explicit SpatialGrid(const coord cellSize);
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~SpatialGrid() = default;
+
+                /**
+                 * @brief Set the position of an item, adding it if it is not yet indexed
+                 *
+                 * @param ID    the item's ID
+                 * @param xCoord the item's x coordinate
+                 * @param yCoord the item's y coordinate
+                 */
+                void Update(const uint32_t ID, const coord xCoord, const coord yCoord);
+
+                /**
+                 * @brief Remove an item
+                 *
+                 * @param ID the item's ID
+                 * @return true if the item was removed
+                 * @return false if the item was not indexed
+                 */
+                bool Remove(const uint32_t ID);
+
+                /**
+                 * @brief Remove all items
+                 *
+                 */
+                void Clear();
+
+                bool Contains(const uint32_t ID) const;
+                size_t GetSize() const;
+
+                /**
+                 * @brief Find every item within a radius of a point
+                 *
+                 * @param xCoord    x coordinate of the point
+                 * @param yCoord    y coordinate of the point
+                 * @param radius    the radius, items exactly at it are included
+                 * @param results   the IDs found are appended, in no particular order
+                 */
+                void QueryRadius(const coord xCoord, const coord yCoord, const coord radius, std::vector<uint32_t>& results) const;
+
+                /**
+                 * @brief Visit every item within a radius of a point, without collecting them
+                 *
+                 * @param xCoord    x coordinate of the point
+                 * @param yCoord    y coordinate of the point
+                 * @param radius    the radius, items exactly at it are included
+                 * @param visitor   called with the ID, x offset and y offset from the point of each item found
+                 */
+                template <typename Visitor>
+                void VisitRadius(const coord xCoord, const coord yCoord, const coord radius, Visitor&& visitor) const
+                {
+                    if(radius < 0.0)
+                    {
+                        return;
+                    }
+
+                    const size_t minColumn = GetCellColumn(xCoord - radius);
+                    const size_t maxColumn = GetCellColumn(xCoord + radius);
+                    const size_t minRow = GetCellRow(yCoord - radius);
+                    const size_t maxRow = GetCellRow(yCoord + radius);
+                    const coord radiusSquared = radius * radius;
+
+                    for(size_t row = minRow; row <= maxRow; ++row)
+                    {
+                        for(size_t column = minColumn; column <= maxColumn; ++column)
+                        {
+                            for(const CellItem& item : m_Cells[row * m_NumColumns + column])
+                            {
+                                const coord xDelta = item.xCoord - xCoord;
+                                const coord yDelta = item.yCoord - yCoord;
+                                if(xDelta * xDelta + yDelta * yDelta <= radiusSquared)
+                                {
+                                    visitor(item.ID, xDelta, yDelta);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Find the items nearest a point
+                 *
+                 * @param xCoord    x coordinate of the point
+                 * @param yCoord    y coordinate of the point
+                 * @param count     the most items to find
+                 * @param results   the IDs found are appended, nearest first
+                 */
+                void QueryNearest(const coord xCoord, const coord yCoord, const size_t count, std::vector<uint32_t>& results) const;
+
+                SpatialGrid(const SpatialGrid&) = delete;
+                SpatialGrid& operator=(const SpatialGrid&) = delete;
+                SpatialGrid(SpatialGrid&&) = delete;
+                SpatialGrid& operator=(SpatialGrid&&) = delete;
+
+            private:
+                /**
+                 * @brief Struct to hold an item, positions are kept in the cell so queries read one array per cell
+                 *
+                 */
+                struct CellItem
+                {
+                    uint32_t ID;
+                    coord xCoord;
+                    coord yCoord;
+                }; // struct CellItem
+
+                /**
+                 * @brief Struct to hold where an item is indexed
+                 *
+                 */
+                struct ItemLocation
+                {
+                    uint32_t cell;
+                    uint32_t indexInCell;
+                }; // struct ItemLocation
+
+                static const uint32_t NOT_INDEXED = UINT32_MAX;
+
+                size_t GetCellColumn(const coord xCoord) const;
+                size_t GetCellRow(const coord yCoord) const;
+
+                /**
+                 * @brief Remove the item at a position in a cell, keeping the cell packed
+                 *
+                 * @param cell          index of the cell
+                 * @param indexInCell   position of the item in the cell
+                 */
+                void EraseFromCell(const uint32_t cell, const uint32_t indexInCell);
+
+                coord m_CellSize;
+                size_t m_NumColumns;
+                size_t m_NumRows;
+                std::vector<std::vector<CellItem>> m_Cells;
+                std::vector<ItemLocation> m_Locations;
+                size_t m_Size{0};
+        }; // class SpatialGrid
+    } // namespace sim
+} // namespace vector
+
+#endif // SPATIAL_GRID_H
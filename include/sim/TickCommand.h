@@ -0,0 +1,23 @@
+#ifndef TICK_COMMAND_H
+#define TICK_COMMAND_H
+
+#include "sim/MoverHandle.h"
+#include "util/Command.h"
+
+namespace vector
+{
+    namespace sim
+    {
+        /**
+         * @brief Struct to store a command a GameEngine drained from its queue and applied at the start of a Tick
+         *
+         */
+        struct TickCommand
+        {
+            MoverHandle subjectHandle;
+            vector::util::Command cmd;
+        }; // struct TickCommand
+    } // namespace sim
+} // namespace vector
+
+#endif // TICK_COMMAND_H
@@ -0,0 +1,181 @@
+#ifndef BINARY_READER_H
+#define BINARY_READER_H
+
+#include <string>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Reads fixed-width little-endian fields out of a buffer written by a BinaryWriter.
+         *
+         * Every read is bounds checked. Reading past the end of the buffer reads zero and marks the
+         * reader as failed, so untrusted input can be read straight through with one check at the end.
+         *
+         */
+        class BinaryReader
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param buffer    the buffer to read from
+                 * @param size      the number of bytes in the buffer
+                 */
+                BinaryReader(const uint8_t* buffer, const size_t size)
+                    : m_Buffer(buffer)
+                    , m_Size(size)
+                {
+                }
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~BinaryReader() = default;
+
+                /**
+                 * @brief Read an unsigned 8 bit integer
+                 *
+                 * @return uint8_t the value
+                 */
+                uint8_t ReadU8()
+                {
+                    return static_cast<uint8_t>(ReadLittleEndian(1));
+                }
+
+                /**
+                 * @brief Read an unsigned 16 bit integer
+                 *
+                 * @return uint16_t the value
+                 */
+                uint16_t ReadU16()
+                {
+                    return static_cast<uint16_t>(ReadLittleEndian(2));
+                }
+
+                /**
+                 * @brief Read an unsigned 32 bit integer
+                 *
+                 * @return uint32_t the value
+                 */
+                uint32_t ReadU32()
+                {
+                    return static_cast<uint32_t>(ReadLittleEndian(4));
+                }
+
+                /**
+                 * @brief Read an unsigned 64 bit integer
+                 *
+                 * @return uint64_t the value
+                 */
+                uint64_t ReadU64()
+                {
+                    return ReadLittleEndian(8);
+                }
+
+                /**
+                 * @brief Read a signed 32 bit integer
+                 *
+                 * @return int32_t the value
+                 */
+                int32_t ReadI32()
+                {
+                    return static_cast<int32_t>(static_cast<uint32_t>(ReadLittleEndian(4)));
+                }
+
+                /**
+                 * @brief Read a double from its IEEE 754 bit pattern
+                 *
+                 * @return double the value
+                 */
+                double ReadF64()
+                {
+                    const uint64_t bits = ReadLittleEndian(8);
+                    double value;
+                    memcpy(&value, &bits, sizeof(value));
+                    return value;
+                }
+
+                /**
+                 * @brief Read raw bytes into a string, reusing its capacity
+                 *
+                 * @param numBytes  the number of bytes
+                 * @param value     assigned the bytes, or cleared if there are not enough left
+                 */
+                void ReadString(const size_t numBytes, std::string& value)
+                {
+                    if(!Take(numBytes))
+                    {
+                        value.clear();
+                        return;
+                    }
+                    value.assign(reinterpret_cast<const char*>(m_Buffer + m_Position - numBytes), numBytes);
+                }
+
+                /**
+                 * @brief Get the number of bytes left to read
+                 *
+                 * @return size_t the number of bytes left
+                 */
+                size_t GetRemaining() const
+                {
+                    return m_Size - m_Position;
+                }
+
+                /**
+                 * @brief Determine whether a read ran past the end of the buffer
+                 *
+                 * @return true if any read failed
+                 */
+                bool HasFailed() const
+                {
+                    return m_Failed;
+                }
+
+                BinaryReader(const BinaryReader&) = delete;
+                BinaryReader& operator=(const BinaryReader&) = delete;
+                BinaryReader(BinaryReader&&) = delete;
+                BinaryReader& operator=(BinaryReader&&) = delete;
+
+            private:
+                bool Take(const size_t numBytes)
+                {
+                    if(m_Failed || m_Size - m_Position < numBytes)
+                    {
+                        m_Failed = true;
+                        return false;
+                    }
+                    m_Position += numBytes;
+                    return true;
+                }
+
+                uint64_t ReadLittleEndian(const size_t numBytes)
+                {
+                    if(!Take(numBytes))
+                    {
+                        return 0;
+                    }
+
+                    uint64_t value = 0;
+                    const uint8_t* bytes = m_Buffer + m_Position - numBytes;
+                    for(size_t i = 0; i < numBytes; ++i)
+                    {
+                        value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+                    }
+                    return value;
+                }
+
+                const uint8_t* m_Buffer;
+                size_t m_Size;
+                size_t m_Position{0};
+                bool m_Failed{false};
+        }; // class BinaryReader
+    } // namespace util
+} // namespace vector
+
+#endif // BINARY_READER_H
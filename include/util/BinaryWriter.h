@@ -0,0 +1,175 @@
+#ifndef BINARY_WRITER_H
+#define BINARY_WRITER_H
+
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Writes fixed-width little-endian fields into a caller's buffer.
+         *
+         * Bytes are assembled by shifting rather than copied from memory, so the output is the same on
+         * any host. Writing past the end of the buffer writes nothing and marks the writer as overflowed,
+         * so a run of writes needs only one check at the end.
+         *
+         */
+        class BinaryWriter
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param buffer    the buffer to write into
+                 * @param capacity  the size of the buffer in bytes
+                 */
+                BinaryWriter(uint8_t* buffer, const size_t capacity)
+                    : m_Buffer(buffer)
+                    , m_Capacity(capacity)
+                {
+                }
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~BinaryWriter() = default;
+
+                /**
+                 * @brief Write an unsigned 8 bit integer
+                 *
+                 * @param value the value
+                 */
+                void WriteU8(const uint8_t value)
+                {
+                    WriteLittleEndian(value, 1);
+                }
+
+                /**
+                 * @brief Write an unsigned 16 bit integer
+                 *
+                 * @param value the value
+                 */
+                void WriteU16(const uint16_t value)
+                {
+                    WriteLittleEndian(value, 2);
+                }
+
+                /**
+                 * @brief Write an unsigned 32 bit integer
+                 *
+                 * @param value the value
+                 */
+                void WriteU32(const uint32_t value)
+                {
+                    WriteLittleEndian(value, 4);
+                }
+
+                /**
+                 * @brief Write an unsigned 64 bit integer
+                 *
+                 * @param value the value
+                 */
+                void WriteU64(const uint64_t value)
+                {
+                    WriteLittleEndian(value, 8);
+                }
+
+                /**
+                 * @brief Write a signed 32 bit integer
+                 *
+                 * @param value the value
+                 */
+                void WriteI32(const int32_t value)
+                {
+                    WriteLittleEndian(static_cast<uint32_t>(value), 4);
+                }
+
+                /**
+                 * @brief Write a double as its IEEE 754 bit pattern
+                 *
+                 * @param value the value
+                 */
+                void WriteF64(const double value)
+                {
+                    uint64_t bits;
+                    memcpy(&bits, &value, sizeof(bits));
+                    WriteLittleEndian(bits, 8);
+                }
+
+                /**
+                 * @brief Write raw bytes
+                 *
+                 * @param bytes     the bytes
+                 * @param numBytes  the number of bytes
+                 */
+                void WriteBytes(const void* bytes, const size_t numBytes)
+                {
+                    if(!Reserve(numBytes))
+                    {
+                        return;
+                    }
+                    memcpy(m_Buffer + m_Size, bytes, numBytes);
+                    m_Size += numBytes;
+                }
+
+                /**
+                 * @brief Get the number of bytes written
+                 *
+                 * @return size_t the number of bytes written, which stops growing once the writer overflows
+                 */
+                size_t GetSize() const
+                {
+                    return m_Size;
+                }
+
+                /**
+                 * @brief Determine whether a write did not fit in the buffer
+                 *
+                 * @return true if any write was dropped
+                 */
+                bool HasOverflowed() const
+                {
+                    return m_Overflowed;
+                }
+
+                BinaryWriter(const BinaryWriter&) = delete;
+                BinaryWriter& operator=(const BinaryWriter&) = delete;
+                BinaryWriter(BinaryWriter&&) = delete;
+                BinaryWriter& operator=(BinaryWriter&&) = delete;
+
+            private:
+                bool Reserve(const size_t numBytes)
+                {
+                    if(m_Overflowed || m_Capacity - m_Size < numBytes)
+                    {
+                        m_Overflowed = true;
+                        return false;
+                    }
+                    return true;
+                }
+
+                void WriteLittleEndian(const uint64_t value, const size_t numBytes)
+                {
+                    if(!Reserve(numBytes))
+                    {
+                        return;
+                    }
+                    for(size_t i = 0; i < numBytes; ++i)
+                    {
+                        m_Buffer[m_Size++] = static_cast<uint8_t>(value >> (8 * i));
+                    }
+                }
+
+                uint8_t* m_Buffer;
+                size_t m_Capacity;
+                size_t m_Size{0};
+                bool m_Overflowed{false};
+        }; // class BinaryWriter
+    } // namespace util
+} // namespace vector
+
+#endif // BINARY_WRITER_H
@@ -0,0 +1,207 @@
+#ifndef BROADCAST_RING_BUFFER_H
+#define BROADCAST_RING_BUFFER_H
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Bounded lock-free single-producer, multi-consumer broadcast ring.
+         *
+         * Every consumer sees every item, reading at its own pace through a Cursor it owns, so the
+         * ring keeps no record of its consumers and publishing never waits on them. Publishing copies
+         * the item into a preallocated slot and never allocates. Each slot carries the sequence number
+         * of the item it holds, written around the item like a seqlock, so a consumer that has fallen
+         * more than a lap behind finds its items overwritten, skips ahead to the oldest item still held
+         * and counts what it missed. Only one thread may Publish; any number of threads may TryRead,
+         * each with its own Cursor.
+         *
+         */
+        template <typename T>
+        class BroadcastRingBuffer
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "items are copied while the producer may be overwriting them");
+
+            public:
+                /**
+                 * @brief Struct to hold a consumer's place in the ring
+                 *
+                 */
+                struct Cursor
+                {
+                    // sequence number of the next item to read
+                    uint64_t position{0};
+                    // items overwritten before they were read
+                    uint64_t numMissed{0};
+                }; // struct Cursor
+
+                /**
+                 * @brief Constructor
+                 *
+                 * @param capacity the number of slots, rounded up to a power of two (minimum 2). One slot is
+                 *                 kept for the item being published, the rest hold items for lagging consumers
+                 */
+                explicit BroadcastRingBuffer(const size_t capacity)
+                {
+                    size_t roundedCapacity = 2;
+                    while(roundedCapacity < capacity)
+                    {
+                        roundedCapacity <<= 1;
+                    }
+
+                    m_Mask = roundedCapacity - 1;
+                    m_Slots = std::make_unique<Slot[]>(roundedCapacity);
+                }
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~BroadcastRingBuffer() = default;
+
+                /**
+                 * @brief Add an item to the ring, overwriting the oldest once the ring is full. Only one thread may publish
+                 *
+                 * @param item the item
+                 */
+                void Publish(const T& item)
+                {
+                    const uint64_t position = m_Tail.load(std::memory_order_relaxed);
+                    Slot& slot = m_Slots[position & m_Mask];
+
+                    // consumers that catch the slot mid-write see a sequence that is not theirs
+                    slot.sequence.store(WRITING, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_release);
+                    slot.item = item;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+
+                    m_Tail.store(position + 1, std::memory_order_release);
+                }
+
+                /**
+                 * @brief Get a cursor that reads the items published from now on
+                 *
+                 * @return Cursor the cursor
+                 */
+                Cursor Subscribe() const
+                {
+                    Cursor cursor;
+                    cursor.position = m_Tail.load(std::memory_order_acquire);
+
+                    return cursor;
+                }
+
+                /**
+                 * @brief Read the next item at a cursor. Safe to call from any number of threads with different cursors
+                 *
+                 * @param cursor the consumer's cursor, advanced past the item read and any items missed
+                 * @param item   assigned the item read
+                 * @return true if an item was read
+                 * @return false if the cursor has read every item published
+                 */
+                bool TryRead(Cursor& cursor, T& item) const
+                {
+                    while(true)
+                    {
+                        const uint64_t tail = m_Tail.load(std::memory_order_acquire);
+                        if(cursor.position >= tail)
+                        {
+                            return false;
+                        }
+
+                        // the slot the producer writes next is the oldest one, so it is not counted as held
+                        const uint64_t capacity = m_Mask + 1;
+                        if(tail - cursor.position >= capacity)
+                        {
+                            Resync(cursor, tail);
+                            continue;
+                        }
+
+                        const Slot& slot = m_Slots[cursor.position & m_Mask];
+                        const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                        if(sequence == cursor.position + 1)
+                        {
+                            item = slot.item;
+                            std::atomic_thread_fence(std::memory_order_acquire);
+                            if(slot.sequence.load(std::memory_order_relaxed) == sequence)
+                            {
+                                ++cursor.position;
+                                return true;
+                            }
+                        }
+
+                        // overwritten since the tail was read
+                        Resync(cursor, m_Tail.load(std::memory_order_acquire));
+                    }
+                }
+
+                /**
+                 * @brief Get the number of slots in the ring
+                 *
+                 * @return size_t the capacity
+                 */
+                size_t GetCapacity() const
+                {
+                    return m_Mask + 1;
+                }
+
+                /**
+                 * @brief Get the number of items published so far
+                 *
+                 * @return uint64_t the number of items published
+                 */
+                uint64_t GetNumPublished() const
+                {
+                    return m_Tail.load(std::memory_order_acquire);
+                }
+
+                BroadcastRingBuffer(const BroadcastRingBuffer&) = delete;
+                BroadcastRingBuffer& operator=(const BroadcastRingBuffer&) = delete;
+                BroadcastRingBuffer(BroadcastRingBuffer&&) = delete;
+                BroadcastRingBuffer& operator=(BroadcastRingBuffer&&) = delete;
+
+            private:
+                /**
+                 * @brief Struct to hold an item and the sequence number, plus one, of the item it holds
+                 *
+                 */
+                struct Slot
+                {
+                    std::atomic<uint64_t> sequence{0};
+                    T item{};
+                }; // struct Slot
+
+                static constexpr uint64_t WRITING = UINT64_MAX;
+
+                /**
+                 * @brief Move a cursor that has fallen behind on to the oldest item still held
+                 *
+                 * @param cursor the cursor
+                 * @param tail   the number of items published
+                 */
+                void Resync(Cursor& cursor, const uint64_t tail) const
+                {
+                    const uint64_t capacity = m_Mask + 1;
+                    const uint64_t oldest = (tail >= capacity) ? tail - capacity + 1 : 0;
+                    if(cursor.position < oldest)
+                    {
+                        cursor.numMissed += oldest - cursor.position;
+                        cursor.position = oldest;
+                    }
+                }
+
+                std::unique_ptr<Slot[]> m_Slots{nullptr};
+                uint64_t m_Mask{0};
+                // consumers poll the tail, so it is kept on its own cache line
+                alignas(64) std::atomic<uint64_t> m_Tail{0};
+        }; // class BroadcastRingBuffer
+    } // namespace util
+} // namespace vector
+
+#endif // BROADCAST_RING_BUFFER_H
@@ -1,6 +1,11 @@
 #ifndef COMMAND_H
 #define COMMAND_H
 
+#include <string>
+#include <string_view>
+#include <variant>
+#include <stdint.h>
+
 namespace vector
 {
     namespace util
@@ -18,6 +23,27 @@ namespace vector
             LAUNCH
         };
 
+        /**
+         * @brief Payload of a command that sets a heading, such as VECTOR
+         * 
+         */
+        struct HeadingPayload
+        {
+            uint16_t heading{0};
+        };
+
+        /**
+         * @brief Payload of a command aimed at another unit, such as IDENTIFY, AQUIRE or LAUNCH
+         * 
+         */
+        struct TargetPayload
+        {
+            std::string callsign;
+        };
+
+        // empty when the command had no object, or one that did not suit its type
+        typedef std::variant<std::monostate, HeadingPayload, TargetPayload> command_payload;
+
         /**
          * @brief Struct to embody a command
          * 
@@ -26,9 +52,24 @@ namespace vector
         {
             COMMAND_TYPE command{COMMAND_TYPE::UNK};
             std::string subject;
-            std::string object;
+            command_payload payload;
+        };
+
+        /**
+         * @brief Struct to embody a command parsed in place, its tokens view the input it was parsed
+         * from and are only valid for as long as that input is
+         * 
+         */
+        struct ParsedCommand
+        {
+            COMMAND_TYPE command{COMMAND_TYPE::UNK};
+            std::string_view subject;
+            std::string_view object;
+            // set when the object is a plain unsigned number, such as a VECTOR heading
+            bool hasNumber{false};
+            uint32_t number{0};
         };
     } // namespace util
 } // namespace vector
 
-#endif // COMMAND_H
\ No newline at end of file
+#endif // COMMAND_H
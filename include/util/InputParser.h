@@ -2,6 +2,7 @@
 #define INPUT_PARSER_H
 
 #include <string>
+#include <string_view>
 
 #include "util/Command.h"
 
@@ -26,6 +27,14 @@ namespace vector
                  */
                 static Command Parse(const std::string& input);
 
+                /**
+                 * @brief Parse an input string for commands without copying it, tokens are split on runs of spaces
+                 * 
+                 * @param input             string to be parsed, which must outlive the result
+                 * @return ParsedCommand    command resulting from parsing the input string
+                 */
+                static ParsedCommand ParseView(std::string_view input);
+
                 // Delete default constructor, copy and move constructors
                 InputParser() = delete;
                 InputParser(const InputParser& other) = delete;
@@ -36,14 +45,30 @@ namespace vector
             private:
 
                 /**
-                 * @brief Trim leading and trailing whitespace from a string
+                 * @brief Trim leading spaces and trailing invalid characters from a string
+                 * 
+                 * @param input             string to be trimmed
+                 * @return std::string_view trimmed view of the string
+                 */
+                static std::string_view TrimWhitespace(std::string_view input);
+
+                /**
+                 * @brief Take the next space separated token from the front of a string
+                 * 
+                 * @param input             string to take the token from, left holding what follows the token
+                 * @return std::string_view the token, empty if there are none left
+                 */
+                static std::string_view NextToken(std::string_view& input);
+
+                /**
+                 * @brief Match a command verb
                  * 
-                 * @param input         string to be trimmed
-                 * @return std::string  trimmed string
+                 * @param verb          the verb
+                 * @return COMMAND_TYPE type of the command, UNK if the verb is not recognised
                  */
-                static std::string TrimWhitespace(const std::string& input);
+                static COMMAND_TYPE ToCommandType(std::string_view verb);
         };
     }
 }
 
-#endif // INPUT_PARSER_H
\ No newline at end of file
+#endif // INPUT_PARSER_H
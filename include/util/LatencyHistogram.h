@@ -0,0 +1,99 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Fixed-size latency histogram with HDR-style log-linear buckets.
+         *
+         * Values below 32 get a bucket each; above that every power of two is split into
+         * 16 linear sub-buckets, bounding the relative error of any reported value to 1/16.
+         * Recording is wait-free and may happen from any number of threads at once.
+         *
+         */
+        class LatencyHistogram
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 */
+                LatencyHistogram() = default;
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~LatencyHistogram() = default;
+
+                /**
+                 * @brief Record a value, values beyond the histogram's range are clamped into its last bucket
+                 *
+                 * @param value the value to record, typically nanoseconds
+                 */
+                void Record(const uint64_t value);
+
+                /**
+                 * @brief Get the value at a percentile of the recorded values
+                 *
+                 * @param percentile the percentile, 0 to 100
+                 * @return uint64_t the upper bound of the bucket holding the percentile, 0 if nothing is recorded
+                 */
+                uint64_t GetPercentile(const double percentile) const;
+
+                uint64_t GetCount() const;
+                uint64_t GetMin() const;
+                uint64_t GetMax() const;
+                double GetMean() const;
+
+                /**
+                 * @brief Clear all recorded values. Not safe to call while other threads are recording
+                 *
+                 */
+                void Reset();
+
+                /**
+                 * @brief Map a value to its bucket
+                 *
+                 * @param value the value
+                 * @return size_t index of the bucket the value is counted in
+                 */
+                static size_t GetBucketIndex(const uint64_t value);
+
+                /**
+                 * @brief Get the largest value counted in a bucket
+                 *
+                 * @param index index of the bucket
+                 * @return uint64_t the largest value that maps to the bucket
+                 */
+                static uint64_t GetBucketUpperBound(const size_t index);
+
+                LatencyHistogram(const LatencyHistogram&) = delete;
+                LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+                LatencyHistogram(LatencyHistogram&&) = delete;
+                LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+            private:
+                static constexpr size_t SUB_BUCKET_BITS = 4;
+                static constexpr size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+                // values up to 2^48 - 1 (over three days in nanoseconds) have their own buckets
+                static constexpr size_t MAX_VALUE_BITS = 48;
+                static constexpr size_t NUM_BUCKETS = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+                std::array<std::atomic<uint64_t>, NUM_BUCKETS> m_Buckets{};
+                std::atomic<uint64_t> m_Count{0};
+                std::atomic<uint64_t> m_Sum{0};
+                std::atomic<uint64_t> m_Min{UINT64_MAX};
+                std::atomic<uint64_t> m_Max{0};
+        }; // class LatencyHistogram
+    } // namespace util
+} // namespace vector
+
+#endif // LATENCY_HISTOGRAM_H
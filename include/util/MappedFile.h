@@ -0,0 +1,75 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Read-only memory mapping of a whole file.
+         *
+         * The file's pages are read in by the kernel as they are touched and shared with the page
+         * cache, so a large file is neither copied nor read ahead of use.
+         *
+         */
+        class MappedFile
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 */
+                MappedFile() = default;
+
+                /**
+                 * @brief Destructor, unmaps the file
+                 *
+                 */
+                virtual ~MappedFile();
+
+                /**
+                 * @brief Map a file, unmapping any file mapped before
+                 *
+                 * @param path the path of the file
+                 * @return true if the file was mapped
+                 * @return false if the file could not be opened or mapped
+                 */
+                bool Open(const std::string& path);
+
+                /**
+                 * @brief Unmap the file
+                 *
+                 */
+                void Close();
+
+                /**
+                 * @brief Get the mapped bytes, valid until the file is closed
+                 *
+                 * @return const uint8_t* the start of the file, nullptr if no file is mapped or the file is empty
+                 */
+                const uint8_t* GetData() const;
+
+                /**
+                 * @brief Get the size of the mapped file
+                 *
+                 * @return size_t the size in bytes
+                 */
+                size_t GetSize() const;
+
+                MappedFile(const MappedFile&) = delete;
+                MappedFile& operator=(const MappedFile&) = delete;
+                MappedFile(MappedFile&&) = delete;
+                MappedFile& operator=(MappedFile&&) = delete;
+
+            private:
+                const uint8_t* m_Data{nullptr};
+                size_t m_Size{0};
+        }; // class MappedFile
+    } // namespace util
+} // namespace vector
+
+#endif // MAPPED_FILE_H
@@ -7,6 +7,16 @@ namespace vector
 {
     namespace util
     {
+        /**
+         * @brief Struct to store the x and y components of a speed along a heading
+         * 
+         */
+        struct VelocityComponents
+        {
+            vector::sim::coord xComponent{0.0};
+            vector::sim::coord yComponent{0.0};
+        }; // struct VelocityComponents
+
         class MathUtil
         {
             public:
@@ -25,6 +35,56 @@ namespace vector
 
                 static vector::sim::coord GetYComponentOfSpeed(const vector::sim::speed speedIn, const vector::sim::angle angleIn);
 
+                /**
+                 * @brief Get both the x and y components of speed with a single heading table lookup
+                 * 
+                 * @param speedIn speed to be split into components
+                 * @param angleIn heading in whole degrees
+                 * @return VelocityComponents the x and y components of the speed
+                 */
+                static VelocityComponents GetVelocityComponents(const vector::sim::speed speedIn, const vector::sim::angle angleIn);
+
+                /**
+                 * @brief Get the sine of a heading, ie. the x component of a unit speed.
+                 * Read from a table generated at compile time rather than computed with libm
+                 * 
+                 * @param angleIn heading in degrees
+                 * @return double sine of the heading
+                 */
+                static double GetHeadingSine(const vector::sim::angle angleIn);
+
+                /**
+                 * @brief Get the cosine of a heading, ie. the y component of a unit speed.
+                 * Read from a table generated at compile time rather than computed with libm
+                 * 
+                 * @param angleIn heading in degrees
+                 * @return double cosine of the heading
+                 */
+                static double GetHeadingCosine(const vector::sim::angle angleIn);
+
+                /**
+                 * @brief Get the heading, to the nearest whole degree, that points along an offset
+                 * 
+                 * @param xDelta x component of the offset
+                 * @param yDelta y component of the offset
+                 * @return vector::sim::angle heading (0-359) of the offset, 0 for no offset
+                 */
+                static vector::sim::angle GetBearing(const vector::sim::coord xDelta, const vector::sim::coord yDelta);
+
+                /**
+                 * @brief Get the squared distance of closest approach to the origin of a point moving
+                 * in a straight line, eg. the offset between two Movers over a tick. Catches points that
+                 * pass through each other between the ends of the line, which checking only the ends misses
+                 * 
+                 * @param startXDelta   x offset at the start of the line
+                 * @param startYDelta   y offset at the start of the line
+                 * @param endXDelta     x offset at the end of the line
+                 * @param endYDelta     y offset at the end of the line
+                 * @return vector::sim::coord the squared distance of the point on the line closest to the origin
+                 */
+                static vector::sim::coord GetClosestApproachSquared(const vector::sim::coord startXDelta, const vector::sim::coord startYDelta,
+                                                                        const vector::sim::coord endXDelta, const vector::sim::coord endYDelta);
+
                 MathUtil() = delete;
                 MathUtil(const MathUtil&) = delete;
                 MathUtil& operator=(const MathUtil&) = delete;
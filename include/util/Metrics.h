@@ -0,0 +1,91 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "util/LatencyHistogram.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Named set of monotonic counters and latency histograms.
+         *
+         * Metrics are registered up front and then updated lock-free through the returned
+         * references, which stay valid for the lifetime of the Metrics object.
+         *
+         */
+        class Metrics
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 */
+                Metrics() = default;
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~Metrics() = default;
+
+                /**
+                 * @brief Register a counter
+                 *
+                 * @param name the counter's name in dumps
+                 * @return std::atomic<uint64_t>& the counter, starting at 0
+                 */
+                std::atomic<uint64_t>& AddCounter(const std::string& name);
+
+                /**
+                 * @brief Register a latency histogram
+                 *
+                 * @param name the histogram's name in dumps, values are expected in nanoseconds
+                 * @return LatencyHistogram& the histogram
+                 */
+                LatencyHistogram& AddHistogram(const std::string& name);
+
+                /**
+                 * @brief Dump every metric as one line of text each, in registration order
+                 *
+                 * @param prefix prepended to every metric name
+                 * @return std::string the dump
+                 */
+                std::string ToText(const std::string& prefix) const;
+
+                /**
+                 * @brief Dump every metric as a JSON object keyed by metric name
+                 *
+                 * @return std::string the dump
+                 */
+                std::string ToJson() const;
+
+                /**
+                 * @brief Get the nanoseconds elapsed since a point in time
+                 *
+                 * @param start the point in time
+                 * @return uint64_t nanoseconds since start
+                 */
+                static uint64_t NanosSince(const std::chrono::steady_clock::time_point start);
+
+                Metrics(const Metrics&) = delete;
+                Metrics& operator=(const Metrics&) = delete;
+                Metrics(Metrics&&) = delete;
+                Metrics& operator=(Metrics&&) = delete;
+
+            private:
+                std::vector<std::pair<std::string, std::unique_ptr<std::atomic<uint64_t>>>> m_Counters;
+                std::vector<std::pair<std::string, std::unique_ptr<LatencyHistogram>>> m_Histograms;
+        }; // class Metrics
+    } // namespace util
+} // namespace vector
+
+#endif // METRICS_H
@@ -0,0 +1,157 @@
+#ifndef MPSC_RING_BUFFER_H
+#define MPSC_RING_BUFFER_H
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Bounded lock-free multi-producer, single-consumer FIFO queue.
+         *
+         * Each slot carries a sequence number (after D. Vyukov's bounded queue) which tells
+         * producers whether the slot is free for the current lap and tells the consumer whether
+         * it has been filled, so producers only contend on claiming a position and never on the
+         * consumer. Any number of threads may TryPush concurrently; only one thread may TryPop.
+         *
+         */
+        template <typename T>
+        class MpscRingBuffer
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param capacity the number of items the queue can hold, rounded up to a power of two (minimum 2)
+                 */
+                explicit MpscRingBuffer(const size_t capacity)
+                {
+                    size_t roundedCapacity = 2;
+                    while(roundedCapacity < capacity)
+                    {
+                        roundedCapacity <<= 1;
+                    }
+
+                    m_Mask = roundedCapacity - 1;
+                    m_Slots = std::make_unique<Slot[]>(roundedCapacity);
+                    for(size_t i = 0; i < roundedCapacity; ++i)
+                    {
+                        m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+                    }
+                }
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~MpscRingBuffer() = default;
+
+                /**
+                 * @brief Add an item to the back of the queue. Safe to call from any number of threads
+                 *
+                 * @param item the item, which is only moved from if it is added
+                 * @return true if the item was added
+                 * @return false if the queue is full
+                 */
+                bool TryPush(T&& item)
+                {
+                    size_t position = m_Tail.load(std::memory_order_relaxed);
+                    Slot* slot = nullptr;
+
+                    while(true)
+                    {
+                        slot = &m_Slots[position & m_Mask];
+                        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                        const intptr_t lap = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+                        if(lap == 0)
+                        {
+                            // the slot is free for this position, try to claim it
+                            if(m_Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                        }
+                        else if(lap < 0)
+                        {
+                            // the slot still holds an item from the previous lap
+                            return false;
+                        }
+                        else
+                        {
+                            position = m_Tail.load(std::memory_order_relaxed);
+                        }
+                    }
+
+                    slot->item = std::move(item);
+                    slot->sequence.store(position + 1, std::memory_order_release);
+
+                    return true;
+                }
+
+                /**
+                 * @brief Take the item at the front of the queue. Only one thread may pop
+                 *
+                 * @param item assigned the item taken
+                 * @return true if an item was taken
+                 * @return false if the queue is empty, or the next item is still being written
+                 */
+                bool TryPop(T& item)
+                {
+                    Slot& slot = m_Slots[m_Head & m_Mask];
+                    const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+                    if(sequence != m_Head + 1)
+                    {
+                        return false;
+                    }
+
+                    item = std::move(slot.item);
+                    // free the slot for the producers' next lap
+                    slot.sequence.store(m_Head + m_Mask + 1, std::memory_order_release);
+                    ++m_Head;
+
+                    return true;
+                }
+
+                /**
+                 * @brief Get the number of items the queue can hold
+                 *
+                 * @return size_t the capacity
+                 */
+                size_t GetCapacity() const
+                {
+                    return m_Mask + 1;
+                }
+
+                MpscRingBuffer(const MpscRingBuffer&) = delete;
+                MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+                MpscRingBuffer(MpscRingBuffer&&) = delete;
+                MpscRingBuffer& operator=(MpscRingBuffer&&) = delete;
+
+            private:
+                /**
+                 * @brief Struct to hold an item and the sequence number that says who may touch it
+                 *
+                 */
+                struct Slot
+                {
+                    std::atomic<size_t> sequence{0};
+                    T item;
+                }; // struct Slot
+
+                std::unique_ptr<Slot[]> m_Slots{nullptr};
+                size_t m_Mask{0};
+                // producers and the consumer each keep their position on their own cache line
+                alignas(64) std::atomic<size_t> m_Tail{0};
+                alignas(64) size_t m_Head{0};
+        }; // class MpscRingBuffer
+    } // namespace util
+} // namespace vector
+
+#endif // MPSC_RING_BUFFER_H
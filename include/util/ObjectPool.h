@@ -0,0 +1,173 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include <stddef.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Fixed capacity pool of objects, for types that are created and destroyed at a high rate.
+         *
+         * All storage is allocated once, up front. A free slot holds the link to the next free slot
+         * in place of an object (an intrusive free list), so allocating and releasing are a pointer
+         * swap each and never touch the heap. Released slots are reused most recent first, while they
+         * are still warm in cache. Pointers to allocated objects remain valid until they are released.
+         * Not thread safe.
+         *
+         */
+        template <typename T>
+        class ObjectPool
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param capacity the most objects the pool can hold at once
+                 */
+                explicit ObjectPool(const size_t capacity)
+                    : m_Slots(std::make_unique<Slot[]>(capacity))
+                    , m_Capacity(capacity)
+                {
+                    for(size_t i = 0; i < capacity; ++i)
+                    {
+                        m_Slots[i].nextFreePtr = (i + 1 < capacity) ? &m_Slots[i + 1] : nullptr;
+                    }
+                    m_FreePtr = (capacity > 0) ? &m_Slots[0] : nullptr;
+                }
+
+                /**
+                 * @brief Destructor, destroys any objects still allocated
+                 *
+                 */
+                virtual ~ObjectPool()
+                {
+                    if(m_NumAllocated == 0)
+                    {
+                        return;
+                    }
+
+                    std::vector<bool> freeSlots(m_Capacity, false);
+                    for(Slot* slotPtr = m_FreePtr; slotPtr != nullptr; slotPtr = slotPtr->nextFreePtr)
+                    {
+                        freeSlots[slotPtr - m_Slots.get()] = true;
+                    }
+
+                    for(size_t i = 0; i < m_Capacity; ++i)
+                    {
+                        if(!freeSlots[i])
+                        {
+                            ToObject(&m_Slots[i])->~T();
+                        }
+                    }
+                }
+
+                /**
+                 * @brief Construct an object in a free slot
+                 *
+                 * @param args arguments forwarded to T's constructor
+                 * @return T* the object, nullptr if the pool is exhausted
+                 */
+                template <typename... Args>
+                T* Allocate(Args&&... args)
+                {
+                    if(m_FreePtr == nullptr)
+                    {
+                        return nullptr;
+                    }
+
+                    Slot* slotPtr = m_FreePtr;
+                    m_FreePtr = slotPtr->nextFreePtr;
+
+                    T* objectPtr = new (slotPtr->storage) T(std::forward<Args>(args)...);
+                    ++m_NumAllocated;
+
+                    return objectPtr;
+                }
+
+                /**
+                 * @brief Destroy an object and return its slot to the pool
+                 *
+                 * @param objectPtr an object allocated from this pool, which must not be used again
+                 * @return true if the object was released
+                 * @return false if the object is not from this pool
+                 */
+                bool Release(T* objectPtr)
+                {
+                    if(!Owns(objectPtr))
+                    {
+                        return false;
+                    }
+
+                    objectPtr->~T();
+
+                    // the object lives at the start of its slot
+                    Slot* slotPtr = reinterpret_cast<Slot*>(objectPtr);
+                    slotPtr->nextFreePtr = m_FreePtr;
+                    m_FreePtr = slotPtr;
+                    --m_NumAllocated;
+
+                    return true;
+                }
+
+                /**
+                 * @brief Determine whether an object lies in this pool's storage
+                 *
+                 * @param objectPtr the object
+                 * @return true if the object is in one of this pool's slots
+                 */
+                bool Owns(const T* objectPtr) const
+                {
+                    const unsigned char* bytePtr = reinterpret_cast<const unsigned char*>(objectPtr);
+                    const unsigned char* beginPtr = reinterpret_cast<const unsigned char*>(m_Slots.get());
+                    const unsigned char* endPtr = reinterpret_cast<const unsigned char*>(m_Slots.get() + m_Capacity);
+
+                    return objectPtr != nullptr && bytePtr >= beginPtr && bytePtr < endPtr &&
+                            (bytePtr - beginPtr) % sizeof(Slot) == 0;
+                }
+
+                size_t GetCapacity() const
+                {
+                    return m_Capacity;
+                }
+
+                size_t GetNumAllocated() const
+                {
+                    return m_NumAllocated;
+                }
+
+                ObjectPool(const ObjectPool&) = delete;
+                ObjectPool& operator=(const ObjectPool&) = delete;
+                ObjectPool(ObjectPool&&) = delete;
+                ObjectPool& operator=(ObjectPool&&) = delete;
+
+            private:
+                /**
+                 * @brief Storage for one object, or while free the link to the next free slot
+                 *
+                 */
+                union Slot
+                {
+                    Slot* nextFreePtr;
+                    alignas(T) unsigned char storage[sizeof(T)];
+                }; // union Slot
+
+                static T* ToObject(Slot* slotPtr)
+                {
+                    return std::launder(reinterpret_cast<T*>(slotPtr->storage));
+                }
+
+                std::unique_ptr<Slot[]> m_Slots{nullptr};
+                size_t m_Capacity{0};
+                Slot* m_FreePtr{nullptr};
+                size_t m_NumAllocated{0};
+        }; // class ObjectPool
+    } // namespace util
+} // namespace vector
+
+#endif // OBJECT_POOL_H
@@ -0,0 +1,89 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Fixed-size pool of worker threads for fork-join parallel loops.
+         *
+         * The thread calling ParallelFor works alongside the pool's workers, so a pool
+         * created for N threads of parallelism owns N - 1 worker threads.
+         *
+         */
+        class ThreadPool
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param numThreads total threads of parallelism, including the calling thread (minimum 1)
+                 */
+                explicit ThreadPool(const size_t numThreads);
+
+                /**
+                 * @brief Destructor, joins all worker threads
+                 *
+                 */
+                virtual ~ThreadPool();
+
+                /**
+                 * @brief Get the total threads of parallelism, including the calling thread
+                 *
+                 * @return size_t the number of threads that run ParallelFor tasks
+                 */
+                size_t GetNumThreads() const;
+
+                /**
+                 * @brief Run task(0) ... task(numTasks - 1) across the pool, returning once all have completed.
+                 * Tasks are claimed dynamically, so no assumption may be made about which thread runs which task.
+                 * Only one ParallelFor may run at a time.
+                 *
+                 * @param numTasks  the number of tasks to run
+                 * @param task      the task to run, invoked with each task index
+                 */
+                void ParallelFor(const size_t numTasks, const std::function<void(const size_t taskIndex)>& task);
+
+                ThreadPool(const ThreadPool&) = delete;
+                ThreadPool& operator=(const ThreadPool&) = delete;
+                ThreadPool(ThreadPool&&) = delete;
+                ThreadPool& operator=(ThreadPool&&) = delete;
+
+            private:
+                /**
+                 * @brief Worker thread
+                 *
+                 */
+                void Run();
+
+                /**
+                 * @brief Claim and run tasks of the current job until none are left
+                 *
+                 */
+                void RunTasks();
+
+                std::vector<std::thread> m_Workers;
+                std::mutex m_JobMutex;
+                std::condition_variable m_JobStartCondition;
+                std::condition_variable m_JobDoneCondition;
+                const std::function<void(const size_t taskIndex)>* m_JobTask{nullptr};
+                size_t m_JobNumTasks{0};
+                uint64_t m_JobGeneration{0};
+                size_t m_WorkersBusy{0};
+                std::atomic<size_t> m_NextTask{0};
+                bool m_Stopping{false};
+        }; // class ThreadPool
+    } // namespace util
+} // namespace vector
+
+#endif // THREAD_POOL_H
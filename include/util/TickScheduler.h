@@ -0,0 +1,116 @@
+#ifndef TICK_SCHEDULER_H
+#define TICK_SCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vector
+{
+    namespace util
+    {
+        /**
+         * @brief Fixed-timestep scheduler.
+         *
+         * Tick deadlines are laid out on a steady-clock grid from Start, so the time spent
+         * working between ticks does not push later ticks back. When work overruns one or more
+         * periods the missed ticks are caught up, up to a cap, after which the grid is moved
+         * forward and the rest are dropped.
+         *
+         */
+        class TickScheduler
+        {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * @param tickRateHz        the number of ticks per second (minimum 1)
+                 * @param maxCatchUpTicks   the most ticks WaitForNextTick will ask for at once (minimum 1)
+                 */
+                TickScheduler(const uint32_t tickRateHz, const size_t maxCatchUpTicks);
+
+                /**
+                 * @brief Destructor
+                 *
+                 */
+                virtual ~TickScheduler() = default;
+
+                /**
+                 * @brief Set the number of ticks per second, takes effect from the next Start
+                 *
+                 * @param tickRateHz the number of ticks per second (minimum 1)
+                 */
+                void SetTickRateHz(const uint32_t tickRateHz);
+
+                /**
+                 * @brief Get the number of ticks per second
+                 *
+                 * @return uint32_t the number of ticks per second
+                 */
+                uint32_t GetTickRateHz() const;
+
+                /**
+                 * @brief Start the deadline grid, with the first tick due immediately
+                 *
+                 */
+                void Start();
+
+                /**
+                 * @brief Sleep until the next tick deadline
+                 *
+                 * @return size_t the number of ticks now due: 1 when on schedule, more when catching up
+                 *                after an overrun, never more than the catch-up cap
+                 */
+                size_t WaitForNextTick();
+
+                /**
+                 * @brief Take the ticks due by now without sleeping, for a caller that waits on many schedulers itself
+                 *
+                 * @return size_t the number of ticks now due: 0 before the next deadline, otherwise as WaitForNextTick
+                 */
+                size_t TakeDueTicks();
+
+                /**
+                 * @brief Get when the next tick is due
+                 *
+                 * @return std::chrono::steady_clock::time_point the next deadline
+                 */
+                std::chrono::steady_clock::time_point GetNextDeadline() const;
+
+                /**
+                 * @brief Counters, safe to read from any thread while the scheduler runs
+                 *
+                 */
+                uint64_t GetNumTicks() const;
+                // times WaitForNextTick found one or more deadlines already missed
+                uint64_t GetNumOverruns() const;
+                // ticks dropped because catching up would have exceeded the cap
+                uint64_t GetNumSkippedTicks() const;
+
+                TickScheduler(const TickScheduler&) = delete;
+                TickScheduler& operator=(const TickScheduler&) = delete;
+                TickScheduler(TickScheduler&&) = delete;
+                TickScheduler& operator=(TickScheduler&&) = delete;
+
+            private:
+                /**
+                 * @brief Take the ticks due by a time at or after the next deadline, moving the deadline on past it
+                 *
+                 * @param now the time
+                 * @return size_t the number of ticks due, capped
+                 */
+                size_t TakeDueTicks(const std::chrono::steady_clock::time_point now);
+
+                std::chrono::steady_clock::duration m_TickPeriod;
+                uint32_t m_TickRateHz;
+                size_t m_MaxCatchUpTicks;
+                std::chrono::steady_clock::time_point m_NextDeadline;
+                std::atomic<uint64_t> m_NumTicks{0};
+                std::atomic<uint64_t> m_NumOverruns{0};
+                std::atomic<uint64_t> m_NumSkippedTicks{0};
+        }; // class TickScheduler
+    } // namespace util
+} // namespace vector
+
+#endif // TICK_SCHEDULER_H
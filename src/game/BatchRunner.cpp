@@ -0,0 +1,113 @@
+#include "game/BatchRunner.h"
+
+#include "sim/GameEngine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+namespace vector
+{
+    namespace game
+    {
+        BatchRunner::BatchRunner(const size_t numThreads)
+            : m_ThreadPool(numThreads)
+        {
+        }
+
+        BatchSummary BatchRunner::Run(const ScenarioFunction& scenario, const uint64_t firstSeed, const size_t numMatches, const uint64_t maxTicks)
+        {
+            m_Results.clear();
+            m_Results.resize(numMatches);
+
+            const auto runStart = std::chrono::steady_clock::now();
+            m_ThreadPool.ParallelFor(numMatches, [&](const size_t taskIndex)
+            {
+                HeadlessMatch match(std::make_unique<vector::sim::GameEngine>());
+                scenario(match, firstSeed + taskIndex);
+                m_Results[taskIndex] = match.Run(maxTicks);
+            });
+
+            BatchSummary summary = Summarize(m_Results);
+            summary.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+            if(summary.elapsedSeconds > 0.0)
+            {
+                summary.ticksPerSecond = static_cast<double>(summary.ticksRun) / summary.elapsedSeconds;
+            }
+
+            return summary;
+        }
+
+        const std::vector<MatchResult>& BatchRunner::GetResults() const
+        {
+            return m_Results;
+        }
+
+        size_t BatchRunner::GetNumThreads() const
+        {
+            return m_ThreadPool.GetNumThreads();
+        }
+
+        BatchSummary BatchRunner::Summarize(const std::vector<MatchResult>& results)
+        {
+            BatchSummary summary;
+            summary.numMatches = results.size();
+
+            size_t numTeams = 0;
+            for(const auto& result : results)
+            {
+                numTeams = std::max(numTeams, result.survivors.size());
+            }
+            summary.wins.resize(numTeams, 0);
+            summary.meanSurvivors.resize(numTeams, 0.0);
+
+            uint64_t firstKillTickSum = 0;
+            for(const auto& result : results)
+            {
+                if(result.decided)
+                {
+                    ++summary.numDecided;
+                    if(result.winningTeamID == vector::sim::UNK_TEAM_ID)
+                    {
+                        ++summary.numNoneLeft;
+                    }
+                    else
+                    {
+                        ++summary.wins[result.winningTeamID];
+                    }
+                }
+
+                for(size_t teamID = 0; teamID < result.survivors.size(); ++teamID)
+                {
+                    summary.meanSurvivors[teamID] += static_cast<double>(result.survivors[teamID]);
+                }
+
+                if(result.firstKillTick != UINT64_MAX)
+                {
+                    ++summary.numFirstKills;
+                    firstKillTickSum += result.firstKillTick;
+                    summary.minFirstKillTick = std::min(summary.minFirstKillTick, result.firstKillTick);
+                    summary.maxFirstKillTick = std::max(summary.maxFirstKillTick, result.firstKillTick);
+                }
+
+                summary.commandsUnresolved += result.commandsUnresolved;
+                summary.commandsRejected += result.commandsRejected;
+                summary.ticksRun += result.ticksRun;
+            }
+
+            if(summary.numMatches > 0)
+            {
+                for(auto& meanSurvivors : summary.meanSurvivors)
+                {
+                    meanSurvivors /= static_cast<double>(summary.numMatches);
+                }
+            }
+            if(summary.numFirstKills > 0)
+            {
+                summary.meanFirstKillTick = static_cast<double>(firstKillTickSum) / static_cast<double>(summary.numFirstKills);
+            }
+
+            return summary;
+        }
+    } // namespace game
+} // namespace vector
@@ -1,8 +1,12 @@
 #include "game/GameManager.h"
 
-#include "sim/MoverInterface.h"
-#include "sim/FighterMover.h"
+#include "sim/SimConstants.h"
 #include "sim/SimParams.h"
+#include "util/MathUtil.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 namespace vector
 {
@@ -41,13 +45,98 @@ namespace vector
             return m_NumPlayerSlots;
         }
 
+        bool GameManager::SetGameStateUpdateMode(const vector::game::GAME_STATE_UPDATE_MODE updateMode)
+        {
+            std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
+            if(!m_Started)
+            {
+                m_GameStateUpdateMode = updateMode;
+                return true;
+            }
+            return false;
+        }
+
+        vector::game::GAME_STATE_UPDATE_MODE GameManager::GetGameStateUpdateMode() const
+        {
+            std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
+            return m_GameStateUpdateMode;
+        }
+
+        bool GameManager::SetViewRange(const vector::sim::coord viewRange)
+        {
+            std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
+            if(!m_Started)
+            {
+                return m_GameEnginePtr->SetViewRange(viewRange);
+            }
+            return false;
+        }
+
+        vector::sim::coord GameManager::GetViewRange() const
+        {
+            return m_GameEnginePtr->GetViewRange();
+        }
+
+        bool GameManager::SetReplayPath(const std::string& replayPath)
+        {
+            std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
+            if(!m_Started)
+            {
+                m_ReplayPath = replayPath;
+                return true;
+            }
+            return false;
+        }
+
+        std::string GameManager::GetReplayPath() const
+        {
+            std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
+            return m_ReplayPath;
+        }
+
+        bool GameManager::SetTickRateHz(const uint32_t tickRateHz)
+        {
+            std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
+            if(!m_Started && tickRateHz >= MIN_TICK_RATE_HZ && tickRateHz <= MAX_TICK_RATE_HZ)
+            {
+                m_TickScheduler.SetTickRateHz(tickRateHz);
+                return true;
+            }
+            return false;
+        }
+
+        uint32_t GameManager::GetTickRateHz() const
+        {
+            std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
+            return m_TickScheduler.GetTickRateHz();
+        }
+
+        uint64_t GameManager::GetNumTickOverruns() const
+        {
+            return m_TickScheduler.GetNumOverruns();
+        }
+
+        uint64_t GameManager::GetNumSkippedTicks() const
+        {
+            return m_TickScheduler.GetNumSkippedTicks();
+        }
+
+        std::string GameManager::GetMetricsText() const
+        {
+            return m_GameEnginePtr->GetMetrics().ToText("engine.") + m_Metrics.ToText("game.");
+        }
+
+        std::string GameManager::GetMetricsJson() const
+        {
+            return "{\"engine\":" + m_GameEnginePtr->GetMetrics().ToJson() + ",\"game\":" + m_Metrics.ToJson() + "}";
+        }
+
         bool GameManager::AddPlayer(std::shared_ptr<vector::game::PlayerInterface> playerPtr)
         {
             std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
-            auto playerMapItr = m_PlayerMap.find(playerPtr->GetPlayerID());
-            if(!m_Started && playerMapItr == m_PlayerMap.end() && m_PlayerMap.size() < m_NumPlayerSlots)
+            if(!m_Started && FindPlayer(playerPtr->GetPlayerID()) == nullptr && m_Players.size() < m_NumPlayerSlots)
             {
-                m_PlayerMap.emplace(playerPtr->GetPlayerID(), playerPtr);
+                m_Players.push_back(playerPtr);
 
                 playerPtr->RegisterCommandFunction(
                     std::bind(std::mem_fn(&GameManager::InputCommand), this,  std::placeholders::_1, std::placeholders::_2));
@@ -66,7 +155,7 @@ namespace vector
                 fighterParams.maxSpeed = vector::sim::FIGHTER_SPEED_MAX;
                 fighterParams.turnRate = vector::sim::FIGHTER_TURN_RATE;
 
-                std::vector<std::shared_ptr<vector::sim::MoverInterface>> allMovers;
+                std::vector<std::string> fighterCallsigns;
 
                 for(auto curUnit : unitData)
                 {
@@ -74,8 +163,7 @@ namespace vector
                     {
                         case vector::game::UNIT_TYPE::FIGHTER:
                         {
-                            std::shared_ptr<vector::sim::FighterMover> fighterPtr = std::make_shared<vector::sim::FighterMover>(curUnit.callsign, teamID, fighterParams);
-                            allMovers.push_back(fighterPtr);
+                            fighterCallsigns.push_back(curUnit.callsign);
                             break;
                         }
                         case vector::game::UNIT_TYPE::UNK:
@@ -84,9 +172,16 @@ namespace vector
                     }
                 }
 
-                for(auto curMoverPtr : allMovers)
+                // fighters live in the GameEngine's MoverStore so they are ticked in one linear pass
+                auto& unitHandles = m_TeamUnitHandles[teamID];
+                for(size_t i = 0; i < fighterCallsigns.size(); ++i)
                 {
-                    m_GameEnginePtr->AddMover(curMoverPtr);
+                    vector::sim::MoverHandle handle = m_GameEnginePtr->AddFighter(fighterCallsigns[i], teamID, fighterParams);
+                    if(handle.IsValid())
+                    {
+                        m_GameEnginePtr->GetMover(handle)->SetInitialInertialData(GetSpawnData(teamID, i, fighterCallsigns.size()));
+                        unitHandles[fighterCallsigns[i]] = handle;
+                    }
                 }
                 
                 m_UnitDataSetMap.emplace(std::pair<vector::sim::team_ID, bool>(teamID, true));
@@ -96,15 +191,46 @@ namespace vector
             return false;
         }
 
+        vector::sim::InertialData GameManager::GetSpawnData(const vector::sim::team_ID teamID, const size_t unitIndex, const size_t numUnits)
+        {
+            const vector::sim::angle bearing = SPAWN_BEARINGS[(teamID + SPAWN_BEARINGS.size() - 1) % SPAWN_BEARINGS.size()];
+            const vector::sim::angle abreast = (bearing + vector::sim::HEADING_FULL_CIRCLE / 4) % vector::sim::HEADING_FULL_CIRCLE;
+
+            // one line if it fits, otherwise ranks in a block shaped like the team's sector
+            const size_t maxUnitsPerLine = static_cast<size_t>(SPAWN_FRONT_WIDTH / SPAWN_SPACING) + 1;
+            const size_t blockUnitsPerRank = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(numUnits) * SPAWN_FRONT_WIDTH / SPAWN_DEPTH)));
+            const size_t unitsPerRank = std::max<size_t>(std::min(numUnits, std::max(maxUnitsPerLine, blockUnitsPerRank)), 1);
+            const size_t numRanks = (numUnits + unitsPerRank - 1) / unitsPerRank;
+            const size_t rank = unitIndex / unitsPerRank;
+            const size_t unitsInRank = std::min(unitsPerRank, numUnits - rank * unitsPerRank);
+
+            const double lineSpacing = (unitsPerRank > 1) ? std::min(SPAWN_SPACING, SPAWN_FRONT_WIDTH / static_cast<double>(unitsPerRank - 1)) : 0.0;
+            const double rankSpacing = (numRanks > 1) ? std::min(SPAWN_SPACING, SPAWN_DEPTH / static_cast<double>(numRanks - 1)) : 0.0;
+            // centre each rank on the line through the spawn point, with later ranks further from the centre of the arena
+            const double offset = (static_cast<double>(unitIndex % unitsPerRank) - (static_cast<double>(unitsInRank) - 1.0) / 2.0) * lineSpacing;
+            const double distance = SPAWN_DISTANCE + static_cast<double>(rank) * rankSpacing;
+
+            vector::sim::InertialData spawnData;
+            spawnData.curHeading = (bearing + vector::sim::HEADING_HALF_CIRCLE) % vector::sim::HEADING_FULL_CIRCLE;
+            spawnData.xCoord = (vector::sim::X_COORD_MAX + vector::sim::X_COORD_MIN) / 2 +
+                                vector::util::MathUtil::GetXComponentOfSpeed(distance, bearing) +
+                                vector::util::MathUtil::GetXComponentOfSpeed(offset, abreast);
+            spawnData.yCoord = (vector::sim::Y_COORD_MAX + vector::sim::Y_COORD_MIN) / 2 +
+                                vector::util::MathUtil::GetYComponentOfSpeed(distance, bearing) +
+                                vector::util::MathUtil::GetYComponentOfSpeed(offset, abreast);
+
+            return spawnData;
+        }
+
         bool GameManager::IsReadyToStart() const
         {
             std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
 
-            if(!m_Started && m_NumPlayerSlots == m_PlayerMap.size() && m_GameType != vector::game::GAME_TYPE::UNK)
+            if(!m_Started && m_NumPlayerSlots == m_Players.size() && m_GameType != vector::game::GAME_TYPE::UNK)
             {
-                for(auto playerItr : m_PlayerMap)
+                for(const auto& playerPtr : m_Players)
                 {
-                    if(!playerItr.second->IsReady())
+                    if(!playerPtr->IsReady())
                     {
                         return false;
                     }
@@ -118,65 +244,269 @@ namespace vector
         // and create the units based on game type
         bool GameManager::Start()
         {
-            if(!m_Started && IsReadyToStart())
+            if(!BeginGame())
             {
-                m_Started = true;
+                return false;
+            }
 
-                m_GameThreadPtr = std::make_unique<std::thread>(&GameManager::Run, this);
-                
-                return true;
+            m_GameThreadPtr = std::make_unique<std::thread>(&GameManager::Run, this);
+
+            return true;
+        }
+
+        bool GameManager::StartHosted()
+        {
+            std::scoped_lock<std::mutex> lock(m_HostedRunMutex);
+            if(!BeginGame())
+            {
+                return false;
             }
-            return false;
+
+            m_Hosted = true;
+
+            return true;
+        }
+
+        std::chrono::steady_clock::time_point GameManager::RunDueTicks()
+        {
+            std::scoped_lock<std::mutex> lock(m_HostedRunMutex);
+            if(!m_Hosted || m_Ended)
+            {
+                return std::chrono::steady_clock::time_point::max();
+            }
+
+            const size_t dueTicks = m_TickScheduler.TakeDueTicks();
+            if(dueTicks > 0)
+            {
+                // the calling thread is the game thread for as long as it runs the ticks
+                m_GameThreadId = std::this_thread::get_id();
+                RunTicks(dueTicks);
+                m_GameThreadId = std::thread::id();
+            }
+
+            return m_TickScheduler.GetNextDeadline();
         }
 
         bool GameManager::Stop()
         {
+            // senders are stopped while the game still ticks, so none is left waiting on a command only a Tick can apply
+            if(m_FanOutPtr != nullptr)
+            {
+                m_FanOutPtr->Stop();
+            }
+
             m_Ended = true;
 
-            m_GameThreadPtr->join();
+            if(m_GameThreadPtr != nullptr)
+            {
+                m_GameThreadPtr->join();
+            }
+
+            // a host may be part way through running the Game's ticks
+            std::scoped_lock<std::mutex> lock(m_HostedRunMutex);
+
+            if(m_ReplayRecorderPtr != nullptr)
+            {
+                m_ReplayRecorderPtr->Close();
+            }
 
             return true;
         }
 
         bool GameManager::InputCommand(const std::string playerID, const vector::util::Command cmd)
         {
-            vector::util::Command deconflictedCommand;
-            
-            deconflictedCommand = DeconflictCommand(playerID, cmd);
+            ++m_CommandsReceivedCounter;
 
-           return m_GameEnginePtr->InputCommand(deconflictedCommand);
+            vector::sim::MoverHandle subjectHandle = ResolveSubject(playerID, cmd.subject);
+            if(!subjectHandle.IsValid())
+            {
+                ++m_CommandsUnresolvedCounter;
+                return false;
+            }
+
+            // the game thread applies directly, it would otherwise wait on a Tick only it can run
+            if(!m_Started || m_Ended || std::this_thread::get_id() == m_GameThreadId.load())
+            {
+                // applied between ticks, which replays the same as being applied first in the next
+                if(m_Started && !m_Ended && m_ReplayRecorderPtr != nullptr)
+                {
+                    m_TickCommands.push_back(vector::sim::TickCommand{subjectHandle, cmd});
+                }
+                return m_GameEnginePtr->InputCommand(subjectHandle, cmd);
+            }
+
+            // while the game runs, commands are queued for the next Tick rather than contending with it
+            std::future<bool> result = m_GameEnginePtr->QueueCommand(subjectHandle, cmd);
+            if(result.wait_for(COMMAND_ACK_TIMEOUT) != std::future_status::ready)
+            {
+                ++m_CommandsTimedOutCounter;
+                return false;
+            }
+
+            return result.get();
         }
 
-        vector::util::Command GameManager::DeconflictCommand(const std::string playerID, const vector::util::Command cmd)
+        vector::sim::MoverHandle GameManager::ResolveSubject(const std::string& playerID, const std::string& callsign) const
         {
-            vector::util::Command cmdOut;
+            std::scoped_lock<std::mutex> lock(m_GameSetupMutex);
 
-            cmdOut.command = cmd.command;
-            cmdOut.subject = playerID + cmd.subject;
-            cmdOut.object = cmd.object;
+            std::shared_ptr<vector::game::PlayerInterface> playerPtr = FindPlayer(playerID);
+            if(playerPtr == nullptr)
+            {
+                return vector::sim::MoverHandle();
+            }
+
+            auto teamItr = m_TeamUnitHandles.find(playerPtr->GetTeamID());
+            if(teamItr == m_TeamUnitHandles.end())
+            {
+                return vector::sim::MoverHandle();
+            }
+
+            auto unitItr = teamItr->second.find(callsign);
+            if(unitItr == teamItr->second.end())
+            {
+                return vector::sim::MoverHandle();
+            }
 
-            return cmdOut;
+            return unitItr->second;
+        }
+
+        std::shared_ptr<vector::game::PlayerInterface> GameManager::FindPlayer(const std::string& playerID) const
+        {
+            for(const auto& playerPtr : m_Players)
+            {
+                if(playerPtr->GetPlayerID() == playerID)
+                {
+                    return playerPtr;
+                }
+            }
+
+            return nullptr;
         }
 
         void GameManager::UpdateGameState()
         {
-            vector::sim::GameState latestGameState = m_GameEnginePtr->GetGameState();
+            const auto fanOutStart = std::chrono::steady_clock::now();
+
+            // views are immutable, so the senders of a team's Players share its view and none holds up the next Tick
+            for(const vector::sim::team_ID teamID : m_ViewTeams)
+            {
+                m_TeamStatePtrs[teamID] = m_GameEnginePtr->GetTeamGameStateSnapshot(teamID);
+            }
+            m_FanOutPtr->Publish(m_TeamStatePtrs);
+
+            // let go of the views, so the engine can rebuild them in place once the senders are done with them
+            for(const vector::sim::team_ID teamID : m_ViewTeams)
+            {
+                m_TeamStatePtrs[teamID] = nullptr;
+            }
+
+            m_FanOutHistogram.Record(vector::util::Metrics::NanosSince(fanOutStart));
+        }
+
+        bool GameManager::StartRecording()
+        {
+            m_ReplayRecorderPtr = std::make_unique<vector::sim::ReplayRecorder>(vector::sim::REPLAY_KEYFRAME_INTERVAL);
+            if(!m_ReplayRecorderPtr->Open(m_ReplayPath))
+            {
+                m_ReplayRecorderPtr.reset();
+                return false;
+            }
+
+            // nothing has been removed yet, so handle order is the order the units were added in; commands applied
+            // before the start are not recorded, so the headings they set are recorded with the fighters instead
+            std::shared_ptr<const vector::sim::GameState> gameStatePtr = m_GameEnginePtr->GetGameStateSnapshot();
+            for(const auto& moverState : gameStatePtr->moverList)
+            {
+                std::shared_ptr<vector::sim::MoverInterface> moverPtr = m_GameEnginePtr->GetMover(moverState.handle);
+                m_ReplayRecorderPtr->RecordFighter(moverState.handle, moverState.ID, moverState.teamID,
+                                                    moverPtr->GetPerformanceValues(), moverState.inertialData,
+                                                    moverPtr->GetDesiredHeading());
+            }
+            RecordKeyframe();
+
+            return true;
+        }
 
-            for(auto clientItr : m_PlayerMap)
+        void GameManager::RecordKeyframe()
+        {
+            m_ReplayRecorderPtr->RecordKeyframe(*m_GameEnginePtr->GetGameStateSnapshot());
+            if(m_GameEnginePtr->GetCheckpoint(m_Checkpoint))
             {
-                clientItr.second->UpdateGameState(latestGameState);
+                m_ReplayRecorderPtr->RecordCheckpoint(m_Checkpoint);
+            }
+        }
+
+        bool GameManager::BeginGame()
+        {
+            if(!m_Started && IsReadyToStart())
+            {
+                if(!m_ReplayPath.empty() && !StartRecording())
+                {
+                    return false;
+                }
+
+                m_Started = true;
+
+                m_FanOutPtr = std::make_unique<GameStateFanOut>(FAN_OUT_SENDER_THREADS, PLAYER_UPDATE_QUEUE_DEPTH, m_GameStateUpdateMode,
+                                                                m_UpdatesSentCounter, m_UpdatesCoalescedCounter);
+                for(const auto& playerPtr : m_Players)
+                {
+                    m_FanOutPtr->AddPlayer(playerPtr);
+
+                    const vector::sim::team_ID teamID = playerPtr->GetTeamID();
+                    if(std::find(m_ViewTeams.begin(), m_ViewTeams.end(), teamID) == m_ViewTeams.end())
+                    {
+                        m_ViewTeams.push_back(teamID);
+                    }
+                    if(teamID >= m_TeamStatePtrs.size())
+                    {
+                        m_TeamStatePtrs.resize(teamID + 1);
+                    }
+                }
+
+                m_TickScheduler.Start();
+
+                return true;
             }
+            return false;
         }
 
         void GameManager::Run()
         {
+            m_GameThreadId = std::this_thread::get_id();
+
             while(!m_Ended)
             {
-                m_GameEnginePtr->Tick();
-                UpdateGameState();
+                // after an overrun the missed ticks are run back to back, and Players only see the latest
+                RunTicks(m_TickScheduler.WaitForNextTick());
+            }
+        }
 
-                std::this_thread::sleep_for(GAME_THREAD_SLEEP_MILLIS);
+        void GameManager::RunTicks(const size_t dueTicks)
+        {
+            const auto loopStart = std::chrono::steady_clock::now();
+            for(size_t i = 0; i < dueTicks; ++i)
+            {
+                if(m_ReplayRecorderPtr == nullptr)
+                {
+                    m_GameEnginePtr->Tick();
+                    continue;
+                }
+
+                m_GameEnginePtr->Tick(m_TickCommands);
+                m_ReplayRecorderPtr->RecordTick(m_TickCommands);
+                m_TickCommands.clear();
+                if(m_ReplayRecorderPtr->IsKeyframeDue())
+                {
+                    RecordKeyframe();
+                }
             }
-        }        
+            UpdateGameState();
+            m_LoopHistogram.Record(vector::util::Metrics::NanosSince(loopStart));
+
+            m_TickOverrunsCounter = m_TickScheduler.GetNumOverruns();
+            m_SkippedTicksCounter = m_TickScheduler.GetNumSkippedTicks();
+        }
     } // namespace game
 } // namespace vector
\ No newline at end of file
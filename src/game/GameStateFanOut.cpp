@@ -0,0 +1,195 @@
+#include "game/GameStateFanOut.h"
+#include "game/GameConstants.h"
+
+#include <algorithm>
+
+namespace vector
+{
+    namespace game
+    {
+        GameStateFanOut::GameStateFanOut(const size_t numSenderThreads, const size_t queueDepth, const GAME_STATE_UPDATE_MODE updateMode,
+                                        std::atomic<uint64_t>& updatesSentCounter, std::atomic<uint64_t>& updatesCoalescedCounter)
+            : m_QueueDepth(std::max<size_t>(queueDepth, 1))
+            , m_UpdateMode(updateMode)
+            , m_UpdatesSentCounter(updatesSentCounter)
+            , m_UpdatesCoalescedCounter(updatesCoalescedCounter)
+        {
+            const size_t numSenders = std::max<size_t>(numSenderThreads, 1);
+            m_Senders.reserve(numSenders);
+            for(size_t i = 0; i < numSenders; ++i)
+            {
+                m_Senders.emplace_back(&GameStateFanOut::Run, this);
+            }
+        }
+
+        GameStateFanOut::~GameStateFanOut()
+        {
+            Stop();
+        }
+
+        void GameStateFanOut::AddPlayer(std::shared_ptr<PlayerInterface> playerPtr)
+        {
+            std::scoped_lock<std::mutex> lock(m_Mutex);
+
+            auto channelPtr = std::make_unique<Channel>();
+            channelPtr->teamID = playerPtr->GetTeamID();
+            channelPtr->playerPtr = std::move(playerPtr);
+            if(m_UpdateMode == GAME_STATE_UPDATE_MODE::DELTA)
+            {
+                channelPtr->encoderPtr = std::make_unique<vector::sim::GameStateDeltaEncoder>(GAME_STATE_KEYFRAME_INTERVAL);
+            }
+            m_Channels.push_back(std::move(channelPtr));
+        }
+
+        void GameStateFanOut::Publish(std::shared_ptr<const vector::sim::GameState> gameStatePtr)
+        {
+            bool becameReady = false;
+
+            {
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                if(m_Stopping)
+                {
+                    return;
+                }
+
+                for(auto& channelPtr : m_Channels)
+                {
+                    becameReady |= Enqueue(*channelPtr, gameStatePtr);
+                }
+            }
+
+            if(becameReady)
+            {
+                m_ReadyCondition.notify_all();
+            }
+        }
+
+        void GameStateFanOut::Publish(const std::vector<std::shared_ptr<const vector::sim::GameState>>& teamStatePtrs)
+        {
+            bool becameReady = false;
+
+            {
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                if(m_Stopping)
+                {
+                    return;
+                }
+
+                for(auto& channelPtr : m_Channels)
+                {
+                    const vector::sim::team_ID teamID = channelPtr->teamID;
+                    if(teamID < teamStatePtrs.size() && teamStatePtrs[teamID] != nullptr)
+                    {
+                        becameReady |= Enqueue(*channelPtr, teamStatePtrs[teamID]);
+                    }
+                    else
+                    {
+                        becameReady |= Enqueue(*channelPtr, m_EmptyStatePtr);
+                    }
+                }
+            }
+
+            if(becameReady)
+            {
+                m_ReadyCondition.notify_all();
+            }
+        }
+
+        void GameStateFanOut::Flush()
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_IdleCondition.wait(lock, [this]{ return m_NumScheduled == 0 || m_Stopping; });
+        }
+
+        void GameStateFanOut::Stop()
+        {
+            {
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                m_Stopping = true;
+            }
+            m_ReadyCondition.notify_all();
+            m_IdleCondition.notify_all();
+
+            for(auto& sender : m_Senders)
+            {
+                if(sender.joinable())
+                {
+                    sender.join();
+                }
+            }
+        }
+
+        bool GameStateFanOut::Enqueue(Channel& channel, std::shared_ptr<const vector::sim::GameState> gameStatePtr)
+        {
+            // a Player a full queue behind only needs to catch up to the latest
+            if(channel.pending.size() >= m_QueueDepth)
+            {
+                m_UpdatesCoalescedCounter += channel.pending.size();
+                channel.pending.clear();
+            }
+            channel.pending.push_back(std::move(gameStatePtr));
+
+            if(channel.scheduled)
+            {
+                return false;
+            }
+
+            channel.scheduled = true;
+            ++m_NumScheduled;
+            m_ReadyChannels.push_back(&channel);
+            return true;
+        }
+
+        void GameStateFanOut::Run()
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            while(true)
+            {
+                m_ReadyCondition.wait(lock, [this]{ return m_Stopping || !m_ReadyChannels.empty(); });
+                if(m_Stopping)
+                {
+                    return;
+                }
+
+                Channel& channel = *m_ReadyChannels.front();
+                m_ReadyChannels.pop_front();
+
+                // the channel stays scheduled while it is served, so no other sender picks it up
+                std::shared_ptr<const vector::sim::GameState> gameStatePtr = std::move(channel.pending.front());
+                channel.pending.pop_front();
+
+                lock.unlock();
+                Deliver(channel, std::move(gameStatePtr));
+                lock.lock();
+
+                // one update per turn, so a slow Player cannot hold a sender while others wait
+                if(!channel.pending.empty() && !m_Stopping)
+                {
+                    m_ReadyChannels.push_back(&channel);
+                    continue;
+                }
+
+                channel.scheduled = false;
+                if(--m_NumScheduled == 0)
+                {
+                    m_IdleCondition.notify_all();
+                }
+            }
+        }
+
+        void GameStateFanOut::Deliver(Channel& channel, std::shared_ptr<const vector::sim::GameState> gameStatePtr)
+        {
+            if(channel.encoderPtr != nullptr)
+            {
+                channel.playerPtr->UpdateGameStateDelta(channel.encoderPtr->Encode(std::move(gameStatePtr)));
+            }
+            else
+            {
+                channel.playerPtr->UpdateGameState(std::move(gameStatePtr));
+            }
+
+            ++m_UpdatesSentCounter;
+        }
+    } // namespace game
+} // namespace vector
@@ -0,0 +1,232 @@
+#include "game/HeadlessMatch.h"
+
+#include "game/GameConstants.h"
+#include "game/GameManager.h"
+#include "sim/EngineEvent.h"
+#include "sim/InertialData.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace vector
+{
+    namespace game
+    {
+        static bool IsInArena(const vector::sim::InertialData& inertialData)
+        {
+            return inertialData.xCoord >= vector::sim::X_COORD_MIN && inertialData.xCoord <= vector::sim::X_COORD_MAX &&
+                inertialData.yCoord >= vector::sim::Y_COORD_MIN && inertialData.yCoord <= vector::sim::Y_COORD_MAX;
+        }
+
+        HeadlessMatch::HeadlessMatch(std::unique_ptr<vector::sim::GameEngine> gameEnginePtr)
+            : m_GameEnginePtr(std::move(gameEnginePtr))
+            , m_EventCursor(m_GameEnginePtr->SubscribeEvents())
+        {
+        }
+
+        bool HeadlessMatch::SetUnitData(const vector::sim::team_ID teamID, const std::vector<vector::game::UnitData>& unitData)
+        {
+            // there is one spawn bearing per team up to MAX_NUM_PLAYERS, past that teams would spawn on top of each other
+            if(teamID == vector::sim::UNK_TEAM_ID || teamID > MAX_NUM_PLAYERS || m_Result.ticksRun > 0 || m_TeamUnitHandles.count(teamID) > 0)
+            {
+                return false;
+            }
+
+            for(const auto& curUnit : unitData)
+            {
+                if(curUnit.unitType != vector::game::UNIT_TYPE::FIGHTER)
+                {
+                    return false;
+                }
+            }
+
+            vector::sim::MoverParams fighterParams;
+            fighterParams.maxSpeed = vector::sim::FIGHTER_SPEED_MAX;
+            fighterParams.turnRate = vector::sim::FIGHTER_TURN_RATE;
+
+            if(teamID >= m_TeamFightersLeft.size())
+            {
+                m_TeamFightersLeft.resize(teamID + 1, 0);
+            }
+
+            auto& unitHandles = m_TeamUnitHandles[teamID];
+            for(size_t i = 0; i < unitData.size(); ++i)
+            {
+                const vector::sim::MoverHandle handle = m_GameEnginePtr->AddFighter(unitData[i].callsign, teamID, fighterParams);
+                if(!handle.IsValid())
+                {
+                    continue;
+                }
+
+                m_GameEnginePtr->GetMover(handle)->SetInitialInertialData(GameManager::GetSpawnData(teamID, i, unitData.size()));
+                unitHandles[unitData[i].callsign] = handle;
+
+                if(handle.index >= m_Fighters.size())
+                {
+                    m_Fighters.resize(static_cast<size_t>(handle.index) + 1);
+                }
+                m_Fighters[handle.index] = Fighter{handle, teamID, true};
+                ++m_TeamFightersLeft[teamID];
+            }
+
+            if(m_TeamFightersLeft[teamID] > 0)
+            {
+                ++m_NumTeams;
+            }
+
+            return true;
+        }
+
+        void HeadlessMatch::AddScriptedCommand(const ScriptedCommand& scriptedCommand)
+        {
+            if(!m_Script.empty() && m_Script.back().tick > scriptedCommand.tick)
+            {
+                m_ScriptSorted = false;
+            }
+            m_Script.push_back(scriptedCommand);
+        }
+
+        MatchResult HeadlessMatch::Run(const uint64_t maxTicks)
+        {
+            // commands already applied stay where they are, the rest keep the order they were added in within a tick
+            if(!m_ScriptSorted)
+            {
+                std::stable_sort(m_Script.begin() + m_NextScriptedCommand, m_Script.end(),
+                    [](const ScriptedCommand& lhs, const ScriptedCommand& rhs) { return lhs.tick < rhs.tick; });
+                m_ScriptSorted = true;
+            }
+
+            const auto runStart = std::chrono::steady_clock::now();
+            while(m_Result.ticksRun < maxTicks && !m_Result.decided)
+            {
+                ApplyScriptedCommands();
+                m_GameEnginePtr->Tick();
+                ++m_Result.ticksRun;
+                ReadEvents();
+            }
+            m_Result.elapsedSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+            if(m_Result.elapsedSeconds > 0.0)
+            {
+                m_Result.ticksPerSecond = static_cast<double>(m_Result.ticksRun) / m_Result.elapsedSeconds;
+            }
+
+            m_Result.survivors = m_TeamFightersLeft;
+
+            return m_Result;
+        }
+
+        vector::sim::GameEngine& HeadlessMatch::GetGameEngine()
+        {
+            return *m_GameEnginePtr;
+        }
+
+        void HeadlessMatch::ApplyScriptedCommands()
+        {
+            // the match runs on this thread alone, so commands are applied directly rather than queued for the Tick
+            while(m_NextScriptedCommand < m_Script.size() && m_Script[m_NextScriptedCommand].tick <= m_Result.ticksRun)
+            {
+                const ScriptedCommand& scriptedCommand = m_Script[m_NextScriptedCommand++];
+
+                auto teamItr = m_TeamUnitHandles.find(scriptedCommand.teamID);
+                if(teamItr == m_TeamUnitHandles.end())
+                {
+                    ++m_Result.commandsUnresolved;
+                    continue;
+                }
+                auto unitItr = teamItr->second.find(scriptedCommand.cmd.subject);
+                if(unitItr == teamItr->second.end())
+                {
+                    ++m_Result.commandsUnresolved;
+                    continue;
+                }
+
+                if(!m_GameEnginePtr->InputCommand(unitItr->second, scriptedCommand.cmd))
+                {
+                    ++m_Result.commandsRejected;
+                }
+            }
+        }
+
+        void HeadlessMatch::ReadEvents()
+        {
+            const uint64_t numMissed = m_EventCursor.numMissed;
+
+            vector::sim::EngineEvent event;
+            while(m_GameEnginePtr->PollEvent(m_EventCursor, event))
+            {
+                if(event.type != vector::sim::ENGINE_EVENT_TYPE::MOVER_DESTROYED && event.type != vector::sim::ENGINE_EVENT_TYPE::OUT_OF_BOUNDS)
+                {
+                    continue;
+                }
+                if(event.handle.index >= m_Fighters.size())
+                {
+                    continue;
+                }
+
+                Fighter& fighter = m_Fighters[event.handle.index];
+                if(!fighter.alive || fighter.handle != event.handle)
+                {
+                    continue;
+                }
+
+                RemoveFighter(fighter);
+                if(event.type == vector::sim::ENGINE_EVENT_TYPE::MOVER_DESTROYED && m_Result.firstKillTick == UINT64_MAX)
+                {
+                    m_Result.firstKillTick = event.tick;
+                }
+            }
+
+            // a tick with more events than the ring holds loses some, so the fighters are checked one by one instead
+            if(m_EventCursor.numMissed != numMissed)
+            {
+                for(auto& fighter : m_Fighters)
+                {
+                    if(fighter.alive)
+                    {
+                        auto moverPtr = m_GameEnginePtr->GetMover(fighter.handle);
+                        if(moverPtr == nullptr || !moverPtr->GetStatus())
+                        {
+                            RemoveFighter(fighter);
+
+                            // the lost event may have been the first kill, a fighter that left the arena was not a kill
+                            if(m_Result.firstKillTick == UINT64_MAX && (moverPtr == nullptr || IsInArena(moverPtr->GetInertialData())))
+                            {
+                                m_Result.firstKillTick = m_Result.ticksRun - 1;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if(m_NumTeams < 2)
+            {
+                return;
+            }
+
+            size_t numTeamsLeft = 0;
+            vector::sim::team_ID lastTeamID = vector::sim::UNK_TEAM_ID;
+            for(size_t teamID = 0; teamID < m_TeamFightersLeft.size(); ++teamID)
+            {
+                if(m_TeamFightersLeft[teamID] > 0)
+                {
+                    ++numTeamsLeft;
+                    lastTeamID = static_cast<vector::sim::team_ID>(teamID);
+                }
+            }
+
+            if(numTeamsLeft <= 1)
+            {
+                m_Result.decided = true;
+                m_Result.winningTeamID = lastTeamID;
+            }
+        }
+
+        void HeadlessMatch::RemoveFighter(Fighter& fighter)
+        {
+            fighter.alive = false;
+            --m_TeamFightersLeft[fighter.teamID];
+        }
+    } // namespace game
+} // namespace vector
@@ -0,0 +1,256 @@
+#include "game/MatchHost.h"
+
+#include <algorithm>
+
+namespace vector
+{
+    namespace game
+    {
+        // orders a worker's queue as a heap with the earliest deadline on top
+        static bool IsLater(const std::chrono::steady_clock::time_point lhs, const std::chrono::steady_clock::time_point rhs)
+        {
+            return lhs > rhs;
+        }
+
+        MatchHost::MatchHost(const size_t numThreads)
+        {
+            const size_t numWorkers = std::max<size_t>(numThreads, 1);
+            for(size_t i = 0; i < numWorkers; ++i)
+            {
+                m_Queues.push_back(std::make_unique<WorkerQueue>());
+            }
+            for(size_t i = 0; i < numWorkers; ++i)
+            {
+                m_Workers.emplace_back(&MatchHost::Run, this, i);
+            }
+        }
+
+        MatchHost::~MatchHost()
+        {
+            // Games are stopped while the workers still run them, as a Game's ticks must run until it has stopped
+            std::vector<match_ID> matchIDs;
+            {
+                std::scoped_lock<std::mutex> lock(m_MatchesMutex);
+                for(const auto& match : m_Matches)
+                {
+                    matchIDs.push_back(match.first);
+                }
+            }
+            for(const match_ID matchID : matchIDs)
+            {
+                RemoveMatch(matchID);
+            }
+
+            {
+                std::scoped_lock<std::mutex> lock(m_WakeMutex);
+                m_Stopping = true;
+            }
+            m_WakeCondition.notify_all();
+
+            for(auto& worker : m_Workers)
+            {
+                worker.join();
+            }
+        }
+
+        match_ID MatchHost::AddMatch(std::unique_ptr<GameManager> gameManagerPtr)
+        {
+            if(gameManagerPtr == nullptr || !gameManagerPtr->StartHosted())
+            {
+                return 0;
+            }
+
+            auto matchPtr = std::make_shared<HostedMatch>();
+            matchPtr->gameManagerPtr = std::move(gameManagerPtr);
+            {
+                std::scoped_lock<std::mutex> lock(m_MatchesMutex);
+                matchPtr->matchID = m_NextMatchID++;
+                m_Matches.emplace(matchPtr->matchID, matchPtr);
+            }
+            ++m_MatchesAddedCounter;
+
+            // the first tick is due now, on the next worker in turn
+            const match_ID matchID = matchPtr->matchID;
+            Schedule(m_NextQueue++ % m_Queues.size(), ScheduledMatch{std::chrono::steady_clock::now(), std::move(matchPtr)});
+            {
+                std::scoped_lock<std::mutex> lock(m_WakeMutex);
+                ++m_WakeGeneration;
+            }
+            m_WakeCondition.notify_all();
+
+            return matchID;
+        }
+
+        bool MatchHost::RemoveMatch(const match_ID matchID)
+        {
+            std::shared_ptr<HostedMatch> matchPtr;
+            {
+                std::scoped_lock<std::mutex> lock(m_MatchesMutex);
+                auto matchItr = m_Matches.find(matchID);
+                if(matchItr == m_Matches.end())
+                {
+                    return false;
+                }
+                matchPtr = std::move(matchItr->second);
+                m_Matches.erase(matchItr);
+            }
+
+            // the workers keep running the Game until Stop returns, then find it removed and drop it
+            matchPtr->gameManagerPtr->Stop();
+            matchPtr->removed = true;
+            ++m_MatchesRemovedCounter;
+
+            return true;
+        }
+
+        GameManager* MatchHost::GetMatch(const match_ID matchID) const
+        {
+            std::scoped_lock<std::mutex> lock(m_MatchesMutex);
+            auto matchItr = m_Matches.find(matchID);
+            if(matchItr == m_Matches.end())
+            {
+                return nullptr;
+            }
+            return matchItr->second->gameManagerPtr.get();
+        }
+
+        size_t MatchHost::GetNumMatches() const
+        {
+            std::scoped_lock<std::mutex> lock(m_MatchesMutex);
+            return m_Matches.size();
+        }
+
+        size_t MatchHost::GetNumThreads() const
+        {
+            return m_Workers.size();
+        }
+
+        const vector::util::Metrics& MatchHost::GetMetrics() const
+        {
+            return m_Metrics;
+        }
+
+        void MatchHost::Run(const size_t workerIndex)
+        {
+            const size_t numQueues = m_Queues.size();
+
+            while(true)
+            {
+                uint64_t wakeGeneration = 0;
+                {
+                    std::scoped_lock<std::mutex> lock(m_WakeMutex);
+                    if(m_Stopping)
+                    {
+                        return;
+                    }
+                    wakeGeneration = m_WakeGeneration;
+                }
+
+                // this worker's own Games first, then any overdue on another worker that is busy
+                const auto now = std::chrono::steady_clock::now();
+                ScheduledMatch scheduled;
+                bool taken = TakeDue(workerIndex, now, scheduled);
+                for(size_t i = 1; !taken && i < numQueues; ++i)
+                {
+                    taken = TakeDue((workerIndex + i) % numQueues, now, scheduled);
+                    if(taken)
+                    {
+                        ++m_StealsCounter;
+                    }
+                }
+
+                if(!taken)
+                {
+                    const auto earliestDeadline = GetEarliestDeadline();
+                    std::unique_lock<std::mutex> lock(m_WakeMutex);
+                    auto isWoken = [&]() { return m_Stopping || m_WakeGeneration != wakeGeneration; };
+                    if(earliestDeadline == std::chrono::steady_clock::time_point::max())
+                    {
+                        m_WakeCondition.wait(lock, isWoken);
+                    }
+                    else
+                    {
+                        m_WakeCondition.wait_until(lock, earliestDeadline, isWoken);
+                    }
+                    continue;
+                }
+
+                if(scheduled.matchPtr->removed)
+                {
+                    continue;
+                }
+
+                // Games left in this worker's queue may fall due while this one runs, so a sleeping worker is
+                // woken to look for them
+                bool othersQueued = false;
+                {
+                    std::scoped_lock<std::mutex> lock(m_Queues[workerIndex]->mutex);
+                    othersQueued = !m_Queues[workerIndex]->heap.empty();
+                }
+                if(othersQueued && numQueues > 1)
+                {
+                    {
+                        std::scoped_lock<std::mutex> lock(m_WakeMutex);
+                        ++m_WakeGeneration;
+                    }
+                    m_WakeCondition.notify_one();
+                }
+
+                m_LatenessHistogram.Record(vector::util::Metrics::NanosSince(scheduled.deadline));
+                const auto runStart = std::chrono::steady_clock::now();
+                const auto nextDeadline = scheduled.matchPtr->gameManagerPtr->RunDueTicks();
+                m_RunHistogram.Record(vector::util::Metrics::NanosSince(runStart));
+                ++m_RunsCounter;
+
+                // a Game that has ended is dropped
+                if(nextDeadline == std::chrono::steady_clock::time_point::max())
+                {
+                    continue;
+                }
+
+                scheduled.deadline = nextDeadline;
+                Schedule(workerIndex, std::move(scheduled));
+            }
+        }
+
+        bool MatchHost::TakeDue(const size_t workerIndex, const std::chrono::steady_clock::time_point now, ScheduledMatch& scheduled)
+        {
+            WorkerQueue& queue = *m_Queues[workerIndex];
+            std::scoped_lock<std::mutex> lock(queue.mutex);
+            if(queue.heap.empty() || queue.heap.front().deadline > now)
+            {
+                return false;
+            }
+
+            std::pop_heap(queue.heap.begin(), queue.heap.end(),
+                [](const ScheduledMatch& lhs, const ScheduledMatch& rhs) { return IsLater(lhs.deadline, rhs.deadline); });
+            scheduled = std::move(queue.heap.back());
+            queue.heap.pop_back();
+
+            return true;
+        }
+
+        void MatchHost::Schedule(const size_t workerIndex, ScheduledMatch scheduled)
+        {
+            WorkerQueue& queue = *m_Queues[workerIndex];
+            std::scoped_lock<std::mutex> lock(queue.mutex);
+            queue.heap.push_back(std::move(scheduled));
+            std::push_heap(queue.heap.begin(), queue.heap.end(),
+                [](const ScheduledMatch& lhs, const ScheduledMatch& rhs) { return IsLater(lhs.deadline, rhs.deadline); });
+        }
+
+        std::chrono::steady_clock::time_point MatchHost::GetEarliestDeadline() const
+        {
+            std::chrono::steady_clock::time_point earliestDeadline = std::chrono::steady_clock::time_point::max();
+            for(const auto& queuePtr : m_Queues)
+            {
+                std::scoped_lock<std::mutex> lock(queuePtr->mutex);
+                if(!queuePtr->heap.empty())
+                {
+                    earliestDeadline = std::min(earliestDeadline, queuePtr->heap.front().deadline);
+                }
+            }
+            return earliestDeadline;
+        }
+    } // namespace game
+} // namespace vector
@@ -0,0 +1,130 @@
+#include "sim/CollisionSystem.h"
+#include "util/MathUtil.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vector
+{
+    namespace sim
+    {
+        // bodies per parallel task, each runs its own grid query
+        static const size_t COLLISION_BODIES_PER_TASK = 512;
+
+        CollisionSystem::CollisionSystem(const coord radius, const coord cellSize)
+            : m_Radius(radius)
+            , m_Grid(cellSize)
+        {
+        }
+
+        void CollisionSystem::ClearBodies()
+        {
+            for(const auto& body : m_Bodies)
+            {
+                m_BodyOfIndex[body.index] = NO_BODY;
+                m_Grid.Remove(body.index);
+            }
+            m_Bodies.clear();
+            m_MaxStep = 0.0;
+        }
+
+        void CollisionSystem::AddBody(const uint32_t index, const InertialData& startData, const InertialData& endData)
+        {
+            if(index >= m_BodyOfIndex.size())
+            {
+                m_BodyOfIndex.resize(index + 1, NO_BODY);
+            }
+
+            Body body;
+            body.index = index;
+            body.startX = startData.xCoord;
+            body.startY = startData.yCoord;
+            body.endX = endData.xCoord;
+            body.endY = endData.yCoord;
+            body.step = std::hypot(body.endX - body.startX, body.endY - body.startY);
+
+            m_Grid.Update(index, body.endX, body.endY);
+            m_BodyOfIndex[index] = static_cast<uint32_t>(m_Bodies.size());
+            m_MaxStep = std::max(m_MaxStep, body.step);
+            m_Bodies.push_back(body);
+        }
+
+        void CollisionSystem::Detect(vector::util::ThreadPool* poolPtr, std::vector<Collision>& collisions)
+        {
+            const size_t numBodies = m_Bodies.size();
+
+            size_t numTasks = 1;
+            if(poolPtr != nullptr && numBodies > COLLISION_BODIES_PER_TASK)
+            {
+                numTasks = std::min(poolPtr->GetNumThreads(), (numBodies + COLLISION_BODIES_PER_TASK - 1) / COLLISION_BODIES_PER_TASK);
+            }
+
+            if(m_TaskCollisions.size() < numTasks)
+            {
+                m_TaskCollisions.resize(numTasks);
+            }
+
+            // each task collects its own pairs, so nothing is shared while detecting
+            auto detectTask = [this, numTasks, numBodies](const size_t taskIndex)
+            {
+                std::vector<Collision>& taskCollisions = m_TaskCollisions[taskIndex];
+                taskCollisions.clear();
+
+                const size_t perTask = (numBodies + numTasks - 1) / numTasks;
+                const size_t begin = std::min(taskIndex * perTask, numBodies);
+                DetectRange(begin, std::min(begin + perTask, numBodies), taskCollisions);
+            };
+
+            if(numTasks == 1)
+            {
+                detectTask(0);
+            }
+            else
+            {
+                poolPtr->ParallelFor(numTasks, detectTask);
+            }
+
+            const size_t firstNew = collisions.size();
+            for(size_t task = 0; task < numTasks; ++task)
+            {
+                collisions.insert(collisions.end(), m_TaskCollisions[task].begin(), m_TaskCollisions[task].end());
+            }
+
+            // grid order depends on the history of cell moves, so the pairs are put in a fixed order
+            std::sort(collisions.begin() + firstNew, collisions.end(), [](const Collision& lhs, const Collision& rhs)
+            {
+                return lhs.firstIndex < rhs.firstIndex || (lhs.firstIndex == rhs.firstIndex && lhs.secondIndex < rhs.secondIndex);
+            });
+        }
+
+        void CollisionSystem::DetectRange(const size_t begin, const size_t end, std::vector<Collision>& collisions) const
+        {
+            const coord radiusSquared = m_Radius * m_Radius;
+
+            for(size_t i = begin; i < end; ++i)
+            {
+                const Body& body = m_Bodies[i];
+
+                // two bodies that come within the radius during the tick end it no further apart than the radius
+                // plus both their steps, and no step is longer than the longest
+                const coord searchRadius = m_Radius + body.step + m_MaxStep;
+                m_Grid.VisitRadius(body.endX, body.endY, searchRadius,
+                    [this, &body, &collisions, radiusSquared](const uint32_t index, const coord, const coord)
+                {
+                    // each pair is tested once, from its lower index
+                    if(index <= body.index)
+                    {
+                        return;
+                    }
+
+                    const Body& other = m_Bodies[m_BodyOfIndex[index]];
+                    if(vector::util::MathUtil::GetClosestApproachSquared(other.startX - body.startX, other.startY - body.startY,
+                                                                        other.endX - body.endX, other.endY - body.endY) <= radiusSquared)
+                    {
+                        collisions.push_back(Collision{body.index, other.index});
+                    }
+                });
+            }
+        }
+    } // namespace sim
+} // namespace vector
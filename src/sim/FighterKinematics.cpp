@@ -0,0 +1,341 @@
+#include "sim/FighterKinematics.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+#include "util/MathUtil.h"
+
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VECTOR_KINEMATICS_X86
+#include <immintrin.h>
+#endif
+
+namespace vector
+{
+    namespace sim
+    {
+        namespace
+        {
+            // fighters are processed in chunks small enough for the scratch arrays to stay in L1
+            constexpr size_t KINEMATICS_CHUNK_SIZE = 256;
+            constexpr uint64_t LANE_MASK_SET = UINT64_MAX;
+
+            struct ChunkScratch
+            {
+                alignas(32) double sines[KINEMATICS_CHUNK_SIZE];
+                alignas(32) double cosines[KINEMATICS_CHUNK_SIZE];
+                alignas(32) uint64_t turning[KINEMATICS_CHUNK_SIZE];
+                alignas(32) uint64_t live[KINEMATICS_CHUNK_SIZE];
+            };
+
+            /**
+             * @brief Resolve the integer turn logic for a chunk without branching, and look up the
+             * trig of each fighter's pre-turn heading, which is what its position update uses
+             * 
+             */
+            void PrepareChunk(const FighterBatch& batch, const size_t begin, const size_t count, ChunkScratch& scratch)
+            {
+                for(size_t lane = 0; lane < count; ++lane)
+                {
+                    const size_t i = begin + lane;
+                    const angle curHeading = batch.headings[i];
+                    const angle desiredHeading = batch.desiredHeadings[i];
+                    const bool live = batch.statuses[i] != 0;
+                    const bool turning = curHeading != desiredHeading;
+                    const bool turnRight = (HEADING_FULL_CIRCLE + curHeading - desiredHeading) > HEADING_HALF_CIRCLE;
+
+                    const angle rightHeading = (HEADING_FULL_CIRCLE + curHeading + FIGHTER_TURN_RATE) % HEADING_FULL_CIRCLE;
+                    const angle leftHeading = (HEADING_FULL_CIRCLE + curHeading - FIGHTER_TURN_RATE) % HEADING_FULL_CIRCLE;
+                    const angle turnHeading = turnRight ? rightHeading : leftHeading;
+
+                    scratch.sines[lane] = vector::util::MathUtil::GetHeadingSine(curHeading);
+                    scratch.cosines[lane] = vector::util::MathUtil::GetHeadingCosine(curHeading);
+                    scratch.turning[lane] = turning ? LANE_MASK_SET : 0;
+                    scratch.live[lane] = live ? LANE_MASK_SET : 0;
+
+                    batch.headings[i] = (live && turning) ? turnHeading : curHeading;
+                }
+            }
+
+            void FinishLaneScalar(const FighterBatch& batch, const size_t i, const ChunkScratch& scratch, const size_t lane)
+            {
+                if(scratch.live[lane])
+                {
+                    const speed curSpeed = batch.speeds[i];
+                    const coord newX = batch.xCoords[i] + (curSpeed * scratch.sines[lane]);
+                    const coord newY = batch.yCoords[i] + (curSpeed * scratch.cosines[lane]);
+
+                    batch.speeds[i] = scratch.turning[lane] ? std::max(SPEED_MIN, (curSpeed - FIGHTER_ACCL_DCCL))
+                                                            : std::min(SPEED_MAX, (curSpeed + FIGHTER_ACCL_DCCL));
+                    batch.xCoords[i] = newX;
+                    batch.yCoords[i] = newY;
+
+                    if(newX < X_COORD_MIN || newX > X_COORD_MAX || newY < Y_COORD_MIN || newY > Y_COORD_MAX)
+                    {
+                        batch.statuses[i] = false;
+                    }
+                }
+            }
+
+            void MoveChunkScalar(const FighterBatch& batch, const size_t begin, const size_t count, const ChunkScratch& scratch)
+            {
+                for(size_t lane = 0; lane < count; ++lane)
+                {
+                    FinishLaneScalar(batch, begin + lane, scratch, lane);
+                }
+            }
+
+#ifdef VECTOR_KINEMATICS_X86
+            // Blends are done with and/andnot/or rather than blendv so that the SSE2 path needs nothing newer.
+            // Only separate multiplies and adds are used, never FMA, to stay bit-identical with the scalar Move.
+
+            __attribute__((target("sse2")))
+            void MoveChunkSse2(const FighterBatch& batch, const size_t begin, const size_t count, const ChunkScratch& scratch)
+            {
+                constexpr size_t WIDTH = 2;
+
+                const __m128d speedMin = _mm_set1_pd(SPEED_MIN);
+                const __m128d speedMax = _mm_set1_pd(SPEED_MAX);
+                const __m128d accel = _mm_set1_pd(FIGHTER_ACCL_DCCL);
+                const __m128d xMin = _mm_set1_pd(X_COORD_MIN);
+                const __m128d xMax = _mm_set1_pd(X_COORD_MAX);
+                const __m128d yMin = _mm_set1_pd(Y_COORD_MIN);
+                const __m128d yMax = _mm_set1_pd(Y_COORD_MAX);
+
+                size_t lane = 0;
+                for(; lane + WIDTH <= count; lane += WIDTH)
+                {
+                    const size_t i = begin + lane;
+
+                    const __m128d live = _mm_castsi128_pd(_mm_load_si128(reinterpret_cast<const __m128i*>(&scratch.live[lane])));
+                    const __m128d turning = _mm_castsi128_pd(_mm_load_si128(reinterpret_cast<const __m128i*>(&scratch.turning[lane])));
+
+                    const __m128d curSpeed = _mm_loadu_pd(&batch.speeds[i]);
+                    const __m128d curX = _mm_loadu_pd(&batch.xCoords[i]);
+                    const __m128d curY = _mm_loadu_pd(&batch.yCoords[i]);
+
+                    const __m128d newX = _mm_add_pd(curX, _mm_mul_pd(curSpeed, _mm_load_pd(&scratch.sines[lane])));
+                    const __m128d newY = _mm_add_pd(curY, _mm_mul_pd(curSpeed, _mm_load_pd(&scratch.cosines[lane])));
+
+                    const __m128d slowed = _mm_max_pd(_mm_sub_pd(curSpeed, accel), speedMin);
+                    const __m128d accelerated = _mm_min_pd(_mm_add_pd(curSpeed, accel), speedMax);
+                    const __m128d newSpeed = _mm_or_pd(_mm_and_pd(turning, slowed), _mm_andnot_pd(turning, accelerated));
+
+                    _mm_storeu_pd(&batch.speeds[i], _mm_or_pd(_mm_and_pd(live, newSpeed), _mm_andnot_pd(live, curSpeed)));
+                    _mm_storeu_pd(&batch.xCoords[i], _mm_or_pd(_mm_and_pd(live, newX), _mm_andnot_pd(live, curX)));
+                    _mm_storeu_pd(&batch.yCoords[i], _mm_or_pd(_mm_and_pd(live, newY), _mm_andnot_pd(live, curY)));
+
+                    const __m128d outOfBounds = _mm_or_pd(_mm_or_pd(_mm_cmplt_pd(newX, xMin), _mm_cmpgt_pd(newX, xMax)),
+                                                          _mm_or_pd(_mm_cmplt_pd(newY, yMin), _mm_cmpgt_pd(newY, yMax)));
+                    const int destroyedMask = _mm_movemask_pd(_mm_and_pd(live, outOfBounds));
+
+                    for(size_t bit = 0; bit < WIDTH; ++bit)
+                    {
+                        if(destroyedMask & (1 << bit))
+                        {
+                            batch.statuses[i + bit] = false;
+                        }
+                    }
+                }
+
+                for(; lane < count; ++lane)
+                {
+                    FinishLaneScalar(batch, begin + lane, scratch, lane);
+                }
+            }
+
+            __attribute__((target("avx2")))
+            void MoveChunkAvx2(const FighterBatch& batch, const size_t begin, const size_t count, const ChunkScratch& scratch)
+            {
+                constexpr size_t WIDTH = 4;
+
+                const __m256d speedMin = _mm256_set1_pd(SPEED_MIN);
+                const __m256d speedMax = _mm256_set1_pd(SPEED_MAX);
+                const __m256d accel = _mm256_set1_pd(FIGHTER_ACCL_DCCL);
+                const __m256d xMin = _mm256_set1_pd(X_COORD_MIN);
+                const __m256d xMax = _mm256_set1_pd(X_COORD_MAX);
+                const __m256d yMin = _mm256_set1_pd(Y_COORD_MIN);
+                const __m256d yMax = _mm256_set1_pd(Y_COORD_MAX);
+
+                size_t lane = 0;
+                for(; lane + WIDTH <= count; lane += WIDTH)
+                {
+                    const size_t i = begin + lane;
+
+                    const __m256d live = _mm256_castsi256_pd(_mm256_load_si256(reinterpret_cast<const __m256i*>(&scratch.live[lane])));
+                    const __m256d turning = _mm256_castsi256_pd(_mm256_load_si256(reinterpret_cast<const __m256i*>(&scratch.turning[lane])));
+
+                    const __m256d curSpeed = _mm256_loadu_pd(&batch.speeds[i]);
+                    const __m256d curX = _mm256_loadu_pd(&batch.xCoords[i]);
+                    const __m256d curY = _mm256_loadu_pd(&batch.yCoords[i]);
+
+                    const __m256d newX = _mm256_add_pd(curX, _mm256_mul_pd(curSpeed, _mm256_load_pd(&scratch.sines[lane])));
+                    const __m256d newY = _mm256_add_pd(curY, _mm256_mul_pd(curSpeed, _mm256_load_pd(&scratch.cosines[lane])));
+
+                    const __m256d slowed = _mm256_max_pd(_mm256_sub_pd(curSpeed, accel), speedMin);
+                    const __m256d accelerated = _mm256_min_pd(_mm256_add_pd(curSpeed, accel), speedMax);
+                    const __m256d newSpeed = _mm256_or_pd(_mm256_and_pd(turning, slowed), _mm256_andnot_pd(turning, accelerated));
+
+                    _mm256_storeu_pd(&batch.speeds[i], _mm256_or_pd(_mm256_and_pd(live, newSpeed), _mm256_andnot_pd(live, curSpeed)));
+                    _mm256_storeu_pd(&batch.xCoords[i], _mm256_or_pd(_mm256_and_pd(live, newX), _mm256_andnot_pd(live, curX)));
+                    _mm256_storeu_pd(&batch.yCoords[i], _mm256_or_pd(_mm256_and_pd(live, newY), _mm256_andnot_pd(live, curY)));
+
+                    const __m256d outOfBounds = _mm256_or_pd(
+                        _mm256_or_pd(_mm256_cmp_pd(newX, xMin, _CMP_LT_OQ), _mm256_cmp_pd(newX, xMax, _CMP_GT_OQ)),
+                        _mm256_or_pd(_mm256_cmp_pd(newY, yMin, _CMP_LT_OQ), _mm256_cmp_pd(newY, yMax, _CMP_GT_OQ)));
+                    const int destroyedMask = _mm256_movemask_pd(_mm256_and_pd(live, outOfBounds));
+
+                    for(size_t bit = 0; bit < WIDTH; ++bit)
+                    {
+                        if(destroyedMask & (1 << bit))
+                        {
+                            batch.statuses[i + bit] = false;
+                        }
+                    }
+                }
+
+                for(; lane < count; ++lane)
+                {
+                    FinishLaneScalar(batch, begin + lane, scratch, lane);
+                }
+            }
+#endif // VECTOR_KINEMATICS_X86
+
+            KINEMATICS_ISA DetectBestIsa()
+            {
+#ifdef VECTOR_KINEMATICS_X86
+                __builtin_cpu_init();
+                if(__builtin_cpu_supports("avx2"))
+                {
+                    return KINEMATICS_ISA::AVX2;
+                }
+                if(__builtin_cpu_supports("sse2"))
+                {
+                    return KINEMATICS_ISA::SSE2;
+                }
+#endif
+                return KINEMATICS_ISA::SCALAR;
+            }
+        } // namespace
+
+        bool FighterKinematics::Move(InertialData& inertialData, const angle desiredHeading)
+        {
+            InertialData newInertial = inertialData;
+            if(inertialData.curHeading != desiredHeading)
+            {
+                angle newHeading = inertialData.curHeading;
+
+                // turn right
+                if( (HEADING_FULL_CIRCLE + inertialData.curHeading - desiredHeading) > HEADING_HALF_CIRCLE)
+                {
+                    newHeading = (HEADING_FULL_CIRCLE + inertialData.curHeading + FIGHTER_TURN_RATE) % HEADING_FULL_CIRCLE;
+                }
+                // turn left
+                else
+                {
+                    newHeading = (HEADING_FULL_CIRCLE + inertialData.curHeading - FIGHTER_TURN_RATE) % HEADING_FULL_CIRCLE;
+                }
+
+                newInertial.curHeading = newHeading;
+
+                // turn decreases speed
+                newInertial.curSpeed = std::max(SPEED_MIN, (inertialData.curSpeed - FIGHTER_ACCL_DCCL));
+            }
+            else
+            {
+                // flying straight increases speed
+                newInertial.curSpeed = std::min(SPEED_MAX, (inertialData.curSpeed + FIGHTER_ACCL_DCCL));
+            }
+
+            vector::util::VelocityComponents velocity = vector::util::MathUtil::GetVelocityComponents(inertialData.curSpeed, inertialData.curHeading);
+            newInertial.xCoord = inertialData.xCoord + velocity.xComponent;
+            newInertial.yCoord = inertialData.yCoord + velocity.yComponent;
+
+            inertialData = newInertial;
+
+            return !(newInertial.xCoord < X_COORD_MIN || newInertial.xCoord > X_COORD_MAX ||
+                        newInertial.yCoord < Y_COORD_MIN || newInertial.yCoord > Y_COORD_MAX);
+        }
+
+        void FighterKinematics::MoveBatch(const FighterBatch& batch)
+        {
+            MoveBatch(batch, GetBestIsa());
+        }
+
+        void FighterKinematics::MoveBatch(const FighterBatch& batch, const KINEMATICS_ISA isa)
+        {
+            ChunkScratch scratch;
+
+            for(size_t begin = 0; begin < batch.count; begin += KINEMATICS_CHUNK_SIZE)
+            {
+                const size_t count = std::min(KINEMATICS_CHUNK_SIZE, batch.count - begin);
+
+                PrepareChunk(batch, begin, count, scratch);
+
+                switch(isa)
+                {
+#ifdef VECTOR_KINEMATICS_X86
+                    case KINEMATICS_ISA::AVX2:
+                    {
+                        MoveChunkAvx2(batch, begin, count, scratch);
+                        break;
+                    }
+                    case KINEMATICS_ISA::SSE2:
+                    {
+                        MoveChunkSse2(batch, begin, count, scratch);
+                        break;
+                    }
+#endif
+                    case KINEMATICS_ISA::SCALAR:
+                    default:
+                    {
+                        MoveChunkScalar(batch, begin, count, scratch);
+                        break;
+                    }
+                }
+            }
+        }
+
+        bool FighterKinematics::IsIsaSupported(const KINEMATICS_ISA isa)
+        {
+            switch(isa)
+            {
+#ifdef VECTOR_KINEMATICS_X86
+                case KINEMATICS_ISA::AVX2:
+                {
+                    return GetBestIsa() == KINEMATICS_ISA::AVX2;
+                }
+                case KINEMATICS_ISA::SSE2:
+                {
+                    return GetBestIsa() != KINEMATICS_ISA::SCALAR;
+                }
+#endif
+                case KINEMATICS_ISA::SCALAR:
+                {
+                    return true;
+                }
+                default:
+                    return false;
+            }
+        }
+
+        KINEMATICS_ISA FighterKinematics::GetBestIsa()
+        {
+            static const KINEMATICS_ISA bestIsa = DetectBestIsa();
+            return bestIsa;
+        }
+
+        bool FighterKinematics::IsValidInitialInertialData(const InertialData& inertialData)
+        {
+            return inertialData.curHeading >= HEADING_MIN && inertialData.curHeading <= HEADING_MAX &&
+                inertialData.curSpeed >= SPEED_MIN && inertialData.curSpeed <= FIGHTER_SPEED_MAX &&
+                inertialData.xCoord >= X_COORD_MIN && inertialData.yCoord >= Y_COORD_MIN &&
+                inertialData.xCoord <= X_COORD_MAX && inertialData.yCoord <= Y_COORD_MAX;
+        }
+
+        bool FighterKinematics::IsValidHeading(const angle heading)
+        {
+            return heading >= HEADING_MIN && heading <= HEADING_MAX;
+        }
+    } // namespace sim
+} // namespace vector
@@ -1,8 +1,5 @@
 #include "sim/FighterMover.h"
-#include "sim/SimConstants.h"
-#include "util/MathUtil.h"
-
-#include <algorithm>
+#include "sim/FighterKinematics.h"
 
 namespace vector
 {
@@ -25,48 +22,15 @@ namespace vector
 
         void FighterMover::Move()
         {
-            InertialData newInertial = m_InertialData;
-            if(m_InertialData.curHeading != m_DesiredHeading)
-            {
-                angle newHeading = m_InertialData.curHeading;
-
-                // turn right
-                if( (HEADING_FULL_CIRCLE + m_InertialData.curHeading - m_DesiredHeading) > HEADING_HALF_CIRCLE)
-                {
-                    newHeading = (HEADING_FULL_CIRCLE + m_InertialData.curHeading + FIGHTER_TURN_RATE) % HEADING_FULL_CIRCLE;
-                }
-                // turn left
-                else
-                {
-                    newHeading = (HEADING_FULL_CIRCLE + m_InertialData.curHeading - FIGHTER_TURN_RATE) % HEADING_FULL_CIRCLE;
-                }
-
-                newInertial.curHeading = newHeading;
-                
-                // turn decreases speed
-                newInertial.curSpeed = std::max(SPEED_MIN, (m_InertialData.curSpeed - FIGHTER_ACCL_DCCL));
-            }
-            else
-            {
-                // flying straight increases speed
-                newInertial.curSpeed = std::min(SPEED_MAX, (m_InertialData.curSpeed + FIGHTER_ACCL_DCCL));
-            }
-            
-            newInertial.xCoord = m_InertialData.xCoord + vector::util::MathUtil::GetXComponentOfSpeed(m_InertialData.curSpeed, m_InertialData.curHeading);;
-            newInertial.yCoord = m_InertialData.yCoord + vector::util::MathUtil::GetYComponentOfSpeed(m_InertialData.curSpeed, m_InertialData.curHeading);;
-
-            if(newInertial.xCoord < vector::sim::X_COORD_MIN || newInertial.xCoord > vector::sim::X_COORD_MAX ||
-                newInertial.yCoord < vector::sim::Y_COORD_MIN || newInertial.yCoord > vector::sim::Y_COORD_MAX)
+            if(!FighterKinematics::Move(m_InertialData, m_DesiredHeading))
             {
                 m_Status = false;
             }
-
-            m_InertialData = newInertial;
         }
 
         bool FighterMover::SetNewHeading(const angle newHeadingDegrees)
         {
-            if(newHeadingDegrees >= HEADING_MIN && newHeadingDegrees <= HEADING_MAX)
+            if(FighterKinematics::IsValidHeading(newHeadingDegrees))
             {
                 m_DesiredHeading = newHeadingDegrees;
                 return true;
@@ -75,12 +39,14 @@ namespace vector
             return false;
         }
 
+        angle FighterMover::GetDesiredHeading() const
+        {
+            return m_DesiredHeading;
+        }
+
         bool FighterMover::SetInitialInertialData(const InertialData initialInertialData)
         {
-            if(initialInertialData.curHeading >= HEADING_MIN && initialInertialData.curHeading <= HEADING_MAX && 
-                initialInertialData.curSpeed >= SPEED_MIN && initialInertialData.curSpeed <= FIGHTER_SPEED_MAX &&
-                initialInertialData.xCoord >= X_COORD_MIN && initialInertialData.yCoord >= Y_COORD_MIN &&
-                initialInertialData.xCoord <= X_COORD_MAX && initialInertialData.yCoord <= Y_COORD_MAX)
+            if(FighterKinematics::IsValidInitialInertialData(initialInertialData))
             {
                 m_InertialData.curHeading = initialInertialData.curHeading;
                 m_InertialData.curSpeed = initialInertialData.curSpeed;
@@ -115,6 +81,11 @@ namespace vector
             return m_TeamID;
         }
 
+        MoverParams FighterMover::GetPerformanceValues() const
+        {
+            return m_PerformanceValues;
+        }
+
         std::string FighterMover::ToString() const
         {
             return "" + m_ID + "\nx: " + std::to_string(m_InertialData.xCoord) + "\ny: " + std::to_string(m_InertialData.yCoord) +
@@ -1,135 +1,1433 @@
 #include "sim/GameEngine.h"
 #include "sim/GameState.h"
+#include "sim/MoverStoreView.h"
+#include "util/MathUtil.h"
 
-#include <stdexcept>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <string_view>
+#include <unordered_set>
 
 namespace vector
 {
     namespace sim
     {
-        bool GameEngine::AddMover(std::shared_ptr<MoverInterface> moverPtr)
+        // fighters per parallel task, large enough to amortise claiming a task
+        static const size_t STORED_FIGHTERS_PER_TASK = 1024;
+
+        static bool IsInArena(const InertialData& inertialData)
         {
-            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+            return inertialData.xCoord >= X_COORD_MIN && inertialData.xCoord <= X_COORD_MAX &&
+                inertialData.yCoord >= Y_COORD_MIN && inertialData.yCoord <= Y_COORD_MAX;
+        }
+
+        // every entry is free, a stored fighter or a missile in flight, and listed as such exactly once; the IDs of
+        // fighters are unique, and each team's contacts are of entries, in index order
+        static bool IsConsistentCheckpoint(const EngineCheckpoint& checkpoint, const size_t missileCapacity)
+        {
+            const size_t numEntries = checkpoint.entries.size();
+            if(numEntries >= INVALID_MOVER_INDEX ||
+                checkpoint.freeEntries.size() + checkpoint.storeOrder.size() + checkpoint.missileEntries.size() != numEntries ||
+                checkpoint.missileEntries.size() > missileCapacity || checkpoint.teamContacts.size() > UINT8_MAX + 1)
+            {
+                return false;
+            }
 
-            if(m_AllMoversMap.find(moverPtr->GetID()) == m_AllMoversMap.end())
+            std::vector<uint8_t> listed(numEntries, 0);
+            auto isListedAs = [&checkpoint, &listed, numEntries](const std::vector<uint32_t>& indices, const CHECKPOINT_ENTRY_TYPE type)
             {
-                m_AllMoversMap.emplace(moverPtr->GetID(), std::move(moverPtr));
+                for(const uint32_t index : indices)
+                {
+                    if(index >= numEntries || listed[index] != 0 || checkpoint.entries[index].type != type)
+                    {
+                        return false;
+                    }
+                    listed[index] = 1;
+                }
                 return true;
+            };
+            if(!isListedAs(checkpoint.freeEntries, CHECKPOINT_ENTRY_TYPE::FREE) ||
+                !isListedAs(checkpoint.storeOrder, CHECKPOINT_ENTRY_TYPE::FIGHTER) ||
+                !isListedAs(checkpoint.missileEntries, CHECKPOINT_ENTRY_TYPE::MISSILE))
+            {
+                return false;
+            }
+
+            std::unordered_set<std::string_view> fighterIDs;
+            for(const uint32_t index : checkpoint.storeOrder)
+            {
+                if(!fighterIDs.insert(checkpoint.entries[index].ID).second)
+                {
+                    return false;
+                }
+            }
+
+            for(const auto& contacts : checkpoint.teamContacts)
+            {
+                for(size_t i = 0; i < contacts.size(); ++i)
+                {
+                    if(contacts[i].index >= numEntries || (i > 0 && contacts[i].index <= contacts[i - 1].index))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        // a missile's ID is its launcher's followed by -M and the number launched so far, the launcher's cut short
+        // where both do not fit, so the ID stays unique
+        static size_t FormatMissileID(const std::string_view launcherID, const uint64_t launchNumber, std::array<char, MISSILE_ID_SIZE>& missileID)
+        {
+            std::array<char, 24> suffix;
+            suffix[0] = '-';
+            suffix[1] = 'M';
+            const char* suffixEnd = std::to_chars(suffix.data() + 2, suffix.data() + suffix.size(), launchNumber).ptr;
+            const size_t suffixLength = static_cast<size_t>(suffixEnd - suffix.data());
+
+            const size_t prefixLength = std::min(launcherID.size(), MISSILE_ID_SIZE - suffixLength);
+            std::copy_n(launcherID.data(), prefixLength, missileID.data());
+            std::copy_n(suffix.data(), suffixLength, missileID.data() + prefixLength);
+            return prefixLength + suffixLength;
+        }
+
+        GameEngine::GameEngine(const size_t numTickThreads)
+        {
+            if(numTickThreads > 1)
+            {
+                m_TickPoolPtr = std::make_unique<vector::util::ThreadPool>(std::min(numTickThreads, MAX_TICK_THREADS));
+            }
+        }
+
+        MoverHandle GameEngine::AddMover(std::shared_ptr<MoverInterface> moverPtr)
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            if(IsIDInUse(moverPtr->GetID()))
+            {
+                return MoverHandle();
+            }
+
+            MoverHandle handle = AllocateEntry();
+            // overwrites any stale handle left behind by a removed Mover with the same ID
+            m_MoverHandles[moverPtr->GetID()] = handle;
+            ++m_MoversAddedCounter;
+            m_EntryTeams[handle.index] = moverPtr->GetTeam();
+            m_MoverEntries[handle.index].missilesRemaining = moverPtr->GetPerformanceValues().numMissiles;
+            m_MoverEntries[handle.index].moverPtr = std::move(moverPtr);
+            ++m_NumMoverObjects;
+            m_StateStale = true;
+
+            EngineEvent event;
+            event.type = ENGINE_EVENT_TYPE::MOVER_ADDED;
+            event.handle = handle;
+            event.teamID = m_EntryTeams[handle.index];
+            PublishEvent(event);
+
+            return handle;
+        }
+
+        MoverHandle GameEngine::AddFighter(const std::string& ID, const vector::sim::team_ID teamID, const MoverParams performanceValues)
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            if(IsIDInUse(ID))
+            {
+                return MoverHandle();
+            }
+
+            MoverHandle handle = AllocateEntry();
+            m_MoverHandles[ID] = handle;
+            ++m_MoversAddedCounter;
+            m_EntryTeams[handle.index] = teamID;
+            store_slot slot = m_MoverStore.Add(ID, teamID, performanceValues);
+            m_MoverEntries[handle.index].storeSlot = slot;
+            m_MoverEntries[handle.index].missilesRemaining = performanceValues.numMissiles;
+
+            if(slot >= m_StoreSlotToEntry.size())
+            {
+                m_StoreSlotToEntry.resize(slot + 1, INVALID_MOVER_INDEX);
+            }
+            m_StoreSlotToEntry[slot] = handle.index;
+            m_StateStale = true;
+
+            EngineEvent event;
+            event.type = ENGINE_EVENT_TYPE::MOVER_ADDED;
+            event.handle = handle;
+            event.teamID = teamID;
+            PublishEvent(event);
+
+            return handle;
+        }
+
+        MoverHandle GameEngine::GetMoverHandle(const std::string& moverID) const
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            auto handleItr = m_MoverHandles.find(moverID);
+            if(handleItr != m_MoverHandles.end() && IsCurrent(handleItr->second))
+            {
+                return handleItr->second;
             }
 
-            return false;
+            return MoverHandle();
         }
 
         std::shared_ptr<MoverInterface> GameEngine::GetMover(const std::string& moverID)
         {
             std::scoped_lock<std::mutex> lock(m_MoversMutex);
 
-            auto moverItr = m_AllMoversMap.find(moverID);
-            if(moverItr != m_AllMoversMap.end())
+            auto handleItr = m_MoverHandles.find(moverID);
+            if(handleItr != m_MoverHandles.end())
             {
-                return moverItr->second;
+                return FindMover(handleItr->second);
             }
 
             return nullptr;
         }
 
+        std::shared_ptr<MoverInterface> GameEngine::GetMover(const MoverHandle handle)
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            return FindMover(handle);
+        }
+
+        bool GameEngine::IsIDInUse(const std::string& moverID) const
+        {
+            auto handleItr = m_MoverHandles.find(moverID);
+            return handleItr != m_MoverHandles.end() && IsCurrent(handleItr->second);
+        }
+
+        bool GameEngine::IsCurrent(const MoverHandle handle) const
+        {
+            return handle.index < m_MoverEntries.size() &&
+                m_MoverEntries[handle.index].occupied &&
+                m_MoverEntries[handle.index].generation == handle.generation;
+        }
+
+        MoverHandle GameEngine::AllocateEntry()
+        {
+            MoverHandle handle;
+
+            // reuse the most recently freed entry while it is still warm in cache
+            if(!m_FreeEntries.empty())
+            {
+                handle.index = m_FreeEntries.back();
+                m_FreeEntries.pop_back();
+            }
+            else
+            {
+                handle.index = static_cast<uint32_t>(m_MoverEntries.size());
+                m_MoverEntries.emplace_back();
+                m_EntryTeams.push_back(UNK_TEAM_ID);
+                m_StartData.emplace_back();
+            }
+
+            MoverEntry& entry = m_MoverEntries[handle.index];
+            entry.occupied = true;
+            handle.generation = entry.generation;
+
+            return handle;
+        }
+
+        void GameEngine::ReleaseEntry(const uint32_t index)
+        {
+            MoverEntry& entry = m_MoverEntries[index];
+
+            if(entry.moverPtr != nullptr)
+            {
+                --m_NumMoverObjects;
+            }
+
+            m_SpatialGrid.Remove(index);
+
+            EngineEvent event;
+            event.type = ENGINE_EVENT_TYPE::MOVER_REMOVED;
+            event.handle = MoverHandle{index, entry.generation};
+            event.teamID = m_EntryTeams[index];
+            PublishEvent(event);
+
+            if(entry.missilePtr != nullptr)
+            {
+                m_MissilePool.Release(entry.missilePtr);
+                entry.missilePtr = nullptr;
+            }
+
+            entry.occupied = false;
+            entry.moverPtr.reset();
+            entry.storeSlot = INVALID_STORE_SLOT;
+            entry.lockedTarget = MoverHandle();
+            entry.missilesRemaining = 0;
+            // outstanding handles to this entry no longer match
+            ++entry.generation;
+
+            m_FreeEntries.push_back(index);
+        }
+
+        std::shared_ptr<MoverInterface> GameEngine::FindMover(const MoverHandle handle)
+        {
+            if(!IsCurrent(handle))
+            {
+                return nullptr;
+            }
+
+            // the caller may alter the Mover, so the next snapshot request must not reuse the published one
+            m_StateStale = true;
+
+            const MoverEntry& entry = m_MoverEntries[handle.index];
+            if(entry.missilePtr != nullptr)
+            {
+                return nullptr;
+            }
+
+            if(entry.moverPtr != nullptr)
+            {
+                return entry.moverPtr;
+            }
+
+            return std::make_shared<MoverStoreView>(m_MoverStore, entry.storeSlot);
+        }
+
         bool GameEngine::InputCommand(util::Command cmd)
         {
+            return InputCommand(GetMoverHandle(cmd.subject), cmd);
+        }
+
+        bool GameEngine::InputCommand(const MoverHandle subjectHandle, const util::Command& cmd)
+        {
+            const auto lockStart = std::chrono::steady_clock::now();
             std::scoped_lock<std::mutex> lock(m_MoversMutex);
+            m_CommandLockWaitHistogram.Record(vector::util::Metrics::NanosSince(lockStart));
+
+            return ApplyCommand(subjectHandle, cmd);
+        }
+
+        std::future<bool> GameEngine::QueueCommand(const MoverHandle subjectHandle, const util::Command& cmd)
+        {
+            QueuedCommand queuedCommand;
+            queuedCommand.subjectHandle = subjectHandle;
+            queuedCommand.cmd = cmd;
+            std::future<bool> result = queuedCommand.resultPromise.get_future();
+
+            if(m_CommandQueue.TryPush(std::move(queuedCommand)))
+            {
+                ++m_CommandsQueuedCounter;
+            }
+            else
+            {
+                // not moved from when the queue is full
+                ++m_CommandsDroppedCounter;
+                queuedCommand.resultPromise.set_value(false);
+            }
+
+            return result;
+        }
 
-            auto subject = m_AllMoversMap.find(cmd.subject);
+        bool GameEngine::ApplyCommand(const MoverHandle subjectHandle, const util::Command& cmd)
+        {
+            EngineEvent rejectedEvent;
+            rejectedEvent.type = ENGINE_EVENT_TYPE::COMMAND_REJECTED;
+            rejectedEvent.handle = subjectHandle;
+            rejectedEvent.command = cmd.command;
+
+            if(!IsCurrent(subjectHandle))
+            {
+                ++m_CommandsRejectedCounter;
+                PublishEvent(rejectedEvent);
+                return false;
+            }
+
+            MoverEntry& entry = m_MoverEntries[subjectHandle.index];
             bool result = true;
+            rejectedEvent.teamID = m_EntryTeams[subjectHandle.index];
+
+            // missiles fly themselves
+            if(entry.missilePtr != nullptr)
+            {
+                ++m_CommandsRejectedCounter;
+                PublishEvent(rejectedEvent);
+                return false;
+            }
 
-            if(subject != m_AllMoversMap.end())
+            switch(cmd.command)
             {
-                switch(cmd.command)
+                case vector::util::COMMAND_TYPE::VECTOR:
                 {
-                    case vector::util::COMMAND_TYPE::VECTOR:
+                    // the heading was range checked when the command was parsed, but a payload built in code is not
+                    const vector::util::HeadingPayload* headingPayload = std::get_if<vector::util::HeadingPayload>(&cmd.payload);
+                    if(headingPayload == nullptr)
                     {
-                        try
-                        {
-                            subject->second->SetNewHeading(std::stoi(cmd.object));
-                        }
-                        catch (const std::invalid_argument& e)
-                        {
-                            result = false;
-                        }
-                        catch(const std::out_of_range& e)
-                        {
-                            result = false;
-                        }
+                        result = false;
                         break;
                     }
-                    case vector::util::COMMAND_TYPE::IDENTIFY:
+
+                    // stored fighters are commanded in place rather than through a view
+                    const angle newHeading = static_cast<angle>(headingPayload->heading);
+                    if(entry.moverPtr != nullptr)
                     {
-                        break;
+                        result = entry.moverPtr->SetNewHeading(newHeading);
                     }
-                    case vector::util::COMMAND_TYPE::AQUIRE:
+                    else
                     {
-                        break;
+                        result = m_MoverStore.SetNewHeading(entry.storeSlot, newHeading);
                     }
-                    case vector::util::COMMAND_TYPE::LAUNCH:
+                    break;
+                }
+                case vector::util::COMMAND_TYPE::IDENTIFY:
+                {
+                    // only a contact held by the subject's team can be identified
+                    const MoverHandle targetHandle = ResolveTarget(cmd);
+                    result = targetHandle.IsValid() && m_Radar.Identify(m_EntryTeams[subjectHandle.index], targetHandle.index);
+                    break;
+                }
+                case vector::util::COMMAND_TYPE::AQUIRE:
+                {
+                    const MoverHandle targetHandle = ResolveTarget(cmd);
+                    result = targetHandle.IsValid() && m_Radar.IsContact(m_EntryTeams[subjectHandle.index], targetHandle.index);
+                    if(result)
                     {
-                        break;
+                        entry.lockedTarget = targetHandle;
                     }
-                    case vector::util::COMMAND_TYPE::UNK:
-                    default:
                     break;
                 }
+                case vector::util::COMMAND_TYPE::LAUNCH:
+                {
+                    // only at the target the subject has locked on to; entry is not used after launching,
+                    // which may grow the Mover table
+                    const MoverHandle targetHandle = ResolveTarget(cmd);
+                    result = targetHandle.IsValid() && targetHandle == entry.lockedTarget &&
+                                LaunchMissile(subjectHandle.index, targetHandle);
+                    break;
+                }
+                case vector::util::COMMAND_TYPE::UNK:
+                default:
+                break;
+            }
+
+            if(result)
+            {
+                ++m_CommandsProcessedCounter;
             }
             else
             {
-                result = false;
+                ++m_CommandsRejectedCounter;
+                PublishEvent(rejectedEvent);
             }
 
             return result;
         }
 
         GameState GameEngine::GetGameState() const
+        {
+            return *GetGameStateSnapshot();
+        }
+
+        std::shared_ptr<const GameState> GameEngine::GetGameStateSnapshot() const
+        {
+            if(m_StateStale)
+            {
+                std::scoped_lock<std::mutex> lock(m_MoversMutex);
+                if(m_StateStale)
+                {
+                    PublishGameState();
+                }
+            }
+
+            return std::atomic_load(&m_PublishedStatePtr);
+        }
+
+        std::shared_ptr<const GameState> GameEngine::GetTeamGameStateSnapshot(const team_ID teamID) const
         {
             std::scoped_lock<std::mutex> lock(m_MoversMutex);
 
-            GameState gameState;
-            
-            for(auto mapItr : m_AllMoversMap)
+            if(m_StateStale)
+            {
+                PublishGameState();
+            }
+            if(m_TeamViewsBuiltFrom != m_NumStatesPublished)
             {
-                MoverState moverState;
+                BuildTeamViews();
+            }
 
-                moverState.ID = mapItr.second->GetID();
-                moverState.teamID = mapItr.second->GetTeam();
-                moverState.inertialData = mapItr.second->GetInertialData();
+            if(teamID < m_TeamStatePtrs.size() && m_TeamStatePtrs[teamID] != nullptr)
+            {
+                return m_TeamStatePtrs[teamID];
+            }
+            return m_EmptyStatePtr;
+        }
 
-                gameState.moverList.push_back(moverState);
+        bool GameEngine::SetViewRange(const coord viewRange)
+        {
+            if(viewRange < 0.0)
+            {
+                return false;
             }
 
-            return gameState;
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+            m_ViewRange = viewRange;
+            // views are rebuilt the next time one is requested
+            m_TeamViewsBuiltFrom = 0;
+
+            return true;
         }
 
-        void GameEngine::Tick()
+        coord GameEngine::GetViewRange() const
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+            return m_ViewRange;
+        }
+
+        void GameEngine::GetMoversInRadius(const coord xCoord, const coord yCoord, const coord radius, std::vector<MoverHandle>& results) const
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            std::vector<uint32_t> IDs;
+            m_SpatialGrid.QueryRadius(xCoord, yCoord, radius, IDs);
+            ToMoverHandles(IDs, results);
+        }
+
+        void GameEngine::GetNearestMovers(const coord xCoord, const coord yCoord, const size_t count, std::vector<MoverHandle>& results) const
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            std::vector<uint32_t> IDs;
+            m_SpatialGrid.QueryNearest(xCoord, yCoord, count, IDs);
+            ToMoverHandles(IDs, results);
+        }
+
+        void GameEngine::GetTeamContacts(const team_ID teamID, std::vector<RadarContact>& results) const
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            const std::vector<RadarSystem::Contact>& contacts = m_Radar.GetContacts(teamID);
+            results.reserve(results.size() + contacts.size());
+            for(const auto& contact : contacts)
+            {
+                RadarContact radarContact;
+                radarContact.handle = MoverHandle{contact.index, m_MoverEntries[contact.index].generation};
+                radarContact.identified = contact.identified;
+                results.push_back(radarContact);
+            }
+        }
+
+        MoverHandle GameEngine::GetLockedTarget(const MoverHandle handle) const
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            if(!IsCurrent(handle))
+            {
+                return MoverHandle();
+            }
+            return m_MoverEntries[handle.index].lockedTarget;
+        }
+
+        uint32_t GameEngine::GetMissilesRemaining(const MoverHandle handle) const
         {
             std::scoped_lock<std::mutex> lock(m_MoversMutex);
 
-            std::vector<std::string> markForRemove;
-            for(auto mapItr : m_AllMoversMap)
+            if(!IsCurrent(handle))
             {
-                if(mapItr.second->GetStatus())
+                return 0;
+            }
+            return m_MoverEntries[handle.index].missilesRemaining;
+        }
+
+        bool GameEngine::GetCheckpoint(EngineCheckpoint& checkpoint) const
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            if(m_NumMoverObjects > 0)
+            {
+                return false;
+            }
+
+            checkpoint.ticks = m_TicksCounter.load(std::memory_order_relaxed);
+            checkpoint.numMissilesLaunched = m_NumMissilesLaunched;
+
+            // assign over existing elements so their ID strings keep their capacity
+            checkpoint.entries.resize(m_MoverEntries.size());
+            for(size_t i = 0; i < m_MoverEntries.size(); ++i)
+            {
+                const MoverEntry& entry = m_MoverEntries[i];
+                EntryCheckpoint& entryCheckpoint = checkpoint.entries[i];
+                entryCheckpoint.generation = entry.generation;
+                entryCheckpoint.teamID = m_EntryTeams[i];
+                entryCheckpoint.inSpatialIndex = m_SpatialGrid.Contains(static_cast<uint32_t>(i));
+                entryCheckpoint.lockedTarget = entry.lockedTarget;
+                entryCheckpoint.missilesRemaining = entry.missilesRemaining;
+
+                if(!entry.occupied)
                 {
-                    mapItr.second->Move();
+                    entryCheckpoint.type = CHECKPOINT_ENTRY_TYPE::FREE;
+                    entryCheckpoint.ID.clear();
+                }
+                else if(entry.missilePtr != nullptr)
+                {
+                    entryCheckpoint.type = CHECKPOINT_ENTRY_TYPE::MISSILE;
+                    entryCheckpoint.ID.assign(entry.missilePtr->GetIDView());
+                    entryCheckpoint.inertialData = entry.missilePtr->GetInertialData();
+                    entryCheckpoint.desiredHeading = entry.missilePtr->GetDesiredHeading();
+                    entryCheckpoint.status = entry.missilePtr->GetStatus();
+                    entryCheckpoint.target = entry.missilePtr->GetTarget();
+                    entryCheckpoint.fuelTicks = entry.missilePtr->GetFuelTicks();
                 }
                 else
                 {
-                    markForRemove.push_back(mapItr.first);
+                    entryCheckpoint.type = CHECKPOINT_ENTRY_TYPE::FIGHTER;
+                    entryCheckpoint.ID.assign(m_MoverStore.GetIDView(entry.storeSlot));
+                    entryCheckpoint.inertialData = m_MoverStore.GetInertialData(entry.storeSlot);
+                    entryCheckpoint.desiredHeading = m_MoverStore.GetDesiredHeading(entry.storeSlot);
+                    entryCheckpoint.status = m_MoverStore.GetStatus(entry.storeSlot);
+                    entryCheckpoint.performanceValues = m_MoverStore.GetPerformanceValues(entry.storeSlot);
+                }
+            }
+
+            checkpoint.freeEntries = m_FreeEntries;
+            checkpoint.storeOrder.resize(m_MoverStore.GetSize());
+            for(size_t i = 0; i < checkpoint.storeOrder.size(); ++i)
+            {
+                checkpoint.storeOrder[i] = m_StoreSlotToEntry[m_MoverStore.GetSlot(i)];
+            }
+            checkpoint.missileEntries = m_MissileEntries;
+
+            // up to the last team with any contacts
+            size_t numTeams = 0;
+            for(size_t teamID = 0; teamID <= UINT8_MAX; ++teamID)
+            {
+                if(!m_Radar.GetContacts(static_cast<team_ID>(teamID)).empty())
+                {
+                    numTeams = teamID + 1;
+                }
+            }
+            checkpoint.teamContacts.resize(numTeams);
+            for(size_t teamID = 0; teamID < numTeams; ++teamID)
+            {
+                checkpoint.teamContacts[teamID] = m_Radar.GetContacts(static_cast<team_ID>(teamID));
+            }
+
+            return true;
+        }
+
+        bool GameEngine::RestoreCheckpoint(const EngineCheckpoint& checkpoint)
+        {
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+
+            if(!m_MoverEntries.empty() || m_TicksCounter.load(std::memory_order_relaxed) != 0 ||
+                !IsConsistentCheckpoint(checkpoint, m_MissilePool.GetCapacity()))
+            {
+                return false;
+            }
+
+            const size_t numEntries = checkpoint.entries.size();
+            m_MoverEntries.resize(numEntries);
+            m_EntryTeams.resize(numEntries, UNK_TEAM_ID);
+            m_StartData.resize(numEntries);
+            for(size_t i = 0; i < numEntries; ++i)
+            {
+                const EntryCheckpoint& entryCheckpoint = checkpoint.entries[i];
+                MoverEntry& entry = m_MoverEntries[i];
+                entry.generation = entryCheckpoint.generation;
+                entry.occupied = entryCheckpoint.type != CHECKPOINT_ENTRY_TYPE::FREE;
+                m_EntryTeams[i] = entryCheckpoint.teamID;
+                if(entryCheckpoint.type == CHECKPOINT_ENTRY_TYPE::FIGHTER)
+                {
+                    entry.lockedTarget = entryCheckpoint.lockedTarget;
+                    entry.missilesRemaining = entryCheckpoint.missilesRemaining;
+                }
+            }
+
+            // added in the store's dense order, which is the order fighters move, collide and are removed in
+            for(const uint32_t index : checkpoint.storeOrder)
+            {
+                const EntryCheckpoint& entryCheckpoint = checkpoint.entries[index];
+                const store_slot slot = m_MoverStore.Add(entryCheckpoint.ID, entryCheckpoint.teamID, entryCheckpoint.performanceValues);
+                m_MoverStore.RestoreState(slot, entryCheckpoint.inertialData, entryCheckpoint.desiredHeading, entryCheckpoint.status);
+                m_MoverEntries[index].storeSlot = slot;
+
+                if(slot >= m_StoreSlotToEntry.size())
+                {
+                    m_StoreSlotToEntry.resize(slot + 1, INVALID_MOVER_INDEX);
                 }
+                m_StoreSlotToEntry[slot] = index;
+                m_MoverHandles[entryCheckpoint.ID] = MoverHandle{index, entryCheckpoint.generation};
+            }
+
+            // the pool holds at least as many missiles as were checked for
+            for(const uint32_t index : checkpoint.missileEntries)
+            {
+                const EntryCheckpoint& entryCheckpoint = checkpoint.entries[index];
+                MissileMover* missilePtr = m_MissilePool.Allocate(std::string_view(entryCheckpoint.ID), entryCheckpoint.teamID,
+                                                                    entryCheckpoint.inertialData, entryCheckpoint.target);
+                missilePtr->Restore(entryCheckpoint.inertialData, entryCheckpoint.desiredHeading, entryCheckpoint.fuelTicks, entryCheckpoint.status);
+                m_MoverEntries[index].missilePtr = missilePtr;
             }
+            m_MissileEntries = checkpoint.missileEntries;
+            m_FreeEntries = checkpoint.freeEntries;
 
-            for(auto itr : markForRemove)
+            for(size_t i = 0; i < numEntries; ++i)
             {
-                auto toRemove = m_AllMoversMap.find(itr);
-                if(toRemove != m_AllMoversMap.end())
+                const EntryCheckpoint& entryCheckpoint = checkpoint.entries[i];
+                if(entryCheckpoint.type != CHECKPOINT_ENTRY_TYPE::FREE && entryCheckpoint.inSpatialIndex)
                 {
-                    m_AllMoversMap.erase(toRemove);
+                    m_SpatialGrid.Update(static_cast<uint32_t>(i), entryCheckpoint.inertialData.xCoord, entryCheckpoint.inertialData.yCoord);
                 }
             }
+
+            for(size_t teamID = 0; teamID < checkpoint.teamContacts.size(); ++teamID)
+            {
+                m_Radar.SetContacts(static_cast<team_ID>(teamID), checkpoint.teamContacts[teamID]);
+            }
+
+            m_NumMissilesLaunched = checkpoint.numMissilesLaunched;
+            m_TicksCounter.store(checkpoint.ticks, std::memory_order_relaxed);
+            m_StateStale = true;
+
+            return true;
+        }
+
+        bool GameEngine::LaunchMissile(const uint32_t launcherIndex, const MoverHandle targetHandle)
+        {
+            const MoverEntry& launcher = m_MoverEntries[launcherIndex];
+            if(launcher.missilesRemaining == 0)
+            {
+                return false;
+            }
+
+            // stored fighters' IDs are read in place, Mover objects only hand out copies
+            std::string launcherIDCopy;
+            std::string_view launcherID;
+            if(launcher.moverPtr != nullptr)
+            {
+                launcherIDCopy = launcher.moverPtr->GetID();
+                launcherID = launcherIDCopy;
+            }
+            else
+            {
+                launcherID = m_MoverStore.GetIDView(launcher.storeSlot);
+            }
+            std::array<char, MISSILE_ID_SIZE> missileID;
+            const size_t missileIDLength = FormatMissileID(launcherID, m_NumMissilesLaunched + 1, missileID);
+
+            const team_ID teamID = m_EntryTeams[launcherIndex];
+            MissileMover* missilePtr = m_MissilePool.Allocate(std::string_view(missileID.data(), missileIDLength), teamID,
+                                                                GetEntryInertialData(launcherIndex), targetHandle);
+            if(missilePtr == nullptr)
+            {
+                return false;
+            }
+
+            --m_MoverEntries[launcherIndex].missilesRemaining;
+
+            // missiles are not command subjects, so they are kept out of the ID lookup
+            const MoverHandle handle = AllocateEntry();
+            m_MoverEntries[handle.index].missilePtr = missilePtr;
+            m_EntryTeams[handle.index] = teamID;
+            m_MissileEntries.push_back(handle.index);
+
+            ++m_NumMissilesLaunched;
+            ++m_MissilesLaunchedCounter;
+            ++m_MoversAddedCounter;
+            m_StateStale = true;
+
+            EngineEvent event;
+            event.type = ENGINE_EVENT_TYPE::MOVER_ADDED;
+            event.handle = handle;
+            event.otherHandle = MoverHandle{launcherIndex, m_MoverEntries[launcherIndex].generation};
+            event.teamID = teamID;
+            PublishEvent(event);
+
+            return true;
+        }
+
+        InertialData GameEngine::GetEntryInertialData(const uint32_t index) const
+        {
+            const MoverEntry& entry = m_MoverEntries[index];
+            if(entry.missilePtr != nullptr)
+            {
+                return entry.missilePtr->GetInertialData();
+            }
+            if(entry.moverPtr != nullptr)
+            {
+                return entry.moverPtr->GetInertialData();
+            }
+            return m_MoverStore.GetInertialData(entry.storeSlot);
+        }
+
+        bool GameEngine::GetEntryStatus(const uint32_t index) const
+        {
+            const MoverEntry& entry = m_MoverEntries[index];
+            if(entry.missilePtr != nullptr)
+            {
+                return entry.missilePtr->GetStatus();
+            }
+            if(entry.moverPtr != nullptr)
+            {
+                return entry.moverPtr->GetStatus();
+            }
+            return m_MoverStore.GetStatus(entry.storeSlot);
+        }
+
+        void GameEngine::DestroyEntry(const uint32_t index)
+        {
+            MoverEntry& entry = m_MoverEntries[index];
+            if(entry.missilePtr != nullptr)
+            {
+                entry.missilePtr->Destroy();
+            }
+            else if(entry.moverPtr != nullptr)
+            {
+                entry.moverPtr->Destroy();
+            }
+            else
+            {
+                m_MoverStore.Destroy(entry.storeSlot);
+            }
+        }
+
+        void GameEngine::MoveMissiles(std::vector<uint32_t>& markForRemove)
+        {
+            const coord proximitySquared = MISSILE_PROXIMITY_RADIUS * MISSILE_PROXIMITY_RADIUS;
+            size_t numFlying = 0;
+
+            for(size_t i = 0; i < m_MissileEntries.size(); ++i)
+            {
+                const uint32_t index = m_MissileEntries[i];
+                MissileMover* missilePtr = m_MoverEntries[index].missilePtr;
+
+                if(missilePtr->GetStatus())
+                {
+                    const MoverHandle targetHandle = missilePtr->GetTarget();
+                    if(IsCurrent(targetHandle) && GetEntryStatus(targetHandle.index))
+                    {
+                        // missiles move before everything else, so the target is checked where it stands at the start
+                        // of the tick against the whole of the missile's path, which a fast missile can otherwise skip past
+                        const InertialData targetData = GetEntryInertialData(targetHandle.index);
+                        const InertialData startData = missilePtr->GetInertialData();
+                        missilePtr->Guide(targetData.xCoord, targetData.yCoord);
+                        missilePtr->Move();
+                        const InertialData endData = missilePtr->GetInertialData();
+
+                        if(vector::util::MathUtil::GetClosestApproachSquared(startData.xCoord - targetData.xCoord, startData.yCoord - targetData.yCoord,
+                                                                            endData.xCoord - targetData.xCoord, endData.yCoord - targetData.yCoord)
+                            <= proximitySquared)
+                        {
+                            DestroyEntry(targetHandle.index);
+                            missilePtr->Destroy();
+                            ++m_MissileHitsCounter;
+
+                            EngineEvent event;
+                            event.type = ENGINE_EVENT_TYPE::MOVER_DESTROYED;
+                            event.handle = targetHandle;
+                            event.otherHandle = MoverHandle{index, m_MoverEntries[index].generation};
+                            event.teamID = m_EntryTeams[targetHandle.index];
+                            event.cause = DESTRUCTION_CAUSE::MISSILE_HIT;
+                            PublishEvent(event);
+                        }
+                    }
+                    else
+                    {
+                        // the target is gone, fly on until the fuel runs out
+                        missilePtr->Move();
+                    }
+
+                    if(!IsInArena(missilePtr->GetInertialData()))
+                    {
+                        EngineEvent event;
+                        event.type = ENGINE_EVENT_TYPE::OUT_OF_BOUNDS;
+                        event.handle = MoverHandle{index, m_MoverEntries[index].generation};
+                        event.teamID = m_EntryTeams[index];
+                        PublishEvent(event);
+                    }
+                }
+
+                if(missilePtr->GetStatus())
+                {
+                    m_MissileEntries[numFlying++] = index;
+                }
+                else
+                {
+                    markForRemove.push_back(index);
+                }
+            }
+
+            m_MissileEntries.resize(numFlying);
+        }
+
+        GameEngine::EventCursor GameEngine::SubscribeEvents() const
+        {
+            return m_Events.Subscribe();
+        }
+
+        bool GameEngine::PollEvent(EventCursor& cursor, EngineEvent& event) const
+        {
+            return m_Events.TryRead(cursor, event);
+        }
+
+        void GameEngine::PublishEvent(EngineEvent event)
+        {
+            event.tick = m_TicksCounter.load(std::memory_order_relaxed);
+            m_Events.Publish(event);
+            ++m_EventsPublishedCounter;
+        }
+
+        void GameEngine::UpdateSpatialIndex()
+        {
+            // stored fighters in one pass over the store's dense arrays, destroyed ones wait to be removed next Tick
+            // and are already out of the index
+            const size_t numFighters = m_MoverStore.GetSize();
+            for(size_t i = 0; i < numFighters; ++i)
+            {
+                const store_slot slot = m_MoverStore.GetSlot(i);
+                const uint32_t index = m_StoreSlotToEntry[slot];
+                const InertialData inertialData = m_MoverStore.GetInertialData(slot);
+                if(m_MoverStore.GetStatus(slot))
+                {
+                    m_SpatialGrid.Update(index, inertialData.xCoord, inertialData.yCoord);
+                }
+                else
+                {
+                    m_SpatialGrid.Remove(index);
+                }
+
+                // the kinematics destroy fighters as they leave the arena, and destroyed fighters no longer move
+                if(!IsInArena(inertialData) && IsInArena(m_StartData[index]))
+                {
+                    EngineEvent event;
+                    event.type = ENGINE_EVENT_TYPE::OUT_OF_BOUNDS;
+                    event.handle = MoverHandle{index, m_MoverEntries[index].generation};
+                    event.teamID = m_EntryTeams[index];
+                    PublishEvent(event);
+                }
+            }
+
+            for(auto index : m_MissileEntries)
+            {
+                const InertialData inertialData = m_MoverEntries[index].missilePtr->GetInertialData();
+                m_SpatialGrid.Update(index, inertialData.xCoord, inertialData.yCoord);
+            }
+
+            if(m_NumMoverObjects == 0)
+            {
+                return;
+            }
+
+            for(size_t i = 0; i < m_MoverEntries.size(); ++i)
+            {
+                const MoverEntry& entry = m_MoverEntries[i];
+                if(entry.occupied && entry.moverPtr != nullptr)
+                {
+                    const InertialData inertialData = entry.moverPtr->GetInertialData();
+                    m_SpatialGrid.Update(static_cast<uint32_t>(i), inertialData.xCoord, inertialData.yCoord);
+                }
+            }
+        }
+
+        void GameEngine::RecordStartData()
+        {
+            const size_t numFighters = m_MoverStore.GetSize();
+            for(size_t i = 0; i < numFighters; ++i)
+            {
+                const store_slot slot = m_MoverStore.GetSlot(i);
+                m_StartData[m_StoreSlotToEntry[slot]] = m_MoverStore.GetInertialData(slot);
+            }
+
+            if(m_NumMoverObjects == 0)
+            {
+                return;
+            }
+
+            for(size_t i = 0; i < m_MoverEntries.size(); ++i)
+            {
+                const MoverEntry& entry = m_MoverEntries[i];
+                if(entry.occupied && entry.moverPtr != nullptr)
+                {
+                    m_StartData[i] = entry.moverPtr->GetInertialData();
+                }
+            }
+        }
+
+        void GameEngine::DetectCollisions()
+        {
+            // missiles are left to their proximity fuses, so one cannot collide with its launcher as it leaves the rail
+            m_Collisions.ClearBodies();
+
+            const size_t numFighters = m_MoverStore.GetSize();
+            for(size_t i = 0; i < numFighters; ++i)
+            {
+                const store_slot slot = m_MoverStore.GetSlot(i);
+                if(m_MoverStore.GetStatus(slot))
+                {
+                    const uint32_t index = m_StoreSlotToEntry[slot];
+                    m_Collisions.AddBody(index, m_StartData[index], m_MoverStore.GetInertialData(slot));
+                }
+            }
+
+            if(m_NumMoverObjects > 0)
+            {
+                for(size_t i = 0; i < m_MoverEntries.size(); ++i)
+                {
+                    const MoverEntry& entry = m_MoverEntries[i];
+                    if(entry.occupied && entry.moverPtr != nullptr)
+                    {
+                        m_Collisions.AddBody(static_cast<uint32_t>(i), m_StartData[i], entry.moverPtr->GetInertialData());
+                    }
+                }
+            }
+
+            m_CollisionPairs.clear();
+            m_Collisions.Detect(m_TickPoolPtr.get(), m_CollisionPairs);
+
+            // a Mover in several collisions is destroyed, and reported, by the first
+            for(const auto& collision : m_CollisionPairs)
+            {
+                const MoverHandle firstHandle{collision.firstIndex, m_MoverEntries[collision.firstIndex].generation};
+                const MoverHandle secondHandle{collision.secondIndex, m_MoverEntries[collision.secondIndex].generation};
+
+                EngineEvent event;
+                event.type = ENGINE_EVENT_TYPE::MOVER_DESTROYED;
+                event.cause = DESTRUCTION_CAUSE::COLLISION;
+
+                if(m_SpatialGrid.Remove(collision.firstIndex))
+                {
+                    DestroyEntry(collision.firstIndex);
+                    event.handle = firstHandle;
+                    event.otherHandle = secondHandle;
+                    event.teamID = m_EntryTeams[collision.firstIndex];
+                    PublishEvent(event);
+                }
+                if(m_SpatialGrid.Remove(collision.secondIndex))
+                {
+                    DestroyEntry(collision.secondIndex);
+                    event.handle = secondHandle;
+                    event.otherHandle = firstHandle;
+                    event.teamID = m_EntryTeams[collision.secondIndex];
+                    PublishEvent(event);
+                }
+            }
+
+            m_CollisionsCounter += m_CollisionPairs.size();
+        }
+
+        void GameEngine::SweepRadar()
+        {
+            m_Radar.ClearEmitters();
+
+            const size_t numFighters = m_MoverStore.GetSize();
+            for(size_t i = 0; i < numFighters; ++i)
+            {
+                const store_slot slot = m_MoverStore.GetSlot(i);
+                if(m_MoverStore.GetStatus(slot))
+                {
+                    const uint32_t index = m_StoreSlotToEntry[slot];
+                    m_Radar.AddEmitter(index, m_EntryTeams[index], m_MoverStore.GetInertialData(slot), m_MoverStore.GetPerformanceValues(slot));
+                }
+            }
+
+            // Mover objects found destroyed have already been removed this Tick
+            if(m_NumMoverObjects > 0)
+            {
+                for(size_t i = 0; i < m_MoverEntries.size(); ++i)
+                {
+                    const MoverEntry& entry = m_MoverEntries[i];
+                    if(entry.occupied && entry.moverPtr != nullptr)
+                    {
+                        m_Radar.AddEmitter(static_cast<uint32_t>(i), m_EntryTeams[i], entry.moverPtr->GetInertialData(),
+                                            entry.moverPtr->GetPerformanceValues());
+                    }
+                }
+            }
+
+            m_Radar.Sweep(m_SpatialGrid, m_EntryTeams, m_TickPoolPtr.get());
+
+            for(size_t i = 0; i < m_MoverEntries.size(); ++i)
+            {
+                MoverEntry& entry = m_MoverEntries[i];
+                if(entry.lockedTarget.IsValid() &&
+                    (!IsCurrent(entry.lockedTarget) || !m_Radar.IsContact(m_EntryTeams[i], entry.lockedTarget.index)))
+                {
+                    entry.lockedTarget = MoverHandle();
+                }
+            }
+        }
+
+        MoverHandle GameEngine::ResolveTarget(const util::Command& cmd) const
+        {
+            const vector::util::TargetPayload* targetPayload = std::get_if<vector::util::TargetPayload>(&cmd.payload);
+            if(targetPayload == nullptr)
+            {
+                return MoverHandle();
+            }
+
+            auto handleItr = m_MoverHandles.find(targetPayload->callsign);
+            if(handleItr == m_MoverHandles.end() || !IsCurrent(handleItr->second))
+            {
+                return MoverHandle();
+            }
+            return handleItr->second;
+        }
+
+        void GameEngine::ToMoverHandles(const std::vector<uint32_t>& IDs, std::vector<MoverHandle>& results) const
+        {
+            results.reserve(results.size() + IDs.size());
+            for(auto index : IDs)
+            {
+                results.push_back(MoverHandle{index, m_MoverEntries[index].generation});
+            }
+        }
+
+        void GameEngine::PublishGameState() const
+        {
+            const auto publishStart = std::chrono::steady_clock::now();
+
+            // reuse the back buffer's storage when no reader still holds it, otherwise leave it to its readers
+            if(m_BackStatePtr == nullptr || m_BackStatePtr.use_count() != 1)
+            {
+                m_BackStatePtr = std::make_shared<GameState>();
+            }
+            else
+            {
+                // pairs with the release in the last reader's reference count decrement
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+
+            std::vector<MoverState>& moverList = m_BackStatePtr->moverList;
+            size_t numMovers = 0;
+            moverList.reserve(m_MoverEntries.size() - m_FreeEntries.size());
+
+            for(size_t i = 0; i < m_MoverEntries.size(); ++i)
+            {
+                const MoverEntry& entry = m_MoverEntries[i];
+                if(!entry.occupied)
+                {
+                    continue;
+                }
+
+                // assign over existing elements so their ID strings keep their capacity
+                if(numMovers == moverList.size())
+                {
+                    moverList.emplace_back();
+                }
+                MoverState& moverState = moverList[numMovers++];
+
+                moverState.handle.index = static_cast<uint32_t>(i);
+                moverState.handle.generation = entry.generation;
+
+                if(entry.missilePtr != nullptr)
+                {
+                    moverState.ID.assign(entry.missilePtr->GetIDView());
+                    moverState.teamID = m_EntryTeams[i];
+                    moverState.inertialData = entry.missilePtr->GetInertialData();
+                }
+                else if(entry.moverPtr != nullptr)
+                {
+                    moverState.ID = entry.moverPtr->GetID();
+                    moverState.teamID = m_EntryTeams[i];
+                    moverState.inertialData = entry.moverPtr->GetInertialData();
+                }
+                else
+                {
+                    moverState.ID = m_MoverStore.GetID(entry.storeSlot);
+                    moverState.teamID = m_MoverStore.GetTeam(entry.storeSlot);
+                    moverState.inertialData = m_MoverStore.GetInertialData(entry.storeSlot);
+                }
+            }
+            moverList.resize(numMovers);
+
+            std::swap(m_FrontStatePtr, m_BackStatePtr);
+            std::atomic_store(&m_PublishedStatePtr, std::shared_ptr<const GameState>(m_FrontStatePtr));
+            m_StateStale = false;
+            ++m_NumStatesPublished;
+
+            m_SnapshotHistogram.Record(vector::util::Metrics::NanosSince(publishStart));
+        }
+
+        void GameEngine::BuildTeamViews() const
+        {
+            const auto buildStart = std::chrono::steady_clock::now();
+
+            const std::vector<MoverState>& moverList = m_FrontStatePtr->moverList;
+            const size_t numEntries = m_MoverEntries.size();
+
+            // a row for each team with a Mover
+            m_ViewRows.fill(NO_VIEW_ROW);
+            size_t numRows = 0;
+            for(const auto& moverState : moverList)
+            {
+                if(m_ViewRows[moverState.teamID] == NO_VIEW_ROW)
+                {
+                    m_ViewRows[moverState.teamID] = static_cast<uint16_t>(numRows++);
+                }
+            }
+            m_InView.assign(numRows * numEntries, 0);
+
+            // one pass over every Mover marks itself in its team's view, and the enemies around it
+            for(const auto& moverState : moverList)
+            {
+                uint8_t* inView = &m_InView[m_ViewRows[moverState.teamID] * numEntries];
+                inView[moverState.handle.index] = 1;
+
+                if(m_ViewRange > 0.0)
+                {
+                    m_ViewQueryResults.clear();
+                    m_SpatialGrid.QueryRadius(moverState.inertialData.xCoord, moverState.inertialData.yCoord, m_ViewRange, m_ViewQueryResults);
+                    for(const uint32_t index : m_ViewQueryResults)
+                    {
+                        if(index < numEntries && m_EntryTeams[index] != moverState.teamID)
+                        {
+                            inView[index] = 1;
+                        }
+                    }
+                }
+            }
+
+            for(size_t teamID = 0; teamID < m_ViewRows.size(); ++teamID)
+            {
+                if(m_ViewRows[teamID] == NO_VIEW_ROW)
+                {
+                    continue;
+                }
+
+                uint8_t* inView = &m_InView[m_ViewRows[teamID] * numEntries];
+                for(const auto& contact : m_Radar.GetContacts(static_cast<team_ID>(teamID)))
+                {
+                    if(contact.index < numEntries)
+                    {
+                        inView[contact.index] = 1;
+                    }
+                }
+            }
+
+            if(m_TeamStatePtrs.size() < m_ViewRows.size())
+            {
+                m_TeamStatePtrs.resize(m_ViewRows.size());
+            }
+
+            for(size_t teamID = 0; teamID < m_TeamStatePtrs.size(); ++teamID)
+            {
+                std::shared_ptr<GameState>& teamStatePtr = m_TeamStatePtrs[teamID];
+                if(m_ViewRows[teamID] == NO_VIEW_ROW)
+                {
+                    teamStatePtr = nullptr;
+                    continue;
+                }
+
+                // like the back buffer, a view's storage is only reused once its readers have let it go
+                if(teamStatePtr == nullptr || teamStatePtr.use_count() != 1)
+                {
+                    teamStatePtr = std::make_shared<GameState>();
+                }
+                else
+                {
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                }
+
+                const uint8_t* inView = &m_InView[m_ViewRows[teamID] * numEntries];
+                std::vector<MoverState>& teamMoverList = teamStatePtr->moverList;
+                size_t numMovers = 0;
+                for(const auto& moverState : moverList)
+                {
+                    if(!inView[moverState.handle.index])
+                    {
+                        continue;
+                    }
+
+                    if(numMovers == teamMoverList.size())
+                    {
+                        teamMoverList.emplace_back();
+                    }
+                    teamMoverList[numMovers++] = moverState;
+                }
+                teamMoverList.resize(numMovers);
+            }
+
+            m_TeamViewsBuiltFrom = m_NumStatesPublished;
+            m_TeamViewsHistogram.Record(vector::util::Metrics::NanosSince(buildStart));
+        }
+
+        void GameEngine::Tick()
+        {
+            RunTick(nullptr);
+        }
+
+        void GameEngine::Tick(std::vector<TickCommand>& drainedCommands)
+        {
+            RunTick(&drainedCommands);
+        }
+
+        void GameEngine::RunTick(std::vector<TickCommand>* drainedCommandsPtr)
+        {
+            const auto tickStart = std::chrono::steady_clock::now();
+            std::scoped_lock<std::mutex> lock(m_MoversMutex);
+            m_TickLockWaitHistogram.Record(vector::util::Metrics::NanosSince(tickStart));
+
+            // commands queued since the last Tick are applied first, in the order they were queued
+            auto phaseStart = std::chrono::steady_clock::now();
+            QueuedCommand queuedCommand;
+            while(m_CommandQueue.TryPop(queuedCommand))
+            {
+                if(drainedCommandsPtr != nullptr)
+                {
+                    drainedCommandsPtr->push_back(TickCommand{queuedCommand.subjectHandle, queuedCommand.cmd});
+                }
+                queuedCommand.resultPromise.set_value(ApplyCommand(queuedCommand.subjectHandle, queuedCommand.cmd));
+            }
+            m_TickCommandsHistogram.Record(vector::util::Metrics::NanosSince(phaseStart));
+
+            // stored fighters: drop the destroyed, then advance the rest in one linear pass
+            phaseStart = std::chrono::steady_clock::now();
+            m_RemovedStoreSlots.clear();
+            m_MoverStore.RemoveDestroyed(m_RemovedStoreSlots);
+            for(auto slot : m_RemovedStoreSlots)
+            {
+                ReleaseEntry(m_StoreSlotToEntry[slot]);
+                m_StoreSlotToEntry[slot] = INVALID_MOVER_INDEX;
+            }
+            RecordStartData();
+            m_TickRemoveHistogram.Record(vector::util::Metrics::NanosSince(phaseStart));
+
+            phaseStart = std::chrono::steady_clock::now();
+            m_RemovedMissiles.clear();
+            MoveMissiles(m_RemovedMissiles);
+            for(auto index : m_RemovedMissiles)
+            {
+                ReleaseEntry(index);
+            }
+            m_TickMissilesHistogram.Record(vector::util::Metrics::NanosSince(phaseStart));
+
+            phaseStart = std::chrono::steady_clock::now();
+            MoveStoredFighters();
+            m_TickMoveStoredHistogram.Record(vector::util::Metrics::NanosSince(phaseStart));
+
+            phaseStart = std::chrono::steady_clock::now();
+            m_RemovedEntries.clear();
+            MoveMoverObjects(m_RemovedEntries);
+            for(auto index : m_RemovedEntries)
+            {
+                // Mover objects are only found destroyed the Tick after, where they were left at the start of this one
+                if(!IsInArena(m_StartData[index]))
+                {
+                    EngineEvent event;
+                    event.type = ENGINE_EVENT_TYPE::OUT_OF_BOUNDS;
+                    event.handle = MoverHandle{index, m_MoverEntries[index].generation};
+                    event.teamID = m_EntryTeams[index];
+                    PublishEvent(event);
+                }
+                ReleaseEntry(index);
+            }
+            m_TickMoveObjectsHistogram.Record(vector::util::Metrics::NanosSince(phaseStart));
+
+            phaseStart = std::chrono::steady_clock::now();
+            UpdateSpatialIndex();
+            m_TickSpatialIndexHistogram.Record(vector::util::Metrics::NanosSince(phaseStart));
+
+            phaseStart = std::chrono::steady_clock::now();
+            DetectCollisions();
+            m_TickCollisionsHistogram.Record(vector::util::Metrics::NanosSince(phaseStart));
+
+            phaseStart = std::chrono::steady_clock::now();
+            SweepRadar();
+            m_TickRadarHistogram.Record(vector::util::Metrics::NanosSince(phaseStart));
+
+            PublishGameState();
+
+            m_MoversRemovedCounter += m_RemovedStoreSlots.size() + m_RemovedMissiles.size() + m_RemovedEntries.size();
+            ++m_TicksCounter;
+            m_TickHistogram.Record(vector::util::Metrics::NanosSince(tickStart));
+        }
+
+        const vector::util::Metrics& GameEngine::GetMetrics() const
+        {
+            return m_Metrics;
+        }
+
+        size_t GameEngine::GetNumTickThreads() const
+        {
+            return m_TickPoolPtr != nullptr ? m_TickPoolPtr->GetNumThreads() : 1;
+        }
+
+        void GameEngine::MoveStoredFighters()
+        {
+            const size_t numFighters = m_MoverStore.GetSize();
+
+            if(m_TickPoolPtr == nullptr || numFighters <= STORED_FIGHTERS_PER_TASK)
+            {
+                m_MoverStore.MoveAll();
+                return;
+            }
+
+            // every fighter only touches its own slot, so contiguous ranges can be moved independently
+            const size_t numTasks = (numFighters + STORED_FIGHTERS_PER_TASK - 1) / STORED_FIGHTERS_PER_TASK;
+            m_TickPoolPtr->ParallelFor(numTasks, [this, numFighters](const size_t taskIndex)
+            {
+                const size_t begin = taskIndex * STORED_FIGHTERS_PER_TASK;
+                m_MoverStore.MoveRange(begin, std::min(STORED_FIGHTERS_PER_TASK, numFighters - begin));
+            });
+        }
+
+        void GameEngine::MoveMoverObjects(std::vector<uint32_t>& markForRemove)
+        {
+            const size_t numEntries = m_MoverEntries.size();
+
+            if(m_NumMoverObjects == 0)
+            {
+                return;
+            }
+
+            if(m_TickPoolPtr == nullptr || m_NumMoverObjects < 2)
+            {
+                for(size_t i = 0; i < numEntries; ++i)
+                {
+                    MoverEntry& entry = m_MoverEntries[i];
+                    if(entry.occupied && entry.moverPtr != nullptr)
+                    {
+                        if(entry.moverPtr->GetStatus())
+                        {
+                            entry.moverPtr->Move();
+                        }
+                        else
+                        {
+                            markForRemove.push_back(static_cast<uint32_t>(i));
+                        }
+                    }
+                }
+                return;
+            }
+
+            // each partition covers a contiguous range of entries and collects its own removals;
+            // concatenating them in partition order keeps removals in index order, as a serial pass would
+            const size_t numPartitions = std::min(numEntries, m_TickPoolPtr->GetNumThreads());
+            std::vector<std::vector<uint32_t>> partitionRemovals(numPartitions);
+
+            m_TickPoolPtr->ParallelFor(numPartitions, [this, &partitionRemovals, numEntries, numPartitions](const size_t partition)
+            {
+                const size_t begin = numEntries * partition / numPartitions;
+                const size_t end = numEntries * (partition + 1) / numPartitions;
+
+                for(size_t i = begin; i < end; ++i)
+                {
+                    MoverEntry& entry = m_MoverEntries[i];
+                    if(entry.occupied && entry.moverPtr != nullptr)
+                    {
+                        if(entry.moverPtr->GetStatus())
+                        {
+                            entry.moverPtr->Move();
+                        }
+                        else
+                        {
+                            partitionRemovals[partition].push_back(static_cast<uint32_t>(i));
+                        }
+                    }
+                }
+            });
+
+            for(auto& removals : partitionRemovals)
+            {
+                markForRemove.insert(markForRemove.end(), removals.begin(), removals.end());
+            }
         }
     } // namespace sim
-} // namespace vector
\ No newline at end of file
+} // namespace vector
@@ -0,0 +1,99 @@
+#include "sim/GameStateBinaryDecoder.h"
+#include "sim/SimConstants.h"
+#include "util/BinaryReader.h"
+
+namespace vector
+{
+    namespace sim
+    {
+        bool GameStateBinaryDecoder::Decode(const uint8_t* buffer, const size_t size, GameState& gameState)
+        {
+            vector::util::BinaryReader reader(buffer, size);
+
+            const uint16_t magic = reader.ReadU16();
+            const uint8_t version = reader.ReadU8();
+            const uint8_t flags = reader.ReadU8();
+            if(reader.HasFailed() || magic != GAME_STATE_CODEC_MAGIC || version != GAME_STATE_CODEC_VERSION ||
+                (flags & ~(GAME_STATE_CODEC_FLAG_QUANTIZED | GAME_STATE_CODEC_FLAG_RESET_IDS)) != 0)
+            {
+                return false;
+            }
+
+            // IDs are only ever sent for the handles they belong to, so they are taken into the table as they are read,
+            // even from a message that turns out to be bad
+            if(flags & GAME_STATE_CODEC_FLAG_RESET_IDS)
+            {
+                m_IDs.clear();
+            }
+
+            const uint32_t numIDs = reader.ReadU32();
+            if(reader.HasFailed() || numIDs > reader.GetRemaining() / GAME_STATE_CODEC_ID_SIZE)
+            {
+                return false;
+            }
+            for(uint32_t i = 0; i < numIDs; ++i)
+            {
+                const uint32_t index = reader.ReadU32();
+                const uint32_t generation = reader.ReadU32();
+                const uint16_t length = reader.ReadU16();
+
+                KnownID& knownID = m_IDs[index];
+                knownID.generation = generation;
+                reader.ReadString(length, knownID.ID);
+                if(reader.HasFailed())
+                {
+                    m_IDs.erase(index);
+                    return false;
+                }
+            }
+
+            const bool quantized = (flags & GAME_STATE_CODEC_FLAG_QUANTIZED) != 0;
+            const size_t moverSize = quantized ? GAME_STATE_CODEC_QUANTIZED_MOVER_SIZE : GAME_STATE_CODEC_MOVER_SIZE;
+            const uint32_t numMovers = reader.ReadU32();
+            if(reader.HasFailed() || numMovers != reader.GetRemaining() / moverSize || reader.GetRemaining() % moverSize != 0)
+            {
+                return false;
+            }
+
+            // assign over existing elements so their ID strings keep their capacity
+            m_ScratchList.resize(numMovers);
+            for(auto& moverState : m_ScratchList)
+            {
+                moverState.handle.index = reader.ReadU32();
+                moverState.handle.generation = reader.ReadU32();
+                moverState.teamID = reader.ReadU8();
+
+                InertialData& inertialData = moverState.inertialData;
+                inertialData.curHeading = reader.ReadU16();
+                if(quantized)
+                {
+                    inertialData.curSpeed = reader.ReadU16() * GAME_STATE_SPEED_QUANTUM;
+                    inertialData.xCoord = reader.ReadI32() * GAME_STATE_COORD_QUANTUM;
+                    inertialData.yCoord = reader.ReadI32() * GAME_STATE_COORD_QUANTUM;
+                }
+                else
+                {
+                    inertialData.curSpeed = reader.ReadF64();
+                    inertialData.xCoord = reader.ReadF64();
+                    inertialData.yCoord = reader.ReadF64();
+                }
+
+                auto IDItr = m_IDs.find(moverState.handle.index);
+                if(IDItr == m_IDs.end() || IDItr->second.generation != moverState.handle.generation)
+                {
+                    return false;
+                }
+                moverState.ID = IDItr->second.ID;
+            }
+
+            if(reader.HasFailed())
+            {
+                return false;
+            }
+
+            gameState.moverList.swap(m_ScratchList);
+
+            return true;
+        }
+    } // namespace sim
+} // namespace vector
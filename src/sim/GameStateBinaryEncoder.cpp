@@ -0,0 +1,120 @@
+#include "sim/GameStateBinaryEncoder.h"
+#include "sim/SimConstants.h"
+#include "util/BinaryWriter.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vector
+{
+    namespace sim
+    {
+        // the number of quantum steps in a value, clamped to the range of the field it is sent in
+        static double Quantize(const double value, const double quantum, const double minSteps, const double maxSteps)
+        {
+            return std::clamp(std::round(value / quantum), minSteps, maxSteps);
+        }
+
+        GameStateBinaryEncoder::GameStateBinaryEncoder(const bool quantize)
+            : m_Quantize(quantize)
+        {
+        }
+
+        size_t GameStateBinaryEncoder::GetMaxEncodedSize(const GameState& gameState) const
+        {
+            const size_t moverSize = m_Quantize ? GAME_STATE_CODEC_QUANTIZED_MOVER_SIZE : GAME_STATE_CODEC_MOVER_SIZE;
+            size_t size = GAME_STATE_CODEC_HEADER_SIZE + gameState.moverList.size() * (GAME_STATE_CODEC_ID_SIZE + moverSize);
+            for(const auto& moverState : gameState.moverList)
+            {
+                size += moverState.ID.size();
+            }
+            return size;
+        }
+
+        size_t GameStateBinaryEncoder::Encode(const GameState& gameState, uint8_t* buffer, const size_t capacity)
+        {
+            const std::vector<MoverState>& moverList = gameState.moverList;
+
+            // the IDs the receiver has not had for their Movers' handles
+            m_NewIDs.clear();
+            for(size_t i = 0; i < moverList.size(); ++i)
+            {
+                const MoverHandle& handle = moverList[i].handle;
+                if(m_ResetPending || handle.index >= m_SentIDs.size() || m_SentIDs[handle.index] != static_cast<uint64_t>(handle.generation) + 1)
+                {
+                    if(moverList[i].ID.size() > UINT16_MAX)
+                    {
+                        return 0;
+                    }
+                    m_NewIDs.push_back(i);
+                }
+            }
+
+            vector::util::BinaryWriter writer(buffer, capacity);
+            writer.WriteU16(GAME_STATE_CODEC_MAGIC);
+            writer.WriteU8(GAME_STATE_CODEC_VERSION);
+            writer.WriteU8((m_Quantize ? GAME_STATE_CODEC_FLAG_QUANTIZED : 0) | (m_ResetPending ? GAME_STATE_CODEC_FLAG_RESET_IDS : 0));
+
+            writer.WriteU32(static_cast<uint32_t>(m_NewIDs.size()));
+            for(const size_t i : m_NewIDs)
+            {
+                const MoverState& moverState = moverList[i];
+                writer.WriteU32(moverState.handle.index);
+                writer.WriteU32(moverState.handle.generation);
+                writer.WriteU16(static_cast<uint16_t>(moverState.ID.size()));
+                writer.WriteBytes(moverState.ID.data(), moverState.ID.size());
+            }
+
+            writer.WriteU32(static_cast<uint32_t>(moverList.size()));
+            for(const auto& moverState : moverList)
+            {
+                const InertialData& inertialData = moverState.inertialData;
+                writer.WriteU32(moverState.handle.index);
+                writer.WriteU32(moverState.handle.generation);
+                writer.WriteU8(moverState.teamID);
+                writer.WriteU16(inertialData.curHeading);
+
+                if(m_Quantize)
+                {
+                    writer.WriteU16(static_cast<uint16_t>(Quantize(inertialData.curSpeed, GAME_STATE_SPEED_QUANTUM, 0.0, UINT16_MAX)));
+                    writer.WriteI32(static_cast<int32_t>(Quantize(inertialData.xCoord, GAME_STATE_COORD_QUANTUM, INT32_MIN, INT32_MAX)));
+                    writer.WriteI32(static_cast<int32_t>(Quantize(inertialData.yCoord, GAME_STATE_COORD_QUANTUM, INT32_MIN, INT32_MAX)));
+                }
+                else
+                {
+                    writer.WriteF64(inertialData.curSpeed);
+                    writer.WriteF64(inertialData.xCoord);
+                    writer.WriteF64(inertialData.yCoord);
+                }
+            }
+
+            if(writer.HasOverflowed())
+            {
+                return 0;
+            }
+
+            // only now is the receiver certain to be sent these IDs
+            if(m_ResetPending)
+            {
+                std::fill(m_SentIDs.begin(), m_SentIDs.end(), 0);
+                m_ResetPending = false;
+            }
+            for(const size_t i : m_NewIDs)
+            {
+                const MoverHandle& handle = moverList[i].handle;
+                if(handle.index >= m_SentIDs.size())
+                {
+                    m_SentIDs.resize(static_cast<size_t>(handle.index) + 1, 0);
+                }
+                m_SentIDs[handle.index] = static_cast<uint64_t>(handle.generation) + 1;
+            }
+
+            return writer.GetSize();
+        }
+
+        void GameStateBinaryEncoder::Reset()
+        {
+            m_ResetPending = true;
+        }
+    } // namespace sim
+} // namespace vector
@@ -0,0 +1,102 @@
+#include "sim/GameStateDeltaDecoder.h"
+
+namespace vector
+{
+    namespace sim
+    {
+        bool GameStateDeltaDecoder::Apply(const GameStateDelta& delta)
+        {
+            if(delta.keyframe)
+            {
+                m_GameState.moverList = delta.added;
+                m_Sequence = delta.sequence;
+                m_Synchronised = true;
+                return true;
+            }
+
+            if(!m_Synchronised || delta.baseSequence != m_Sequence)
+            {
+                return false;
+            }
+
+            const std::vector<MoverState>& previous = m_GameState.moverList;
+            size_t addedIndex = 0;
+            size_t removedIndex = 0;
+            size_t changedIndex = 0;
+
+            m_ScratchList.clear();
+            m_ScratchList.reserve(previous.size() + delta.added.size());
+
+            // every list is ordered by handle index, so the new state is merged in one pass
+            for(const auto& moverState : previous)
+            {
+                while(addedIndex < delta.added.size() && delta.added[addedIndex].handle.index < moverState.handle.index)
+                {
+                    m_ScratchList.push_back(delta.added[addedIndex++]);
+                }
+
+                if(removedIndex < delta.removed.size() && delta.removed[removedIndex] == moverState.handle)
+                {
+                    ++removedIndex;
+                    continue;
+                }
+
+                m_ScratchList.push_back(moverState);
+
+                if(changedIndex < delta.changed.size() && delta.changed[changedIndex].handle == moverState.handle)
+                {
+                    const MoverStateChange& change = delta.changed[changedIndex++];
+                    InertialData& inertialData = m_ScratchList.back().inertialData;
+
+                    if(change.changedFields & MOVER_FIELD_HEADING)
+                    {
+                        inertialData.curHeading = change.inertialData.curHeading;
+                    }
+                    if(change.changedFields & MOVER_FIELD_SPEED)
+                    {
+                        inertialData.curSpeed = change.inertialData.curSpeed;
+                    }
+                    if(change.changedFields & MOVER_FIELD_X_COORD)
+                    {
+                        inertialData.xCoord = change.inertialData.xCoord;
+                    }
+                    if(change.changedFields & MOVER_FIELD_Y_COORD)
+                    {
+                        inertialData.yCoord = change.inertialData.yCoord;
+                    }
+                }
+            }
+
+            while(addedIndex < delta.added.size())
+            {
+                m_ScratchList.push_back(delta.added[addedIndex++]);
+            }
+
+            // a removal or change that matched nothing means the delta was not made against this state
+            if(removedIndex != delta.removed.size() || changedIndex != delta.changed.size())
+            {
+                return false;
+            }
+
+            m_GameState.moverList.swap(m_ScratchList);
+            m_Sequence = delta.sequence;
+
+            return true;
+        }
+
+        const GameState& GameStateDeltaDecoder::GetGameState() const
+        {
+            return m_GameState;
+        }
+
+        bool GameStateDeltaDecoder::IsSynchronised() const
+        {
+            return m_Synchronised;
+        }
+
+        uint64_t GameStateDeltaDecoder::GetSequence() const
+        {
+            return m_Sequence;
+        }
+    } // namespace sim
+} // namespace vector
@@ -0,0 +1,91 @@
+#include "sim/GameStateDeltaEncoder.h"
+
+#include <algorithm>
+
+namespace vector
+{
+    namespace sim
+    {
+        GameStateDeltaEncoder::GameStateDeltaEncoder(const size_t keyframeInterval)
+            : m_KeyframeInterval(std::max<size_t>(keyframeInterval, 1))
+        {
+        }
+
+        GameStateDelta GameStateDeltaEncoder::Encode(std::shared_ptr<const GameState> gameStatePtr)
+        {
+            GameStateDelta delta;
+            delta.baseSequence = m_Sequence;
+            delta.sequence = ++m_Sequence;
+
+            if(m_KeyframeRequested || m_PreviousStatePtr == nullptr || m_DeltasSinceKeyframe + 1 >= m_KeyframeInterval)
+            {
+                delta.keyframe = true;
+                delta.added = gameStatePtr->moverList;
+                m_DeltasSinceKeyframe = 0;
+                m_KeyframeRequested = false;
+            }
+            else
+            {
+                Diff(*gameStatePtr, delta);
+                ++m_DeltasSinceKeyframe;
+            }
+
+            m_PreviousStatePtr = std::move(gameStatePtr);
+
+            return delta;
+        }
+
+        void GameStateDeltaEncoder::RequestKeyframe()
+        {
+            m_KeyframeRequested = true;
+        }
+
+        void GameStateDeltaEncoder::Diff(const GameState& gameState, GameStateDelta& delta) const
+        {
+            const std::vector<MoverState>& previous = m_PreviousStatePtr->moverList;
+            const std::vector<MoverState>& current = gameState.moverList;
+
+            size_t prevIndex = 0;
+            size_t curIndex = 0;
+
+            // both lists are ordered by handle index, so one merge pass pairs up every Mover
+            while(prevIndex < previous.size() || curIndex < current.size())
+            {
+                if(curIndex == current.size() ||
+                    (prevIndex < previous.size() && previous[prevIndex].handle.index < current[curIndex].handle.index))
+                {
+                    delta.removed.push_back(previous[prevIndex++].handle);
+                }
+                else if(prevIndex == previous.size() || current[curIndex].handle.index < previous[prevIndex].handle.index)
+                {
+                    delta.added.push_back(current[curIndex++]);
+                }
+                else if(previous[prevIndex].handle.generation != current[curIndex].handle.generation)
+                {
+                    // the handle index was reused by a new Mover
+                    delta.removed.push_back(previous[prevIndex++].handle);
+                    delta.added.push_back(current[curIndex++]);
+                }
+                else
+                {
+                    const InertialData& prevData = previous[prevIndex++].inertialData;
+                    const MoverState& curState = current[curIndex++];
+
+                    MoverStateChange change;
+                    change.changedFields =
+                        (prevData.curHeading != curState.inertialData.curHeading ? MOVER_FIELD_HEADING : 0) |
+                        (prevData.curSpeed != curState.inertialData.curSpeed ? MOVER_FIELD_SPEED : 0) |
+                        (prevData.xCoord != curState.inertialData.xCoord ? MOVER_FIELD_X_COORD : 0) |
+                        (prevData.yCoord != curState.inertialData.yCoord ? MOVER_FIELD_Y_COORD : 0);
+
+                    if(change.changedFields != 0)
+                    {
+                        change.handle = curState.handle;
+                        change.inertialData = curState.inertialData;
+                        delta.changed.push_back(change);
+                    }
+                }
+            }
+        }
+    } // namespace sim
+} // namespace vector
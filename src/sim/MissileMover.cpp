@@ -0,0 +1,156 @@
+#include "sim/MissileMover.h"
+#include "sim/SimConstants.h"
+#include "util/MathUtil.h"
+
+#include <algorithm>
+
+namespace vector
+{
+    namespace sim
+    {
+        MissileMover::MissileMover(const std::string_view ID, const vector::sim::team_ID teamID, const InertialData launchData, const MoverHandle targetHandle)
+            : m_InertialData(launchData)
+            , m_DesiredHeading(launchData.curHeading)
+            , m_TargetHandle(targetHandle)
+            , m_IDLength(static_cast<uint8_t>(std::min(ID.size(), MISSILE_ID_SIZE)))
+            , m_Status(true)
+            , m_TeamID(teamID)
+        {
+            std::copy_n(ID.data(), m_IDLength, m_ID.data());
+        }
+
+        std::string MissileMover::GetID() const
+        {
+            return std::string(GetIDView());
+        }
+
+        std::string_view MissileMover::GetIDView() const
+        {
+            return std::string_view(m_ID.data(), m_IDLength);
+        }
+
+        void MissileMover::Move()
+        {
+            if(!m_Status)
+            {
+                return;
+            }
+
+            // turn the shorter way round, by no more than the turn rate
+            const int offset = (m_DesiredHeading - m_InertialData.curHeading + HEADING_FULL_CIRCLE + HEADING_HALF_CIRCLE) % HEADING_FULL_CIRCLE
+                                - HEADING_HALF_CIRCLE;
+            const int turn = std::clamp<int>(offset, -MISSILE_TURN_RATE, MISSILE_TURN_RATE);
+            m_InertialData.curHeading = static_cast<angle>((m_InertialData.curHeading + turn + HEADING_FULL_CIRCLE) % HEADING_FULL_CIRCLE);
+            m_InertialData.curSpeed = std::min(MISSILE_SPEED_MAX, m_InertialData.curSpeed + MISSILE_ACCL);
+
+            const vector::util::VelocityComponents velocity = vector::util::MathUtil::GetVelocityComponents(m_InertialData.curSpeed,
+                                                                                                            m_InertialData.curHeading);
+            m_InertialData.xCoord += velocity.xComponent;
+            m_InertialData.yCoord += velocity.yComponent;
+
+            if(m_FuelTicks > 0)
+            {
+                --m_FuelTicks;
+            }
+
+            if(m_FuelTicks == 0 ||
+                m_InertialData.xCoord < X_COORD_MIN || m_InertialData.xCoord > X_COORD_MAX ||
+                m_InertialData.yCoord < Y_COORD_MIN || m_InertialData.yCoord > Y_COORD_MAX)
+            {
+                m_Status = false;
+            }
+        }
+
+        bool MissileMover::SetNewHeading(const angle newHeadingDegrees)
+        {
+            if(newHeadingDegrees >= HEADING_MIN && newHeadingDegrees <= HEADING_MAX)
+            {
+                m_DesiredHeading = newHeadingDegrees;
+                return true;
+            }
+
+            return false;
+        }
+
+        angle MissileMover::GetDesiredHeading() const
+        {
+            return m_DesiredHeading;
+        }
+
+        void MissileMover::Guide(const coord xCoord, const coord yCoord)
+        {
+            m_DesiredHeading = vector::util::MathUtil::GetBearing(xCoord - m_InertialData.xCoord, yCoord - m_InertialData.yCoord);
+        }
+
+        bool MissileMover::SetInitialInertialData(const InertialData initialInertialData)
+        {
+            if(initialInertialData.curHeading > HEADING_MAX ||
+                initialInertialData.curSpeed < SPEED_MIN || initialInertialData.curSpeed > MISSILE_SPEED_MAX)
+            {
+                return false;
+            }
+
+            m_InertialData = initialInertialData;
+            m_DesiredHeading = m_InertialData.curHeading;
+
+            return true;
+        }
+
+        InertialData MissileMover::GetInertialData() const
+        {
+            return m_InertialData;
+        }
+
+        void MissileMover::Destroy()
+        {
+            m_Status = false;
+        }
+
+        bool MissileMover::GetStatus() const
+        {
+            return m_Status;
+        }
+
+        vector::sim::team_ID MissileMover::GetTeam() const
+        {
+            return m_TeamID;
+        }
+
+        MoverParams MissileMover::GetPerformanceValues() const
+        {
+            // missiles are guided by their launcher's team, they carry no radar or missiles of their own
+            MoverParams performanceValues;
+            performanceValues.maxSpeed = MISSILE_SPEED_MAX;
+            performanceValues.turnRate = MISSILE_TURN_RATE;
+            performanceValues.radarRange = 0.0;
+            performanceValues.numMissiles = 0;
+
+            return performanceValues;
+        }
+
+        std::string MissileMover::ToString() const
+        {
+            return GetID() + "\nx: " + std::to_string(m_InertialData.xCoord) + "\ny: " + std::to_string(m_InertialData.yCoord) +
+                            "\nheading: " + std::to_string(m_InertialData.curHeading) + "\nspeed: " + std::to_string(m_InertialData.curSpeed) +
+                            "\nfuel: " + std::to_string(m_FuelTicks);
+        }
+
+        MoverHandle MissileMover::GetTarget() const
+        {
+            return m_TargetHandle;
+        }
+
+        uint32_t MissileMover::GetFuelTicks() const
+        {
+            return m_FuelTicks;
+        }
+
+        void MissileMover::Restore(const InertialData inertialData, const angle desiredHeading, const uint32_t fuelTicks, const bool status)
+        {
+            m_InertialData = inertialData;
+            m_DesiredHeading = desiredHeading;
+            m_FuelTicks = fuelTicks;
+            m_Status = status;
+        }
+    } // namespace sim
+} // namespace vector
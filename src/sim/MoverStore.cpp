@@ -0,0 +1,287 @@
+#include "sim/MoverStore.h"
+#include "sim/FighterKinematics.h"
+
+namespace vector
+{
+    namespace sim
+    {
+        static const uint32_t INVALID_DENSE_INDEX = UINT32_MAX;
+
+        store_slot MoverStore::Add(const std::string& ID, const vector::sim::team_ID teamID, const MoverParams performanceValues)
+        {
+            store_slot slot = INVALID_STORE_SLOT;
+            if(!m_FreeSlots.empty())
+            {
+                slot = m_FreeSlots.back();
+                m_FreeSlots.pop_back();
+                m_SlotToDense[slot] = static_cast<uint32_t>(m_DenseToSlot.size());
+            }
+            else
+            {
+                slot = static_cast<store_slot>(m_SlotToDense.size());
+                m_SlotToDense.push_back(static_cast<uint32_t>(m_DenseToSlot.size()));
+                m_SlotGenerations.push_back(0);
+            }
+            m_DenseToSlot.push_back(slot);
+
+            m_Headings.push_back(0);
+            m_Speeds.push_back(0.0);
+            m_XCoords.push_back(0.0);
+            m_YCoords.push_back(0.0);
+            m_DesiredHeadings.push_back(0);
+            m_Statuses.push_back(true);
+            m_Teams.push_back(teamID);
+            m_IDs.push_back(ID);
+            m_PerformanceValues.push_back(performanceValues);
+
+            return slot;
+        }
+
+        bool MoverStore::Remove(const store_slot slot)
+        {
+            if(!IsValid(slot))
+            {
+                return false;
+            }
+
+            // swap the last fighter into the removed fighter's place to keep the arrays packed
+            size_t index = m_SlotToDense[slot];
+            size_t last = m_DenseToSlot.size() - 1;
+
+            if(index != last)
+            {
+                m_Headings[index] = m_Headings[last];
+                m_Speeds[index] = m_Speeds[last];
+                m_XCoords[index] = m_XCoords[last];
+                m_YCoords[index] = m_YCoords[last];
+                m_DesiredHeadings[index] = m_DesiredHeadings[last];
+                m_Statuses[index] = m_Statuses[last];
+                m_Teams[index] = m_Teams[last];
+                m_IDs[index] = std::move(m_IDs[last]);
+                m_PerformanceValues[index] = m_PerformanceValues[last];
+
+                m_DenseToSlot[index] = m_DenseToSlot[last];
+                m_SlotToDense[m_DenseToSlot[index]] = static_cast<uint32_t>(index);
+            }
+
+            m_Headings.pop_back();
+            m_Speeds.pop_back();
+            m_XCoords.pop_back();
+            m_YCoords.pop_back();
+            m_DesiredHeadings.pop_back();
+            m_Statuses.pop_back();
+            m_Teams.pop_back();
+            m_IDs.pop_back();
+            m_PerformanceValues.pop_back();
+            m_DenseToSlot.pop_back();
+
+            m_SlotToDense[slot] = INVALID_DENSE_INDEX;
+            // views of the removed fighter no longer match once the slot is reused
+            ++m_SlotGenerations[slot];
+            m_FreeSlots.push_back(slot);
+
+            return true;
+        }
+
+        void MoverStore::RemoveDestroyed(std::vector<store_slot>& removedSlots)
+        {
+            const size_t firstRemoved = removedSlots.size();
+            for(size_t i = 0; i < m_Statuses.size(); ++i)
+            {
+                if(!m_Statuses[i])
+                {
+                    removedSlots.push_back(m_DenseToSlot[i]);
+                }
+            }
+
+            for(size_t i = firstRemoved; i < removedSlots.size(); ++i)
+            {
+                Remove(removedSlots[i]);
+            }
+        }
+
+        void MoverStore::MoveAll()
+        {
+            MoveRange(0, m_DenseToSlot.size());
+        }
+
+        void MoverStore::MoveRange(const size_t begin, const size_t count)
+        {
+            if(begin + count > m_DenseToSlot.size())
+            {
+                return;
+            }
+
+            FighterBatch batch;
+            batch.headings = m_Headings.data() + begin;
+            batch.desiredHeadings = m_DesiredHeadings.data() + begin;
+            batch.speeds = m_Speeds.data() + begin;
+            batch.xCoords = m_XCoords.data() + begin;
+            batch.yCoords = m_YCoords.data() + begin;
+            batch.statuses = m_Statuses.data() + begin;
+            batch.count = count;
+
+            FighterKinematics::MoveBatch(batch);
+        }
+
+        void MoverStore::Move(const store_slot slot)
+        {
+            if(IsValid(slot))
+            {
+                size_t index = m_SlotToDense[slot];
+                InertialData inertialData = LoadInertialData(index);
+                if(!FighterKinematics::Move(inertialData, m_DesiredHeadings[index]))
+                {
+                    m_Statuses[index] = false;
+                }
+                StoreInertialData(index, inertialData);
+            }
+        }
+
+        bool MoverStore::IsValid(const store_slot slot) const
+        {
+            return slot < m_SlotToDense.size() && m_SlotToDense[slot] != INVALID_DENSE_INDEX;
+        }
+
+        uint32_t MoverStore::GetGeneration(const store_slot slot) const
+        {
+            if(slot < m_SlotGenerations.size())
+            {
+                return m_SlotGenerations[slot];
+            }
+            return 0;
+        }
+
+        size_t MoverStore::GetSize() const
+        {
+            return m_DenseToSlot.size();
+        }
+
+        store_slot MoverStore::GetSlot(const size_t index) const
+        {
+            return m_DenseToSlot[index];
+        }
+
+        bool MoverStore::RestoreState(const store_slot slot, const InertialData& inertialData, const angle desiredHeading, const bool status)
+        {
+            if(!IsValid(slot))
+            {
+                return false;
+            }
+
+            const size_t index = m_SlotToDense[slot];
+            StoreInertialData(index, inertialData);
+            m_DesiredHeadings[index] = desiredHeading;
+            m_Statuses[index] = status;
+
+            return true;
+        }
+
+        std::string MoverStore::GetID(const store_slot slot) const
+        {
+            if(IsValid(slot))
+            {
+                return m_IDs[m_SlotToDense[slot]];
+            }
+            return "";
+        }
+
+        std::string_view MoverStore::GetIDView(const store_slot slot) const
+        {
+            if(IsValid(slot))
+            {
+                return m_IDs[m_SlotToDense[slot]];
+            }
+            return std::string_view();
+        }
+
+        bool MoverStore::SetNewHeading(const store_slot slot, const angle newHeadingDegrees)
+        {
+            if(IsValid(slot) && FighterKinematics::IsValidHeading(newHeadingDegrees))
+            {
+                m_DesiredHeadings[m_SlotToDense[slot]] = newHeadingDegrees;
+                return true;
+            }
+            return false;
+        }
+
+        angle MoverStore::GetDesiredHeading(const store_slot slot) const
+        {
+            if(IsValid(slot))
+            {
+                return m_DesiredHeadings[m_SlotToDense[slot]];
+            }
+            return 0;
+        }
+
+        bool MoverStore::SetInitialInertialData(const store_slot slot, const InertialData initialInertialData)
+        {
+            if(IsValid(slot) && FighterKinematics::IsValidInitialInertialData(initialInertialData))
+            {
+                size_t index = m_SlotToDense[slot];
+                StoreInertialData(index, initialInertialData);
+                m_DesiredHeadings[index] = initialInertialData.curHeading;
+                return true;
+            }
+            return false;
+        }
+
+        InertialData MoverStore::GetInertialData(const store_slot slot) const
+        {
+            if(IsValid(slot))
+            {
+                return LoadInertialData(m_SlotToDense[slot]);
+            }
+            return InertialData();
+        }
+
+        void MoverStore::Destroy(const store_slot slot)
+        {
+            if(IsValid(slot))
+            {
+                m_Statuses[m_SlotToDense[slot]] = false;
+            }
+        }
+
+        bool MoverStore::GetStatus(const store_slot slot) const
+        {
+            return IsValid(slot) && m_Statuses[m_SlotToDense[slot]];
+        }
+
+        vector::sim::team_ID MoverStore::GetTeam(const store_slot slot) const
+        {
+            if(IsValid(slot))
+            {
+                return m_Teams[m_SlotToDense[slot]];
+            }
+            return UNK_TEAM_ID;
+        }
+
+        MoverParams MoverStore::GetPerformanceValues(const store_slot slot) const
+        {
+            if(IsValid(slot))
+            {
+                return m_PerformanceValues[m_SlotToDense[slot]];
+            }
+            return MoverParams();
+        }
+
+        InertialData MoverStore::LoadInertialData(const size_t index) const
+        {
+            InertialData inertialData;
+            inertialData.curHeading = m_Headings[index];
+            inertialData.curSpeed = m_Speeds[index];
+            inertialData.xCoord = m_XCoords[index];
+            inertialData.yCoord = m_YCoords[index];
+            return inertialData;
+        }
+
+        void MoverStore::StoreInertialData(const size_t index, const InertialData& inertialData)
+        {
+            m_Headings[index] = inertialData.curHeading;
+            m_Speeds[index] = inertialData.curSpeed;
+            m_XCoords[index] = inertialData.xCoord;
+            m_YCoords[index] = inertialData.yCoord;
+        }
+    } // namespace sim
+} // namespace vector
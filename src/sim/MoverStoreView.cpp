@@ -0,0 +1,81 @@
+#include "sim/MoverStoreView.h"
+
+namespace vector
+{
+    namespace sim
+    {
+        MoverStoreView::MoverStoreView(MoverStore& store, const store_slot slot)
+            : m_Store(store)
+            , m_Slot(slot)
+            , m_Generation(store.GetGeneration(slot))
+        {
+        }
+
+        std::string MoverStoreView::GetID() const
+        {
+            return m_Store.GetID(GetSlot());
+        }
+
+        void MoverStoreView::Move()
+        {
+            m_Store.Move(GetSlot());
+        }
+
+        bool MoverStoreView::SetNewHeading(const angle newHeadingDegrees)
+        {
+            return m_Store.SetNewHeading(GetSlot(), newHeadingDegrees);
+        }
+
+        angle MoverStoreView::GetDesiredHeading() const
+        {
+            return m_Store.GetDesiredHeading(GetSlot());
+        }
+
+        bool MoverStoreView::SetInitialInertialData(const InertialData initialInertialData)
+        {
+            return m_Store.SetInitialInertialData(GetSlot(), initialInertialData);
+        }
+
+        InertialData MoverStoreView::GetInertialData() const
+        {
+            return m_Store.GetInertialData(GetSlot());
+        }
+
+        void MoverStoreView::Destroy()
+        {
+            m_Store.Destroy(GetSlot());
+        }
+
+        bool MoverStoreView::GetStatus() const
+        {
+            return m_Store.GetStatus(GetSlot());
+        }
+
+        vector::sim::team_ID MoverStoreView::GetTeam() const
+        {
+            return m_Store.GetTeam(GetSlot());
+        }
+
+        MoverParams MoverStoreView::GetPerformanceValues() const
+        {
+            return m_Store.GetPerformanceValues(GetSlot());
+        }
+
+        std::string MoverStoreView::ToString() const
+        {
+            InertialData inertialData = m_Store.GetInertialData(GetSlot());
+
+            return "" + m_Store.GetID(GetSlot()) + "\nx: " + std::to_string(inertialData.xCoord) + "\ny: " + std::to_string(inertialData.yCoord) +
+                            "\nheading: " + std::to_string(inertialData.curHeading) + "\nspeed: " + std::to_string(inertialData.curSpeed);
+        }
+
+        store_slot MoverStoreView::GetSlot() const
+        {
+            if(m_Store.GetGeneration(m_Slot) != m_Generation)
+            {
+                return INVALID_STORE_SLOT;
+            }
+            return m_Slot;
+        }
+    } // namespace sim
+} // namespace vector
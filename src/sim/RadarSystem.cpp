@@ -0,0 +1,247 @@
+#include "sim/RadarSystem.h"
+#include "sim/SimConstants.h"
+#include "util/MathUtil.h"
+
+#include <algorithm>
+
+namespace vector
+{
+    namespace sim
+    {
+        // emitters per parallel task, each runs its own grid query
+        static const size_t RADAR_EMITTERS_PER_TASK = 256;
+
+        void RadarSystem::ClearEmitters()
+        {
+            m_Emitters.clear();
+        }
+
+        void RadarSystem::AddEmitter(const uint32_t index, const team_ID teamID, const InertialData& inertialData, const MoverParams& performanceValues)
+        {
+            if(!(performanceValues.radarRange > 0.0))
+            {
+                return;
+            }
+
+            Emitter emitter;
+            emitter.index = index;
+            emitter.teamID = teamID;
+            emitter.xCoord = inertialData.xCoord;
+            emitter.yCoord = inertialData.yCoord;
+            emitter.range = performanceValues.radarRange;
+            emitter.headingSine = vector::util::MathUtil::GetHeadingSine(inertialData.curHeading);
+            emitter.headingCosine = vector::util::MathUtil::GetHeadingCosine(inertialData.curHeading);
+            // half angles of 180 or more see all round
+            emitter.halfAngleCosine = (performanceValues.radarHalfAngle >= HEADING_HALF_CIRCLE) ?
+                                        -1.0 : vector::util::MathUtil::GetHeadingCosine(performanceValues.radarHalfAngle);
+            m_Emitters.push_back(emitter);
+        }
+
+        void RadarSystem::Sweep(const SpatialGrid& grid, const std::vector<team_ID>& teamsByIndex, vector::util::ThreadPool* poolPtr)
+        {
+            // give each team with a radar a row in the detection bitmaps
+            m_TeamRows.fill(NO_TEAM_ROW);
+            size_t numTeamRows = 0;
+            for(const auto& emitter : m_Emitters)
+            {
+                if(m_TeamRows[emitter.teamID] == NO_TEAM_ROW)
+                {
+                    m_TeamRows[emitter.teamID] = static_cast<uint16_t>(numTeamRows++);
+                }
+            }
+
+            const size_t numEmitters = m_Emitters.size();
+            const size_t numIndices = teamsByIndex.size();
+
+            // the number of enemies each team could detect, once a team has them all its other emitters can stop
+            std::array<size_t, UINT8_MAX + 1> teamSizes{};
+            size_t numIndexed = 0;
+            for(uint32_t index = 0; index < numIndices; ++index)
+            {
+                if(grid.Contains(index))
+                {
+                    ++teamSizes[teamsByIndex[index]];
+                    ++numIndexed;
+                }
+            }
+            m_RowEnemies.assign(numTeamRows, 0);
+            for(size_t teamID = 0; teamID < m_TeamRows.size(); ++teamID)
+            {
+                if(m_TeamRows[teamID] != NO_TEAM_ROW)
+                {
+                    m_RowEnemies[m_TeamRows[teamID]] = numIndexed - teamSizes[teamID];
+                }
+            }
+            size_t numTasks = 1;
+            if(poolPtr != nullptr && numEmitters > RADAR_EMITTERS_PER_TASK)
+            {
+                numTasks = std::min(poolPtr->GetNumThreads(), (numEmitters + RADAR_EMITTERS_PER_TASK - 1) / RADAR_EMITTERS_PER_TASK);
+            }
+
+            if(m_TaskDetections.size() < numTasks)
+            {
+                m_TaskDetections.resize(numTasks);
+            }
+
+            // each task marks what its emitters see in its own bitmap, so nothing is shared while sweeping
+            auto sweepTask = [this, numTasks, numEmitters, numIndices, numTeamRows, &grid, &teamsByIndex](const size_t taskIndex)
+            {
+                std::vector<uint8_t>& detected = m_TaskDetections[taskIndex];
+                detected.assign(numTeamRows * numIndices, 0);
+
+                const size_t perTask = (numEmitters + numTasks - 1) / numTasks;
+                const size_t begin = std::min(taskIndex * perTask, numEmitters);
+                SweepRange(begin, std::min(begin + perTask, numEmitters), grid, teamsByIndex, detected);
+            };
+
+            if(numTasks == 1)
+            {
+                sweepTask(0);
+            }
+            else
+            {
+                poolPtr->ParallelFor(numTasks, sweepTask);
+            }
+
+            std::vector<uint8_t>& detected = m_TaskDetections[0];
+            for(size_t task = 1; task < numTasks; ++task)
+            {
+                const std::vector<uint8_t>& taskDetected = m_TaskDetections[task];
+                for(size_t i = 0; i < detected.size(); ++i)
+                {
+                    detected[i] |= taskDetected[i];
+                }
+            }
+
+            // read each team's row out in index order, carrying identification over from the last sweep
+            for(size_t teamID = 0; teamID < m_TeamContacts.size() || teamID < m_TeamRows.size(); ++teamID)
+            {
+                if(m_TeamRows[teamID] == NO_TEAM_ROW)
+                {
+                    if(teamID < m_TeamContacts.size())
+                    {
+                        m_TeamContacts[teamID].clear();
+                    }
+                    continue;
+                }
+
+                if(teamID >= m_TeamContacts.size())
+                {
+                    m_TeamContacts.resize(teamID + 1);
+                }
+
+                std::vector<Contact>& contacts = m_TeamContacts[teamID];
+                std::swap(contacts, m_PreviousContacts);
+                contacts.clear();
+
+                const uint8_t* row = detected.data() + m_TeamRows[teamID] * numIndices;
+                auto previousItr = m_PreviousContacts.begin();
+                for(uint32_t index = 0; index < numIndices; ++index)
+                {
+                    if(row[index] == 0)
+                    {
+                        continue;
+                    }
+
+                    while(previousItr != m_PreviousContacts.end() && previousItr->index < index)
+                    {
+                        ++previousItr;
+                    }
+
+                    const bool identified = previousItr != m_PreviousContacts.end() && previousItr->index == index && previousItr->identified;
+                    contacts.push_back(Contact{index, identified});
+                }
+            }
+        }
+
+        const std::vector<RadarSystem::Contact>& RadarSystem::GetContacts(const team_ID teamID) const
+        {
+            if(teamID < m_TeamContacts.size())
+            {
+                return m_TeamContacts[teamID];
+            }
+            return m_NoContacts;
+        }
+
+        bool RadarSystem::IsContact(const team_ID teamID, const uint32_t index) const
+        {
+            const std::vector<Contact>& contacts = GetContacts(teamID);
+            auto contactItr = std::lower_bound(contacts.begin(), contacts.end(), index,
+                                    [](const Contact& contact, const uint32_t value) { return contact.index < value; });
+
+            return contactItr != contacts.end() && contactItr->index == index;
+        }
+
+        bool RadarSystem::Identify(const team_ID teamID, const uint32_t index)
+        {
+            if(teamID >= m_TeamContacts.size())
+            {
+                return false;
+            }
+
+            std::vector<Contact>& contacts = m_TeamContacts[teamID];
+            auto contactItr = std::lower_bound(contacts.begin(), contacts.end(), index,
+                                    [](const Contact& contact, const uint32_t value) { return contact.index < value; });
+            if(contactItr == contacts.end() || contactItr->index != index)
+            {
+                return false;
+            }
+
+            contactItr->identified = true;
+            return true;
+        }
+
+        void RadarSystem::SetContacts(const team_ID teamID, const std::vector<Contact>& contacts)
+        {
+            if(teamID >= m_TeamContacts.size())
+            {
+                m_TeamContacts.resize(teamID + 1);
+            }
+            m_TeamContacts[teamID] = contacts;
+        }
+
+        bool RadarSystem::IsInCone(const double headingSine, const double headingCosine, const double halfAngleCosine,
+                                    const coord xDelta, const coord yDelta)
+        {
+            // compare cos(offset) with cos(half angle) as dot / distance, squared to avoid the square root
+            const double dot = xDelta * headingSine + yDelta * headingCosine;
+            const double limit = halfAngleCosine * halfAngleCosine * (xDelta * xDelta + yDelta * yDelta);
+
+            if(halfAngleCosine >= 0.0)
+            {
+                return dot >= 0.0 && dot * dot >= limit;
+            }
+            return dot >= 0.0 || dot * dot <= limit;
+        }
+
+        void RadarSystem::SweepRange(const size_t begin, const size_t end, const SpatialGrid& grid, const std::vector<team_ID>& teamsByIndex,
+                                        std::vector<uint8_t>& detected) const
+        {
+            const size_t numIndices = teamsByIndex.size();
+            std::vector<size_t> rowDetections(m_RowEnemies.size(), 0);
+
+            for(size_t i = begin; i < end; ++i)
+            {
+                const Emitter& emitter = m_Emitters[i];
+                const uint16_t teamRow = m_TeamRows[emitter.teamID];
+                if(rowDetections[teamRow] == m_RowEnemies[teamRow])
+                {
+                    continue;
+                }
+
+                uint8_t* row = detected.data() + teamRow * numIndices;
+                size_t& numDetected = rowDetections[teamRow];
+                grid.VisitRadius(emitter.xCoord, emitter.yCoord, emitter.range,
+                    [&emitter, &teamsByIndex, row, numIndices, &numDetected](const uint32_t index, const coord xDelta, const coord yDelta)
+                {
+                    if(index < numIndices && row[index] == 0 && teamsByIndex[index] != emitter.teamID &&
+                        IsInCone(emitter.headingSine, emitter.headingCosine, emitter.halfAngleCosine, xDelta, yDelta))
+                    {
+                        row[index] = 1;
+                        ++numDetected;
+                    }
+                });
+            }
+        }
+    } // namespace sim
+} // namespace vector
@@ -0,0 +1,508 @@
+#include "sim/ReplayPlayer.h"
+#include "sim/GameStateBinaryDecoder.h"
+#include "sim/ReplayRecord.h"
+#include "sim/SimConstants.h"
+#include "util/BinaryReader.h"
+
+#include <algorithm>
+#include <variant>
+
+namespace vector
+{
+    namespace sim
+    {
+        // the smallest a recorded command can be
+        static const size_t TICK_COMMAND_MIN_SIZE = 12;
+        // the smallest a checkpoint's entry and team can be, and the size of each entry index and contact it lists
+        static const size_t CHECKPOINT_ENTRY_MIN_SIZE = 6;
+        static const size_t CHECKPOINT_TEAM_MIN_SIZE = 4;
+        static const size_t CHECKPOINT_INDEX_SIZE = 4;
+        static const size_t CHECKPOINT_CONTACT_SIZE = 5;
+
+        static bool ReadEntryIndices(vector::util::BinaryReader& reader, std::vector<uint32_t>& indices)
+        {
+            const uint32_t numIndices = reader.ReadU32();
+            if(reader.HasFailed() || numIndices > reader.GetRemaining() / CHECKPOINT_INDEX_SIZE)
+            {
+                return false;
+            }
+
+            indices.resize(numIndices);
+            for(auto& index : indices)
+            {
+                index = reader.ReadU32();
+            }
+            return true;
+        }
+
+        static bool IsSameMoverState(const MoverState& expected, const MoverState& actual)
+        {
+            return expected.handle == actual.handle && expected.ID == actual.ID && expected.teamID == actual.teamID &&
+                expected.inertialData.curHeading == actual.inertialData.curHeading &&
+                expected.inertialData.curSpeed == actual.inertialData.curSpeed &&
+                expected.inertialData.xCoord == actual.inertialData.xCoord &&
+                expected.inertialData.yCoord == actual.inertialData.yCoord;
+        }
+
+        bool ReplayPlayer::Open(const std::string& path)
+        {
+            Reset();
+            if(!m_File.Open(path))
+            {
+                return false;
+            }
+
+            const uint8_t* data = m_File.GetData();
+            const size_t size = m_File.GetSize();
+
+            vector::util::BinaryReader headerReader(data, size);
+            const uint32_t magic = headerReader.ReadU32();
+            const uint16_t version = headerReader.ReadU16();
+            headerReader.ReadU16();
+            if(headerReader.HasFailed() || magic != REPLAY_MAGIC || version != REPLAY_VERSION)
+            {
+                Reset();
+                return false;
+            }
+
+            size_t offset = REPLAY_HEADER_SIZE;
+            while(size - offset >= REPLAY_RECORD_HEADER_SIZE)
+            {
+                vector::util::BinaryReader recordReader(data + offset, REPLAY_RECORD_HEADER_SIZE);
+                const uint8_t type = recordReader.ReadU8();
+                const size_t payloadSize = recordReader.ReadU32();
+                if(payloadSize > size - offset - REPLAY_RECORD_HEADER_SIZE)
+                {
+                    // the record the log was cut short in
+                    break;
+                }
+
+                const RecordSpan span{offset + REPLAY_RECORD_HEADER_SIZE, payloadSize};
+                vector::util::BinaryReader payloadReader(data + span.offset, span.size);
+                bool consistent = true;
+                switch(static_cast<REPLAY_RECORD_TYPE>(type))
+                {
+                    case REPLAY_RECORD_TYPE::FIGHTER:
+                        consistent = m_Ticks.empty() && ReadFighter(span);
+                        break;
+                    case REPLAY_RECORD_TYPE::TICK:
+                        consistent = payloadReader.ReadU64() == m_Ticks.size() && !payloadReader.HasFailed();
+                        m_Ticks.push_back(span);
+                        break;
+                    case REPLAY_RECORD_TYPE::KEYFRAME:
+                    {
+                        const uint64_t ticks = payloadReader.ReadU64();
+                        consistent = ticks == m_Ticks.size() && !payloadReader.HasFailed();
+                        m_Keyframes.push_back(KeyframeSpan{ticks, span});
+                        break;
+                    }
+                    case REPLAY_RECORD_TYPE::CHECKPOINT:
+                    {
+                        const uint64_t ticks = payloadReader.ReadU64();
+                        consistent = ticks == m_Ticks.size() && !payloadReader.HasFailed();
+                        m_Checkpoints.push_back(KeyframeSpan{ticks, span});
+                        break;
+                    }
+                    default:
+                        // records of a type this version does not know are passed over
+                        break;
+                }
+
+                if(!consistent)
+                {
+                    Reset();
+                    return false;
+                }
+                offset = span.offset + span.size;
+            }
+
+            if(!Restart())
+            {
+                Reset();
+                return false;
+            }
+
+            return true;
+        }
+
+        uint64_t ReplayPlayer::GetNumTicks() const
+        {
+            return m_Ticks.size();
+        }
+
+        uint64_t ReplayPlayer::GetTicksRun() const
+        {
+            return m_TicksRun;
+        }
+
+        bool ReplayPlayer::Step()
+        {
+            if(m_GameEnginePtr == nullptr || m_TicksRun >= m_Ticks.size() || !ReadTick(m_Ticks[m_TicksRun]))
+            {
+                return false;
+            }
+
+            // queued rather than applied, so they are applied at the same point of the tick as when recorded
+            for(const auto& tickCommand : m_TickCommands)
+            {
+                m_GameEnginePtr->QueueCommand(tickCommand.subjectHandle, tickCommand.cmd);
+            }
+            m_GameEnginePtr->Tick();
+            ++m_TicksRun;
+
+            CheckKeyframe();
+
+            return true;
+        }
+
+        bool ReplayPlayer::RunTo(const uint64_t ticks)
+        {
+            if(m_GameEnginePtr == nullptr || ticks > m_Ticks.size())
+            {
+                return false;
+            }
+
+            // a checkpoint that cannot be restored is passed over, and the match run on or re-run without it
+            bool restored = false;
+            auto checkpointItr = std::upper_bound(m_Checkpoints.begin(), m_Checkpoints.end(), ticks,
+                [](const uint64_t ticks, const KeyframeSpan& checkpoint) { return ticks < checkpoint.ticks; });
+            if(checkpointItr != m_Checkpoints.begin())
+            {
+                --checkpointItr;
+                if(ticks < m_TicksRun || checkpointItr->ticks > m_TicksRun)
+                {
+                    restored = RestoreCheckpoint(*checkpointItr);
+                }
+            }
+
+            if(!restored && ticks < m_TicksRun && !Restart())
+            {
+                return false;
+            }
+
+            while(m_TicksRun < ticks)
+            {
+                if(!Step())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        std::shared_ptr<const GameState> ReplayPlayer::GetGameState() const
+        {
+            if(m_GameEnginePtr == nullptr)
+            {
+                return nullptr;
+            }
+            return m_GameEnginePtr->GetGameStateSnapshot();
+        }
+
+        bool ReplayPlayer::GetKeyframe(const uint64_t ticks, GameState& gameState, uint64_t& keyframeTicks) const
+        {
+            auto keyframeItr = std::upper_bound(m_Keyframes.begin(), m_Keyframes.end(), ticks,
+                [](const uint64_t ticks, const KeyframeSpan& keyframe) { return ticks < keyframe.ticks; });
+            if(keyframeItr == m_Keyframes.begin())
+            {
+                return false;
+            }
+            --keyframeItr;
+
+            GameState decoded;
+            if(!ReadKeyframe(keyframeItr->span, decoded))
+            {
+                return false;
+            }
+
+            gameState.moverList.swap(decoded.moverList);
+            keyframeTicks = keyframeItr->ticks;
+
+            return true;
+        }
+
+        size_t ReplayPlayer::GetNumKeyframes() const
+        {
+            return m_Keyframes.size();
+        }
+
+        size_t ReplayPlayer::GetNumCheckpoints() const
+        {
+            return m_Checkpoints.size();
+        }
+
+        uint64_t ReplayPlayer::GetNumDivergences() const
+        {
+            return m_NumDivergences;
+        }
+
+        GameEngine* ReplayPlayer::GetGameEngine() const
+        {
+            return m_GameEnginePtr.get();
+        }
+
+        bool ReplayPlayer::ReadFighter(const RecordSpan span)
+        {
+            vector::util::BinaryReader reader(m_File.GetData() + span.offset, span.size);
+
+            FighterRecord fighter;
+            fighter.handle.index = reader.ReadU32();
+            fighter.handle.generation = reader.ReadU32();
+            fighter.teamID = reader.ReadU8();
+            const uint16_t IDLength = reader.ReadU16();
+            reader.ReadString(IDLength, fighter.ID);
+            fighter.performanceValues.maxSpeed = reader.ReadF64();
+            fighter.performanceValues.turnRate = reader.ReadU16();
+            fighter.performanceValues.radarRange = reader.ReadF64();
+            fighter.performanceValues.radarHalfAngle = reader.ReadU16();
+            fighter.performanceValues.numMissiles = reader.ReadU32();
+            fighter.initialData.curHeading = reader.ReadU16();
+            fighter.initialData.curSpeed = reader.ReadF64();
+            fighter.initialData.xCoord = reader.ReadF64();
+            fighter.initialData.yCoord = reader.ReadF64();
+            fighter.desiredHeading = reader.ReadU16();
+
+            if(reader.HasFailed())
+            {
+                return false;
+            }
+
+            m_Fighters.push_back(std::move(fighter));
+
+            return true;
+        }
+
+        bool ReplayPlayer::ReadTick(const RecordSpan span)
+        {
+            vector::util::BinaryReader reader(m_File.GetData() + span.offset, span.size);
+            reader.ReadU64();
+
+            const uint32_t numCommands = reader.ReadU32();
+            if(reader.HasFailed() || numCommands > reader.GetRemaining() / TICK_COMMAND_MIN_SIZE)
+            {
+                return false;
+            }
+
+            // assign over existing elements so their strings keep their capacity
+            m_TickCommands.resize(numCommands);
+            for(auto& tickCommand : m_TickCommands)
+            {
+                vector::util::Command& cmd = tickCommand.cmd;
+                tickCommand.subjectHandle.index = reader.ReadU32();
+                tickCommand.subjectHandle.generation = reader.ReadU32();
+                cmd.command = static_cast<vector::util::COMMAND_TYPE>(reader.ReadU8());
+                const uint16_t subjectLength = reader.ReadU16();
+                reader.ReadString(subjectLength, cmd.subject);
+
+                const auto payloadKind = static_cast<REPLAY_PAYLOAD_KIND>(reader.ReadU8());
+                if(payloadKind == REPLAY_PAYLOAD_KIND::HEADING)
+                {
+                    cmd.payload = vector::util::HeadingPayload{reader.ReadU16()};
+                }
+                else if(payloadKind == REPLAY_PAYLOAD_KIND::TARGET)
+                {
+                    const uint16_t callsignLength = reader.ReadU16();
+                    auto* targetPayload = std::get_if<vector::util::TargetPayload>(&cmd.payload);
+                    if(targetPayload == nullptr)
+                    {
+                        targetPayload = &cmd.payload.emplace<vector::util::TargetPayload>();
+                    }
+                    reader.ReadString(callsignLength, targetPayload->callsign);
+                }
+                else if(payloadKind == REPLAY_PAYLOAD_KIND::NONE)
+                {
+                    cmd.payload = std::monostate();
+                }
+                else
+                {
+                    return false;
+                }
+            }
+
+            return !reader.HasFailed();
+        }
+
+        bool ReplayPlayer::ReadKeyframe(const RecordSpan span, GameState& gameState) const
+        {
+            // keyframes are self-contained, so each is decoded on its own
+            GameStateBinaryDecoder decoder;
+            return span.size >= sizeof(uint64_t) &&
+                decoder.Decode(m_File.GetData() + span.offset + sizeof(uint64_t), span.size - sizeof(uint64_t), gameState);
+        }
+
+        bool ReplayPlayer::ReadCheckpoint(const RecordSpan span, EngineCheckpoint& checkpoint) const
+        {
+            vector::util::BinaryReader reader(m_File.GetData() + span.offset, span.size);
+            checkpoint.ticks = reader.ReadU64();
+            checkpoint.numMissilesLaunched = reader.ReadU64();
+
+            const uint32_t numEntries = reader.ReadU32();
+            if(reader.HasFailed() || numEntries > reader.GetRemaining() / CHECKPOINT_ENTRY_MIN_SIZE)
+            {
+                return false;
+            }
+
+            // assign over existing elements so their ID strings keep their capacity
+            checkpoint.entries.resize(numEntries);
+            for(auto& entry : checkpoint.entries)
+            {
+                const uint8_t type = reader.ReadU8();
+                if(type > static_cast<uint8_t>(CHECKPOINT_ENTRY_TYPE::MISSILE))
+                {
+                    return false;
+                }
+                entry.type = static_cast<CHECKPOINT_ENTRY_TYPE>(type);
+                entry.generation = reader.ReadU32();
+                entry.teamID = reader.ReadU8();
+                if(entry.type == CHECKPOINT_ENTRY_TYPE::FREE)
+                {
+                    entry.ID.clear();
+                    continue;
+                }
+
+                const uint16_t IDLength = reader.ReadU16();
+                reader.ReadString(IDLength, entry.ID);
+                entry.inertialData.curHeading = reader.ReadU16();
+                entry.inertialData.curSpeed = reader.ReadF64();
+                entry.inertialData.xCoord = reader.ReadF64();
+                entry.inertialData.yCoord = reader.ReadF64();
+                entry.desiredHeading = reader.ReadU16();
+                entry.status = reader.ReadU8() != 0;
+                entry.inSpatialIndex = reader.ReadU8() != 0;
+
+                if(entry.type == CHECKPOINT_ENTRY_TYPE::FIGHTER)
+                {
+                    entry.performanceValues.maxSpeed = reader.ReadF64();
+                    entry.performanceValues.turnRate = reader.ReadU16();
+                    entry.performanceValues.radarRange = reader.ReadF64();
+                    entry.performanceValues.radarHalfAngle = reader.ReadU16();
+                    entry.performanceValues.numMissiles = reader.ReadU32();
+                    entry.lockedTarget.index = reader.ReadU32();
+                    entry.lockedTarget.generation = reader.ReadU32();
+                    entry.missilesRemaining = reader.ReadU32();
+                }
+                else
+                {
+                    entry.target.index = reader.ReadU32();
+                    entry.target.generation = reader.ReadU32();
+                    entry.fuelTicks = reader.ReadU32();
+                }
+            }
+
+            if(!ReadEntryIndices(reader, checkpoint.freeEntries) || !ReadEntryIndices(reader, checkpoint.storeOrder) ||
+                !ReadEntryIndices(reader, checkpoint.missileEntries))
+            {
+                return false;
+            }
+
+            const uint16_t numTeams = reader.ReadU16();
+            if(reader.HasFailed() || numTeams > reader.GetRemaining() / CHECKPOINT_TEAM_MIN_SIZE)
+            {
+                return false;
+            }
+
+            checkpoint.teamContacts.resize(numTeams);
+            for(auto& contacts : checkpoint.teamContacts)
+            {
+                const uint32_t numContacts = reader.ReadU32();
+                if(reader.HasFailed() || numContacts > reader.GetRemaining() / CHECKPOINT_CONTACT_SIZE)
+                {
+                    return false;
+                }
+
+                contacts.resize(numContacts);
+                for(auto& contact : contacts)
+                {
+                    contact.index = reader.ReadU32();
+                    contact.identified = reader.ReadU8() != 0;
+                }
+            }
+
+            return !reader.HasFailed();
+        }
+
+        bool ReplayPlayer::Restart()
+        {
+            m_GameEnginePtr = std::make_unique<GameEngine>();
+            m_TicksRun = 0;
+            m_NextKeyframe = 0;
+            m_NumDivergences = 0;
+
+            for(const auto& fighter : m_Fighters)
+            {
+                const MoverHandle handle = m_GameEnginePtr->AddFighter(fighter.ID, fighter.teamID, fighter.performanceValues);
+                if(handle != fighter.handle)
+                {
+                    return false;
+                }
+                std::shared_ptr<MoverInterface> moverPtr = m_GameEnginePtr->GetMover(handle);
+                moverPtr->SetInitialInertialData(fighter.initialData);
+                moverPtr->SetNewHeading(fighter.desiredHeading);
+            }
+
+            CheckKeyframe();
+
+            return true;
+        }
+
+        bool ReplayPlayer::RestoreCheckpoint(const KeyframeSpan& checkpoint)
+        {
+            if(!ReadCheckpoint(checkpoint.span, m_Checkpoint))
+            {
+                return false;
+            }
+
+            std::unique_ptr<GameEngine> gameEnginePtr = std::make_unique<GameEngine>();
+            if(!gameEnginePtr->RestoreCheckpoint(m_Checkpoint))
+            {
+                return false;
+            }
+
+            m_GameEnginePtr = std::move(gameEnginePtr);
+            m_TicksRun = checkpoint.ticks;
+            m_NextKeyframe = static_cast<size_t>(std::lower_bound(m_Keyframes.begin(), m_Keyframes.end(), m_TicksRun,
+                [](const KeyframeSpan& keyframe, const uint64_t ticks) { return keyframe.ticks < ticks; }) - m_Keyframes.begin());
+            m_NumDivergences = 0;
+
+            // the keyframe recorded with the checkpoint checks that it was restored faithfully
+            CheckKeyframe();
+
+            return true;
+        }
+
+        void ReplayPlayer::CheckKeyframe()
+        {
+            while(m_NextKeyframe < m_Keyframes.size() && m_Keyframes[m_NextKeyframe].ticks <= m_TicksRun)
+            {
+                const KeyframeSpan& keyframe = m_Keyframes[m_NextKeyframe++];
+                if(keyframe.ticks < m_TicksRun)
+                {
+                    continue;
+                }
+
+                const std::shared_ptr<const GameState> gameStatePtr = m_GameEnginePtr->GetGameStateSnapshot();
+                const std::vector<MoverState>& moverList = gameStatePtr->moverList;
+                const bool matches = ReadKeyframe(keyframe.span, m_Keyframe) && m_Keyframe.moverList.size() == moverList.size() &&
+                    std::equal(m_Keyframe.moverList.begin(), m_Keyframe.moverList.end(), moverList.begin(), IsSameMoverState);
+                if(!matches)
+                {
+                    ++m_NumDivergences;
+                }
+            }
+        }
+
+        void ReplayPlayer::Reset()
+        {
+            m_GameEnginePtr.reset();
+            m_File.Close();
+            m_Fighters.clear();
+            m_Ticks.clear();
+            m_Keyframes.clear();
+            m_Checkpoints.clear();
+            m_TicksRun = 0;
+            m_NextKeyframe = 0;
+            m_NumDivergences = 0;
+        }
+    } // namespace sim
+} // namespace vector
@@ -0,0 +1,379 @@
+#include "sim/ReplayRecorder.h"
+#include "sim/SimConstants.h"
+#include "util/BinaryWriter.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <variant>
+
+namespace vector
+{
+    namespace sim
+    {
+        // the fixed part of a FIGHTER payload, and of a TICK payload and each of its commands
+        static const size_t FIGHTER_SIZE = 63;
+        static const size_t TICK_SIZE = 12;
+        static const size_t TICK_COMMAND_SIZE = 14;
+        // the fixed part of a CHECKPOINT payload, of each of its entries, fighters, missiles, teams and contacts,
+        // and of each entry index it lists
+        static const size_t CHECKPOINT_SIZE = 34;
+        static const size_t CHECKPOINT_ENTRY_SIZE = 6;
+        static const size_t CHECKPOINT_MOVER_SIZE = 32;
+        static const size_t CHECKPOINT_FIGHTER_SIZE = 36;
+        static const size_t CHECKPOINT_MISSILE_SIZE = 12;
+        static const size_t CHECKPOINT_TEAM_SIZE = 4;
+        static const size_t CHECKPOINT_CONTACT_SIZE = 5;
+        static const size_t CHECKPOINT_INDEX_SIZE = 4;
+
+        static void WriteEntryIndices(vector::util::BinaryWriter& writer, const std::vector<uint32_t>& indices)
+        {
+            writer.WriteU32(static_cast<uint32_t>(indices.size()));
+            for(const uint32_t index : indices)
+            {
+                writer.WriteU32(index);
+            }
+        }
+
+        ReplayRecorder::ReplayRecorder(const uint64_t keyframeInterval)
+            : m_KeyframeInterval(std::max<uint64_t>(keyframeInterval, 1)),
+            m_Buffer(REPLAY_WRITE_BUFFER_SIZE)
+        {
+        }
+
+        ReplayRecorder::~ReplayRecorder()
+        {
+            Close();
+        }
+
+        bool ReplayRecorder::Open(const std::string& path)
+        {
+            if(m_FileDescriptor >= 0)
+            {
+                return false;
+            }
+
+            m_FileDescriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if(m_FileDescriptor < 0)
+            {
+                return false;
+            }
+
+            m_Failed = false;
+            m_NumTicks = 0;
+            m_LastKeyframeTicks = UINT64_MAX;
+            m_BufferSize = 0;
+
+            vector::util::BinaryWriter writer(m_Buffer.data(), m_Buffer.size());
+            writer.WriteU32(REPLAY_MAGIC);
+            writer.WriteU16(REPLAY_VERSION);
+            writer.WriteU16(0);
+            m_BufferSize = writer.GetSize();
+            m_NumBytes = m_BufferSize;
+
+            return true;
+        }
+
+        void ReplayRecorder::RecordFighter(const MoverHandle handle, const std::string& ID, const team_ID teamID,
+                                            const MoverParams& performanceValues, const InertialData& initialData, const angle desiredHeading)
+        {
+            if(ID.size() > UINT16_MAX)
+            {
+                m_Failed = true;
+            }
+
+            uint8_t* payload = BeginRecord(REPLAY_RECORD_TYPE::FIGHTER, FIGHTER_SIZE + ID.size());
+            if(payload == nullptr)
+            {
+                return;
+            }
+
+            vector::util::BinaryWriter writer(payload, FIGHTER_SIZE + ID.size());
+            writer.WriteU32(handle.index);
+            writer.WriteU32(handle.generation);
+            writer.WriteU8(teamID);
+            writer.WriteU16(static_cast<uint16_t>(ID.size()));
+            writer.WriteBytes(ID.data(), ID.size());
+            writer.WriteF64(performanceValues.maxSpeed);
+            writer.WriteU16(performanceValues.turnRate);
+            writer.WriteF64(performanceValues.radarRange);
+            writer.WriteU16(performanceValues.radarHalfAngle);
+            writer.WriteU32(performanceValues.numMissiles);
+            writer.WriteU16(initialData.curHeading);
+            writer.WriteF64(initialData.curSpeed);
+            writer.WriteF64(initialData.xCoord);
+            writer.WriteF64(initialData.yCoord);
+            writer.WriteU16(desiredHeading);
+
+            EndRecord(writer.GetSize());
+        }
+
+        void ReplayRecorder::RecordTick(const std::vector<TickCommand>& drainedCommands)
+        {
+            size_t payloadSize = TICK_SIZE;
+            for(const auto& tickCommand : drainedCommands)
+            {
+                const auto* targetPayload = std::get_if<vector::util::TargetPayload>(&tickCommand.cmd.payload);
+                const size_t callsignSize = targetPayload != nullptr ? targetPayload->callsign.size() : 0;
+                if(tickCommand.cmd.subject.size() > UINT16_MAX || callsignSize > UINT16_MAX)
+                {
+                    m_Failed = true;
+                }
+                payloadSize += TICK_COMMAND_SIZE + tickCommand.cmd.subject.size() + callsignSize;
+            }
+
+            uint8_t* payload = BeginRecord(REPLAY_RECORD_TYPE::TICK, payloadSize);
+            if(payload == nullptr)
+            {
+                return;
+            }
+
+            vector::util::BinaryWriter writer(payload, payloadSize);
+            writer.WriteU64(m_NumTicks);
+            writer.WriteU32(static_cast<uint32_t>(drainedCommands.size()));
+            for(const auto& tickCommand : drainedCommands)
+            {
+                const vector::util::Command& cmd = tickCommand.cmd;
+                writer.WriteU32(tickCommand.subjectHandle.index);
+                writer.WriteU32(tickCommand.subjectHandle.generation);
+                writer.WriteU8(static_cast<uint8_t>(cmd.command));
+                writer.WriteU16(static_cast<uint16_t>(cmd.subject.size()));
+                writer.WriteBytes(cmd.subject.data(), cmd.subject.size());
+
+                if(const auto* headingPayload = std::get_if<vector::util::HeadingPayload>(&cmd.payload))
+                {
+                    writer.WriteU8(static_cast<uint8_t>(REPLAY_PAYLOAD_KIND::HEADING));
+                    writer.WriteU16(headingPayload->heading);
+                }
+                else if(const auto* targetPayload = std::get_if<vector::util::TargetPayload>(&cmd.payload))
+                {
+                    writer.WriteU8(static_cast<uint8_t>(REPLAY_PAYLOAD_KIND::TARGET));
+                    writer.WriteU16(static_cast<uint16_t>(targetPayload->callsign.size()));
+                    writer.WriteBytes(targetPayload->callsign.data(), targetPayload->callsign.size());
+                }
+                else
+                {
+                    writer.WriteU8(static_cast<uint8_t>(REPLAY_PAYLOAD_KIND::NONE));
+                }
+            }
+
+            EndRecord(writer.GetSize());
+            ++m_NumTicks;
+        }
+
+        bool ReplayRecorder::IsKeyframeDue() const
+        {
+            return m_FileDescriptor >= 0 && !m_Failed && m_NumTicks % m_KeyframeInterval == 0 && m_LastKeyframeTicks != m_NumTicks;
+        }
+
+        void ReplayRecorder::RecordKeyframe(const GameState& gameState)
+        {
+            // every keyframe carries all its IDs, so a reader can decode it without the ones before
+            m_KeyframeEncoder.Reset();
+            const size_t payloadSize = sizeof(uint64_t) + m_KeyframeEncoder.GetMaxEncodedSize(gameState);
+
+            uint8_t* payload = BeginRecord(REPLAY_RECORD_TYPE::KEYFRAME, payloadSize);
+            if(payload == nullptr)
+            {
+                return;
+            }
+
+            vector::util::BinaryWriter writer(payload, sizeof(uint64_t));
+            writer.WriteU64(m_NumTicks);
+
+            const size_t encodedSize = m_KeyframeEncoder.Encode(gameState, payload + sizeof(uint64_t), payloadSize - sizeof(uint64_t));
+            if(encodedSize == 0)
+            {
+                m_Failed = true;
+                return;
+            }
+
+            EndRecord(sizeof(uint64_t) + encodedSize);
+            m_LastKeyframeTicks = m_NumTicks;
+        }
+
+        void ReplayRecorder::RecordCheckpoint(const EngineCheckpoint& checkpoint)
+        {
+            size_t payloadSize = CHECKPOINT_SIZE + checkpoint.entries.size() * CHECKPOINT_ENTRY_SIZE +
+                (checkpoint.freeEntries.size() + checkpoint.storeOrder.size() + checkpoint.missileEntries.size()) * CHECKPOINT_INDEX_SIZE;
+            for(const auto& entry : checkpoint.entries)
+            {
+                if(entry.type == CHECKPOINT_ENTRY_TYPE::FIGHTER)
+                {
+                    payloadSize += CHECKPOINT_MOVER_SIZE + CHECKPOINT_FIGHTER_SIZE + entry.ID.size();
+                }
+                else if(entry.type == CHECKPOINT_ENTRY_TYPE::MISSILE)
+                {
+                    payloadSize += CHECKPOINT_MOVER_SIZE + CHECKPOINT_MISSILE_SIZE + entry.ID.size();
+                }
+
+                if(entry.ID.size() > UINT16_MAX)
+                {
+                    m_Failed = true;
+                }
+            }
+            for(const auto& contacts : checkpoint.teamContacts)
+            {
+                payloadSize += CHECKPOINT_TEAM_SIZE + contacts.size() * CHECKPOINT_CONTACT_SIZE;
+            }
+            if(checkpoint.teamContacts.size() > UINT16_MAX)
+            {
+                m_Failed = true;
+            }
+
+            uint8_t* payload = BeginRecord(REPLAY_RECORD_TYPE::CHECKPOINT, payloadSize);
+            if(payload == nullptr)
+            {
+                return;
+            }
+
+            vector::util::BinaryWriter writer(payload, payloadSize);
+            writer.WriteU64(m_NumTicks);
+            writer.WriteU64(checkpoint.numMissilesLaunched);
+            writer.WriteU32(static_cast<uint32_t>(checkpoint.entries.size()));
+            for(const auto& entry : checkpoint.entries)
+            {
+                writer.WriteU8(static_cast<uint8_t>(entry.type));
+                writer.WriteU32(entry.generation);
+                writer.WriteU8(entry.teamID);
+                if(entry.type == CHECKPOINT_ENTRY_TYPE::FREE)
+                {
+                    continue;
+                }
+
+                writer.WriteU16(static_cast<uint16_t>(entry.ID.size()));
+                writer.WriteBytes(entry.ID.data(), entry.ID.size());
+                writer.WriteU16(entry.inertialData.curHeading);
+                writer.WriteF64(entry.inertialData.curSpeed);
+                writer.WriteF64(entry.inertialData.xCoord);
+                writer.WriteF64(entry.inertialData.yCoord);
+                writer.WriteU16(entry.desiredHeading);
+                writer.WriteU8(entry.status ? 1 : 0);
+                writer.WriteU8(entry.inSpatialIndex ? 1 : 0);
+
+                if(entry.type == CHECKPOINT_ENTRY_TYPE::FIGHTER)
+                {
+                    writer.WriteF64(entry.performanceValues.maxSpeed);
+                    writer.WriteU16(entry.performanceValues.turnRate);
+                    writer.WriteF64(entry.performanceValues.radarRange);
+                    writer.WriteU16(entry.performanceValues.radarHalfAngle);
+                    writer.WriteU32(entry.performanceValues.numMissiles);
+                    writer.WriteU32(entry.lockedTarget.index);
+                    writer.WriteU32(entry.lockedTarget.generation);
+                    writer.WriteU32(entry.missilesRemaining);
+                }
+                else
+                {
+                    writer.WriteU32(entry.target.index);
+                    writer.WriteU32(entry.target.generation);
+                    writer.WriteU32(entry.fuelTicks);
+                }
+            }
+
+            WriteEntryIndices(writer, checkpoint.freeEntries);
+            WriteEntryIndices(writer, checkpoint.storeOrder);
+            WriteEntryIndices(writer, checkpoint.missileEntries);
+
+            writer.WriteU16(static_cast<uint16_t>(checkpoint.teamContacts.size()));
+            for(const auto& contacts : checkpoint.teamContacts)
+            {
+                writer.WriteU32(static_cast<uint32_t>(contacts.size()));
+                for(const auto& contact : contacts)
+                {
+                    writer.WriteU32(contact.index);
+                    writer.WriteU8(contact.identified ? 1 : 0);
+                }
+            }
+
+            EndRecord(writer.GetSize());
+        }
+
+        bool ReplayRecorder::Flush()
+        {
+            if(m_FileDescriptor < 0 || m_Failed)
+            {
+                return !m_Failed;
+            }
+
+            size_t written = 0;
+            while(written < m_BufferSize)
+            {
+                const ssize_t result = write(m_FileDescriptor, m_Buffer.data() + written, m_BufferSize - written);
+                if(result < 0)
+                {
+                    if(errno == EINTR)
+                    {
+                        continue;
+                    }
+                    m_Failed = true;
+                    return false;
+                }
+                written += static_cast<size_t>(result);
+            }
+            m_BufferSize = 0;
+
+            return true;
+        }
+
+        bool ReplayRecorder::Close()
+        {
+            if(m_FileDescriptor < 0)
+            {
+                return !m_Failed;
+            }
+
+            const bool flushed = Flush();
+            const bool closed = close(m_FileDescriptor) == 0;
+            m_FileDescriptor = -1;
+
+            return flushed && closed;
+        }
+
+        uint64_t ReplayRecorder::GetNumTicks() const
+        {
+            return m_NumTicks;
+        }
+
+        uint64_t ReplayRecorder::GetNumBytes() const
+        {
+            return m_NumBytes;
+        }
+
+        uint8_t* ReplayRecorder::BeginRecord(const REPLAY_RECORD_TYPE type, const size_t payloadSize)
+        {
+            if(m_FileDescriptor < 0 || m_Failed || payloadSize > UINT32_MAX)
+            {
+                return nullptr;
+            }
+
+            const size_t recordSize = REPLAY_RECORD_HEADER_SIZE + payloadSize;
+            if(m_BufferSize + recordSize > m_Buffer.size())
+            {
+                if(!Flush())
+                {
+                    return nullptr;
+                }
+                // only a record bigger than the whole buffer, such as the keyframe of a very large match, grows it
+                if(recordSize > m_Buffer.size())
+                {
+                    m_Buffer.resize(recordSize);
+                }
+            }
+
+            m_RecordStart = m_BufferSize;
+            m_Buffer[m_RecordStart] = static_cast<uint8_t>(type);
+
+            return m_Buffer.data() + m_RecordStart + REPLAY_RECORD_HEADER_SIZE;
+        }
+
+        void ReplayRecorder::EndRecord(const size_t payloadSize)
+        {
+            vector::util::BinaryWriter writer(m_Buffer.data() + m_RecordStart + 1, sizeof(uint32_t));
+            writer.WriteU32(static_cast<uint32_t>(payloadSize));
+
+            m_BufferSize = m_RecordStart + REPLAY_RECORD_HEADER_SIZE + payloadSize;
+            m_NumBytes += REPLAY_RECORD_HEADER_SIZE + payloadSize;
+        }
+    } // namespace sim
+} // namespace vector
@@ -0,0 +1,199 @@
+#include "sim/SpatialGrid.h"
+#include "sim/SimConstants.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace vector
+{
+    namespace sim
+    {
+        SpatialGrid::SpatialGrid(const coord cellSize)
+            : m_CellSize(cellSize > 0.0 ? cellSize : X_COORD_MAX - X_COORD_MIN)
+        {
+            m_NumColumns = std::max<size_t>(1, static_cast<size_t>(std::ceil((X_COORD_MAX - X_COORD_MIN) / m_CellSize)));
+            m_NumRows = std::max<size_t>(1, static_cast<size_t>(std::ceil((Y_COORD_MAX - Y_COORD_MIN) / m_CellSize)));
+            m_Cells.resize(m_NumColumns * m_NumRows);
+        }
+
+        void SpatialGrid::Update(const uint32_t ID, const coord xCoord, const coord yCoord)
+        {
+            const uint32_t cell = static_cast<uint32_t>(GetCellRow(yCoord) * m_NumColumns + GetCellColumn(xCoord));
+
+            if(ID >= m_Locations.size())
+            {
+                m_Locations.resize(ID + 1, ItemLocation{NOT_INDEXED, 0});
+            }
+
+            ItemLocation& location = m_Locations[ID];
+            if(location.cell == cell)
+            {
+                CellItem& item = m_Cells[cell][location.indexInCell];
+                item.xCoord = xCoord;
+                item.yCoord = yCoord;
+                return;
+            }
+
+            if(location.cell == NOT_INDEXED)
+            {
+                ++m_Size;
+            }
+            else
+            {
+                EraseFromCell(location.cell, location.indexInCell);
+            }
+
+            location.cell = cell;
+            location.indexInCell = static_cast<uint32_t>(m_Cells[cell].size());
+            m_Cells[cell].push_back(CellItem{ID, xCoord, yCoord});
+        }
+
+        bool SpatialGrid::Remove(const uint32_t ID)
+        {
+            if(!Contains(ID))
+            {
+                return false;
+            }
+
+            ItemLocation& location = m_Locations[ID];
+            EraseFromCell(location.cell, location.indexInCell);
+            location.cell = NOT_INDEXED;
+            --m_Size;
+
+            return true;
+        }
+
+        void SpatialGrid::Clear()
+        {
+            for(auto& cell : m_Cells)
+            {
+                cell.clear();
+            }
+            m_Locations.clear();
+            m_Size = 0;
+        }
+
+        bool SpatialGrid::Contains(const uint32_t ID) const
+        {
+            return ID < m_Locations.size() && m_Locations[ID].cell != NOT_INDEXED;
+        }
+
+        size_t SpatialGrid::GetSize() const
+        {
+            return m_Size;
+        }
+
+        void SpatialGrid::QueryRadius(const coord xCoord, const coord yCoord, const coord radius, std::vector<uint32_t>& results) const
+        {
+            VisitRadius(xCoord, yCoord, radius, [&results](const uint32_t ID, const coord, const coord)
+            {
+                results.push_back(ID);
+            });
+        }
+
+        void SpatialGrid::QueryNearest(const coord xCoord, const coord yCoord, const size_t count, std::vector<uint32_t>& results) const
+        {
+            if(count == 0 || m_Size == 0)
+            {
+                return;
+            }
+
+            const long centreColumn = static_cast<long>(GetCellColumn(xCoord));
+            const long centreRow = static_cast<long>(GetCellRow(yCoord));
+            const long maxRing = static_cast<long>(std::max(m_NumColumns, m_NumRows));
+            const size_t wanted = std::min(count, m_Size);
+
+            // (distance squared, ID) of every item seen so far
+            std::vector<std::pair<coord, uint32_t>> candidates;
+
+            auto addCell = [&](const long column, const long row)
+            {
+                if(column < 0 || row < 0 || column >= static_cast<long>(m_NumColumns) || row >= static_cast<long>(m_NumRows))
+                {
+                    return;
+                }
+
+                for(const CellItem& item : m_Cells[row * m_NumColumns + column])
+                {
+                    const coord xDelta = item.xCoord - xCoord;
+                    const coord yDelta = item.yCoord - yCoord;
+                    candidates.emplace_back(xDelta * xDelta + yDelta * yDelta, item.ID);
+                }
+            };
+
+            // search square rings of cells outwards from the point's cell
+            for(long ring = 0; ring <= maxRing; ++ring)
+            {
+                if(ring == 0)
+                {
+                    addCell(centreColumn, centreRow);
+                }
+                else
+                {
+                    for(long offset = -ring; offset <= ring; ++offset)
+                    {
+                        addCell(centreColumn + offset, centreRow - ring);
+                        addCell(centreColumn + offset, centreRow + ring);
+                    }
+                    for(long offset = -ring + 1; offset <= ring - 1; ++offset)
+                    {
+                        addCell(centreColumn - ring, centreRow + offset);
+                        addCell(centreColumn + ring, centreRow + offset);
+                    }
+                }
+
+                if(candidates.size() < wanted)
+                {
+                    continue;
+                }
+
+                // anything in a cell beyond this ring is at least ring cells away
+                std::nth_element(candidates.begin(), candidates.begin() + (wanted - 1), candidates.end());
+                const coord searchedDistance = static_cast<coord>(ring) * m_CellSize;
+                if(candidates[wanted - 1].first <= searchedDistance * searchedDistance)
+                {
+                    break;
+                }
+            }
+
+            std::partial_sort(candidates.begin(), candidates.begin() + wanted, candidates.end());
+            for(size_t i = 0; i < wanted; ++i)
+            {
+                results.push_back(candidates[i].second);
+            }
+        }
+
+        size_t SpatialGrid::GetCellColumn(const coord xCoord) const
+        {
+            const coord column = std::floor((xCoord - X_COORD_MIN) / m_CellSize);
+            if(!(column > 0.0))
+            {
+                return 0;
+            }
+            return std::min(static_cast<size_t>(column), m_NumColumns - 1);
+        }
+
+        size_t SpatialGrid::GetCellRow(const coord yCoord) const
+        {
+            const coord row = std::floor((yCoord - Y_COORD_MIN) / m_CellSize);
+            if(!(row > 0.0))
+            {
+                return 0;
+            }
+            return std::min(static_cast<size_t>(row), m_NumRows - 1);
+        }
+
+        void SpatialGrid::EraseFromCell(const uint32_t cell, const uint32_t indexInCell)
+        {
+            std::vector<CellItem>& items = m_Cells[cell];
+
+            if(indexInCell + 1 != items.size())
+            {
+                items[indexInCell] = items.back();
+                m_Locations[items[indexInCell].ID].indexInCell = indexInCell;
+            }
+            items.pop_back();
+        }
+    } // namespace sim
+} // namespace vector
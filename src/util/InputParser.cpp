@@ -1,76 +1,127 @@
 #include "util/InputParser.h"
+#include "sim/SimConstants.h"
 
-#include <unordered_map>
+#include <charconv>
 
 namespace vector
 {
     namespace util
     {
-        const std::string COMMAND_STR_UNK = "unk";
-        const std::string COMMAND_STR_VECTOR = "vector";
-        const std::string COMMAND_STR_IDENTIFY = "identify";
-        const std::string COMMAND_STR_AQUIRE = "aquire";
-        const std::string COMMAND_STR_LAUNCH = "launch";
+        constexpr std::string_view COMMAND_STR_VECTOR = "vector";
+        constexpr std::string_view COMMAND_STR_IDENTIFY = "identify";
+        constexpr std::string_view COMMAND_STR_AQUIRE = "aquire";
+        constexpr std::string_view COMMAND_STR_LAUNCH = "launch";
 
-        const std::string VALID_COMMAND_CHARS = "qwertyuiopasdfghjklzxcvbnm1234567890";
-
-        const std::unordered_map<std::string, COMMAND_TYPE> m_StringToCmdTypeMap = 
-        {
-            {COMMAND_STR_UNK, COMMAND_TYPE::UNK},
-            {COMMAND_STR_VECTOR, COMMAND_TYPE::VECTOR},
-            {COMMAND_STR_IDENTIFY, COMMAND_TYPE::IDENTIFY},
-            {COMMAND_STR_AQUIRE, COMMAND_TYPE::AQUIRE},
-            {COMMAND_STR_LAUNCH, COMMAND_TYPE::LAUNCH}
-        };
+        constexpr std::string_view VALID_COMMAND_CHARS = "qwertyuiopasdfghjklzxcvbnm1234567890";
 
         Command InputParser::Parse(const std::string& input)
         {
+            ParsedCommand parsed = ParseView(input);
+
             Command result;
-            std::string token;
-            size_t start = 0;
-            size_t end = 0;
-
-            std::string trimmedStr = TrimWhitespace(input);
-            end = trimmedStr.find(" ", start);
-            
-            token = trimmedStr.substr(start, end);
-            auto mapItr = m_StringToCmdTypeMap.find(token);
-
-            COMMAND_TYPE cmdType{COMMAND_TYPE::UNK};
-            if(mapItr != m_StringToCmdTypeMap.end())
+            result.command = parsed.command;
+            result.subject = std::string(parsed.subject);
+
+            // the object is checked against the command type here, once, so nothing downstream parses it again
+            switch(parsed.command)
             {
-                cmdType = mapItr->second; 
+                case COMMAND_TYPE::VECTOR:
+                    if(parsed.hasNumber && parsed.number >= vector::sim::HEADING_MIN && parsed.number <= vector::sim::HEADING_MAX)
+                    {
+                        result.payload = HeadingPayload{static_cast<uint16_t>(parsed.number)};
+                    }
+                    break;
+                case COMMAND_TYPE::IDENTIFY:
+                case COMMAND_TYPE::AQUIRE:
+                case COMMAND_TYPE::LAUNCH:
+                    if(!parsed.object.empty())
+                    {
+                        result.payload = TargetPayload{std::string(parsed.object)};
+                    }
+                    break;
+                case COMMAND_TYPE::UNK:
+                default:
+                    break;
             }
 
-            result.command = cmdType;
+            return result;
+        }
+
+        ParsedCommand InputParser::ParseView(std::string_view input)
+        {
+            ParsedCommand result;
+            std::string_view remaining = TrimWhitespace(input);
 
-            if(end != std::string::npos)
-            {
-                start = end + 1;
-                end = trimmedStr.find(" ", start);
-                result.subject = trimmedStr.substr(start, end - start);
-            }
+            result.command = ToCommandType(NextToken(remaining));
+            result.subject = NextToken(remaining);
+            result.object = NextToken(remaining);
 
-            if(end != std::string::npos)
+            if(!result.object.empty())
             {
-                start = end + 1;
-                end = trimmedStr.find(" ", start);
-                result.object = trimmedStr.substr(start, end - start);
+                const char* objectEnd = result.object.data() + result.object.size();
+                auto [parseEnd, error] = std::from_chars(result.object.data(), objectEnd, result.number);
+                result.hasNumber = (error == std::errc() && parseEnd == objectEnd);
+                if(!result.hasNumber)
+                {
+                    result.number = 0;
+                }
             }
 
             return result;
         }
 
-        std::string InputParser::TrimWhitespace(const std::string& input)
+        std::string_view InputParser::TrimWhitespace(std::string_view input)
         {
-            auto start = input.find_first_not_of(" ");
+            auto start = input.find_first_not_of(' ');
             auto end = input.find_last_of(VALID_COMMAND_CHARS);
-            
-            if(start != std::string::npos)
+
+            if(start == std::string_view::npos || end == std::string_view::npos || end < start)
+            {
+                return std::string_view();
+            }
+            return input.substr(start, (end - start) + 1);
+        }
+
+        std::string_view InputParser::NextToken(std::string_view& input)
+        {
+            auto start = input.find_first_not_of(' ');
+            if(start == std::string_view::npos)
+            {
+                input = std::string_view();
+                return std::string_view();
+            }
+
+            auto end = input.find(' ', start);
+            std::string_view token = input.substr(start, end - start);
+            input = (end == std::string_view::npos) ? std::string_view() : input.substr(end);
+
+            return token;
+        }
+
+        COMMAND_TYPE InputParser::ToCommandType(std::string_view verb)
+        {
+            // the verbs differ in length or first letter, so at most one comparison is needed
+            switch(verb.size())
             {
-                return input.substr(start, (end - start) + 1);
+                case COMMAND_STR_VECTOR.size():
+                    if(verb.front() == 'v')
+                    {
+                        return (verb == COMMAND_STR_VECTOR) ? COMMAND_TYPE::VECTOR : COMMAND_TYPE::UNK;
+                    }
+                    if(verb.front() == 'a')
+                    {
+                        return (verb == COMMAND_STR_AQUIRE) ? COMMAND_TYPE::AQUIRE : COMMAND_TYPE::UNK;
+                    }
+                    if(verb.front() == 'l')
+                    {
+                        return (verb == COMMAND_STR_LAUNCH) ? COMMAND_TYPE::LAUNCH : COMMAND_TYPE::UNK;
+                    }
+                    return COMMAND_TYPE::UNK;
+                case COMMAND_STR_IDENTIFY.size():
+                    return (verb == COMMAND_STR_IDENTIFY) ? COMMAND_TYPE::IDENTIFY : COMMAND_TYPE::UNK;
+                default:
+                    return COMMAND_TYPE::UNK;
             }
-            return input;
         }
     } // namespace util
-} // namespace vector
\ No newline at end of file
+} // namespace vector
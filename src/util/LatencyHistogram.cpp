@@ -0,0 +1,114 @@
+#include "util/LatencyHistogram.h"
+
+#include <algorithm>
+
+namespace vector
+{
+    namespace util
+    {
+        void LatencyHistogram::Record(const uint64_t value)
+        {
+            m_Buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+            m_Count.fetch_add(1, std::memory_order_relaxed);
+            m_Sum.fetch_add(value, std::memory_order_relaxed);
+
+            uint64_t curMin = m_Min.load(std::memory_order_relaxed);
+            while(value < curMin && !m_Min.compare_exchange_weak(curMin, value, std::memory_order_relaxed))
+            {
+            }
+
+            uint64_t curMax = m_Max.load(std::memory_order_relaxed);
+            while(value > curMax && !m_Max.compare_exchange_weak(curMax, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        uint64_t LatencyHistogram::GetPercentile(const double percentile) const
+        {
+            const uint64_t count = GetCount();
+            if(count == 0)
+            {
+                return 0;
+            }
+
+            // the rank of the value at the percentile, counting from 1
+            const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+            const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(clamped / 100.0 * count + 0.5));
+
+            uint64_t seen = 0;
+            for(size_t i = 0; i < NUM_BUCKETS; ++i)
+            {
+                seen += m_Buckets[i].load(std::memory_order_relaxed);
+                if(seen >= rank)
+                {
+                    // never report beyond the largest value actually recorded
+                    return std::min(GetBucketUpperBound(i), GetMax());
+                }
+            }
+
+            return GetMax();
+        }
+
+        uint64_t LatencyHistogram::GetCount() const
+        {
+            return m_Count.load(std::memory_order_relaxed);
+        }
+
+        uint64_t LatencyHistogram::GetMin() const
+        {
+            return GetCount() == 0 ? 0 : m_Min.load(std::memory_order_relaxed);
+        }
+
+        uint64_t LatencyHistogram::GetMax() const
+        {
+            return m_Max.load(std::memory_order_relaxed);
+        }
+
+        double LatencyHistogram::GetMean() const
+        {
+            const uint64_t count = GetCount();
+            return count == 0 ? 0.0 : static_cast<double>(m_Sum.load(std::memory_order_relaxed)) / count;
+        }
+
+        void LatencyHistogram::Reset()
+        {
+            for(auto& bucket : m_Buckets)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            m_Count.store(0, std::memory_order_relaxed);
+            m_Sum.store(0, std::memory_order_relaxed);
+            m_Min.store(UINT64_MAX, std::memory_order_relaxed);
+            m_Max.store(0, std::memory_order_relaxed);
+        }
+
+        size_t LatencyHistogram::GetBucketIndex(const uint64_t value)
+        {
+            const uint64_t clamped = std::min<uint64_t>(value, (uint64_t(1) << MAX_VALUE_BITS) - 1);
+
+            if(clamped < 2 * SUB_BUCKET_COUNT)
+            {
+                return static_cast<size_t>(clamped);
+            }
+
+            // the top SUB_BUCKET_BITS + 1 bits of the value select the bucket within its power of two
+            const size_t msb = 63 - __builtin_clzll(clamped);
+            const size_t shift = msb - SUB_BUCKET_BITS;
+
+            return shift * SUB_BUCKET_COUNT + static_cast<size_t>(clamped >> shift);
+        }
+
+        uint64_t LatencyHistogram::GetBucketUpperBound(const size_t index)
+        {
+            if(index < 2 * SUB_BUCKET_COUNT)
+            {
+                return index;
+            }
+
+            const size_t shift = index / SUB_BUCKET_COUNT - 1;
+            const uint64_t subBucket = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+
+            return ((subBucket + 1) << shift) - 1;
+        }
+    } // namespace util
+} // namespace vector
@@ -0,0 +1,76 @@
+#include "util/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace vector
+{
+    namespace util
+    {
+        MappedFile::~MappedFile()
+        {
+            Close();
+        }
+
+        bool MappedFile::Open(const std::string& path)
+        {
+            Close();
+
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if(fd < 0)
+            {
+                return false;
+            }
+
+            struct stat fileStat;
+            if(::fstat(fd, &fileStat) != 0)
+            {
+                ::close(fd);
+                return false;
+            }
+
+            // an empty file cannot be mapped, but is still a file
+            const size_t size = static_cast<size_t>(fileStat.st_size);
+            if(size > 0)
+            {
+                void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(data == MAP_FAILED)
+                {
+                    ::close(fd);
+                    return false;
+                }
+                // read front to back
+                ::madvise(data, size, MADV_SEQUENTIAL);
+                m_Data = static_cast<const uint8_t*>(data);
+            }
+            m_Size = size;
+
+            // the mapping holds its own reference to the file
+            ::close(fd);
+
+            return true;
+        }
+
+        void MappedFile::Close()
+        {
+            if(m_Data != nullptr)
+            {
+                ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+            }
+            m_Data = nullptr;
+            m_Size = 0;
+        }
+
+        const uint8_t* MappedFile::GetData() const
+        {
+            return m_Data;
+        }
+
+        size_t MappedFile::GetSize() const
+        {
+            return m_Size;
+        }
+    } // namespace util
+} // namespace vector
@@ -1,7 +1,10 @@
 #include "util/MathUtil.h"
 #include "sim/SimConstants.h"
 
-#include <math.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stddef.h>
 
 namespace vector
 {
@@ -10,14 +13,141 @@ namespace vector
         constexpr auto PI = 3.14159265358979323846;
         constexpr auto PI_RADIANS = vector::sim::HEADING_HALF_CIRCLE / PI;
 
+        constexpr int TAYLOR_TERMS = 12;
+        constexpr int QUARTER_CIRCLE = vector::sim::HEADING_FULL_CIRCLE / 4;
+        constexpr int EIGHTH_CIRCLE = vector::sim::HEADING_FULL_CIRCLE / 8;
+
+        // Taylor series, only used on [0, pi/4] where 12 terms are exact to well under an ulp
+        constexpr double TaylorSine(const double radians)
+        {
+            double term = radians;
+            double sum = radians;
+            for(int n = 1; n < TAYLOR_TERMS; ++n)
+            {
+                term *= -(radians * radians) / ((2.0 * n) * (2.0 * n + 1.0));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double TaylorCosine(const double radians)
+        {
+            double term = 1.0;
+            double sum = 1.0;
+            for(int n = 1; n < TAYLOR_TERMS; ++n)
+            {
+                term *= -(radians * radians) / ((2.0 * n - 1.0) * (2.0 * n));
+                sum += term;
+            }
+            return sum;
+        }
+
+        // Sine of a whole number of degrees, reduced exactly in integer degrees before going to radians
+        constexpr double DegreesSine(const int degrees)
+        {
+            const int wrapped = degrees % vector::sim::HEADING_FULL_CIRCLE;
+            const int quadrant = wrapped / QUARTER_CIRCLE;
+            const int remainder = wrapped % QUARTER_CIRCLE;
+
+            // sine of the remainder within its quadrant, folded onto [0, 45] degrees
+            const double firstQuadrantSine = remainder <= EIGHTH_CIRCLE ? TaylorSine(remainder / PI_RADIANS)
+                                                                        : TaylorCosine((QUARTER_CIRCLE - remainder) / PI_RADIANS);
+            const double firstQuadrantCosine = remainder <= EIGHTH_CIRCLE ? TaylorCosine(remainder / PI_RADIANS)
+                                                                          : TaylorSine((QUARTER_CIRCLE - remainder) / PI_RADIANS);
+
+            switch(quadrant)
+            {
+                case 0:
+                    return firstQuadrantSine;
+                case 1:
+                    return firstQuadrantCosine;
+                case 2:
+                    return -firstQuadrantSine;
+                default:
+                    return -firstQuadrantCosine;
+            }
+        }
+
+        constexpr std::array<double, vector::sim::HEADING_FULL_CIRCLE> GenerateSineTable()
+        {
+            std::array<double, vector::sim::HEADING_FULL_CIRCLE> table{};
+            for(int degrees = 0; degrees < vector::sim::HEADING_FULL_CIRCLE; ++degrees)
+            {
+                table[degrees] = DegreesSine(degrees);
+            }
+            return table;
+        }
+
+        constexpr std::array<double, vector::sim::HEADING_FULL_CIRCLE> GenerateCosineTable()
+        {
+            std::array<double, vector::sim::HEADING_FULL_CIRCLE> table{};
+            for(int degrees = 0; degrees < vector::sim::HEADING_FULL_CIRCLE; ++degrees)
+            {
+                table[degrees] = DegreesSine(degrees + QUARTER_CIRCLE);
+            }
+            return table;
+        }
+
+        // headings are whole degrees, so every heading's trig is generated once at compile time
+        constexpr std::array<double, vector::sim::HEADING_FULL_CIRCLE> HEADING_SINE_TABLE = GenerateSineTable();
+        constexpr std::array<double, vector::sim::HEADING_FULL_CIRCLE> HEADING_COSINE_TABLE = GenerateCosineTable();
+
         vector::sim::coord MathUtil::GetXComponentOfSpeed(const vector::sim::speed speedIn, const vector::sim::angle angleIn)
         {
-            return (speedIn * sin(angleIn / (PI_RADIANS)));
+            return (speedIn * GetHeadingSine(angleIn));
         }
 
         vector::sim::coord MathUtil::GetYComponentOfSpeed(const vector::sim::speed speedIn, const vector::sim::angle angleIn)
         {
-            return (speedIn * cos(angleIn / (PI_RADIANS)));
+            return (speedIn * GetHeadingCosine(angleIn));
+        }
+
+        VelocityComponents MathUtil::GetVelocityComponents(const vector::sim::speed speedIn, const vector::sim::angle angleIn)
+        {
+            const size_t index = angleIn % vector::sim::HEADING_FULL_CIRCLE;
+
+            VelocityComponents components;
+            components.xComponent = speedIn * HEADING_SINE_TABLE[index];
+            components.yComponent = speedIn * HEADING_COSINE_TABLE[index];
+
+            return components;
+        }
+
+        double MathUtil::GetHeadingSine(const vector::sim::angle angleIn)
+        {
+            return HEADING_SINE_TABLE[angleIn % vector::sim::HEADING_FULL_CIRCLE];
+        }
+
+        double MathUtil::GetHeadingCosine(const vector::sim::angle angleIn)
+        {
+            return HEADING_COSINE_TABLE[angleIn % vector::sim::HEADING_FULL_CIRCLE];
+        }
+
+        vector::sim::angle MathUtil::GetBearing(const vector::sim::coord xDelta, const vector::sim::coord yDelta)
+        {
+            // headings are measured clockwise from +y, so x and y swap places relative to atan2's usual use
+            const long degrees = std::lround(std::atan2(xDelta, yDelta) * PI_RADIANS);
+            return static_cast<vector::sim::angle>((degrees + vector::sim::HEADING_FULL_CIRCLE) % vector::sim::HEADING_FULL_CIRCLE);
+        }
+
+        vector::sim::coord MathUtil::GetClosestApproachSquared(const vector::sim::coord startXDelta, const vector::sim::coord startYDelta,
+                                                                const vector::sim::coord endXDelta, const vector::sim::coord endYDelta)
+        {
+            const vector::sim::coord xMotion = endXDelta - startXDelta;
+            const vector::sim::coord yMotion = endYDelta - startYDelta;
+            const vector::sim::coord motionSquared = xMotion * xMotion + yMotion * yMotion;
+
+            // fraction of the way along the line of the closest point, clamped to the line's ends
+            double fraction = 0.0;
+            if(motionSquared > 0.0)
+            {
+                fraction = std::clamp(-(startXDelta * xMotion + startYDelta * yMotion) / motionSquared, 0.0, 1.0);
+            }
+
+            const vector::sim::coord xClosest = startXDelta + fraction * xMotion;
+            const vector::sim::coord yClosest = startYDelta + fraction * yMotion;
+
+            return xClosest * xClosest + yClosest * yClosest;
         }
     } // namespace util
-} // namespace vector
\ No newline at end of file
+} // namespace vector
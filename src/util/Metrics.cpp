@@ -0,0 +1,87 @@
+#include "util/Metrics.h"
+
+#include <sstream>
+
+namespace vector
+{
+    namespace util
+    {
+        std::atomic<uint64_t>& Metrics::AddCounter(const std::string& name)
+        {
+            m_Counters.emplace_back(name, std::make_unique<std::atomic<uint64_t>>(0));
+            return *m_Counters.back().second;
+        }
+
+        LatencyHistogram& Metrics::AddHistogram(const std::string& name)
+        {
+            m_Histograms.emplace_back(name, std::make_unique<LatencyHistogram>());
+            return *m_Histograms.back().second;
+        }
+
+        std::string Metrics::ToText(const std::string& prefix) const
+        {
+            std::stringstream out;
+
+            for(const auto& counter : m_Counters)
+            {
+                out << prefix << counter.first << " " << counter.second->load(std::memory_order_relaxed) << "\n";
+            }
+
+            for(const auto& histogram : m_Histograms)
+            {
+                const LatencyHistogram& hist = *histogram.second;
+                out << prefix << histogram.first
+                    << " count=" << hist.GetCount()
+                    << " min=" << hist.GetMin()
+                    << " mean=" << static_cast<uint64_t>(hist.GetMean())
+                    << " p50=" << hist.GetPercentile(50.0)
+                    << " p90=" << hist.GetPercentile(90.0)
+                    << " p99=" << hist.GetPercentile(99.0)
+                    << " p999=" << hist.GetPercentile(99.9)
+                    << " max=" << hist.GetMax()
+                    << " (ns)\n";
+            }
+
+            return out.str();
+        }
+
+        std::string Metrics::ToJson() const
+        {
+            std::stringstream out;
+            bool first = true;
+
+            // metric names are code-defined identifiers, so they need no escaping
+            out << "{";
+            for(const auto& counter : m_Counters)
+            {
+                out << (first ? "" : ",") << "\"" << counter.first << "\":" << counter.second->load(std::memory_order_relaxed);
+                first = false;
+            }
+
+            for(const auto& histogram : m_Histograms)
+            {
+                const LatencyHistogram& hist = *histogram.second;
+                out << (first ? "" : ",") << "\"" << histogram.first << "\":{"
+                    << "\"count\":" << hist.GetCount()
+                    << ",\"min_ns\":" << hist.GetMin()
+                    << ",\"mean_ns\":" << static_cast<uint64_t>(hist.GetMean())
+                    << ",\"p50_ns\":" << hist.GetPercentile(50.0)
+                    << ",\"p90_ns\":" << hist.GetPercentile(90.0)
+                    << ",\"p99_ns\":" << hist.GetPercentile(99.0)
+                    << ",\"p999_ns\":" << hist.GetPercentile(99.9)
+                    << ",\"max_ns\":" << hist.GetMax()
+                    << "}";
+                first = false;
+            }
+            out << "}";
+
+            return out.str();
+        }
+
+        uint64_t Metrics::NanosSince(const std::chrono::steady_clock::time_point start)
+        {
+            return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        }
+    } // namespace util
+} // namespace vector
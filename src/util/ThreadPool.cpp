@@ -0,0 +1,111 @@
+#include "util/ThreadPool.h"
+
+namespace vector
+{
+    namespace util
+    {
+        ThreadPool::ThreadPool(const size_t numThreads)
+        {
+            for(size_t i = 1; i < numThreads; ++i)
+            {
+                m_Workers.emplace_back(&ThreadPool::Run, this);
+            }
+        }
+
+        ThreadPool::~ThreadPool()
+        {
+            {
+                std::scoped_lock<std::mutex> lock(m_JobMutex);
+                m_Stopping = true;
+            }
+            m_JobStartCondition.notify_all();
+
+            for(auto& worker : m_Workers)
+            {
+                worker.join();
+            }
+        }
+
+        size_t ThreadPool::GetNumThreads() const
+        {
+            return m_Workers.size() + 1;
+        }
+
+        void ThreadPool::ParallelFor(const size_t numTasks, const std::function<void(const size_t taskIndex)>& task)
+        {
+            if(numTasks == 0)
+            {
+                return;
+            }
+
+            // no point waking workers for a single task
+            if(m_Workers.empty() || numTasks == 1)
+            {
+                for(size_t i = 0; i < numTasks; ++i)
+                {
+                    task(i);
+                }
+                return;
+            }
+
+            {
+                std::scoped_lock<std::mutex> lock(m_JobMutex);
+                m_JobTask = &task;
+                m_JobNumTasks = numTasks;
+                m_NextTask.store(0, std::memory_order_relaxed);
+                m_WorkersBusy = m_Workers.size();
+                ++m_JobGeneration;
+            }
+            m_JobStartCondition.notify_all();
+
+            RunTasks();
+
+            std::unique_lock<std::mutex> lock(m_JobMutex);
+            m_JobDoneCondition.wait(lock, [this]{ return m_WorkersBusy == 0; });
+            m_JobTask = nullptr;
+        }
+
+        void ThreadPool::Run()
+        {
+            uint64_t lastGeneration = 0;
+
+            while(true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_JobMutex);
+                    m_JobStartCondition.wait(lock, [this, lastGeneration]{ return m_Stopping || m_JobGeneration != lastGeneration; });
+
+                    if(m_Stopping)
+                    {
+                        return;
+                    }
+
+                    lastGeneration = m_JobGeneration;
+                }
+
+                RunTasks();
+
+                bool lastWorker = false;
+                {
+                    std::scoped_lock<std::mutex> lock(m_JobMutex);
+                    lastWorker = (--m_WorkersBusy == 0);
+                }
+
+                if(lastWorker)
+                {
+                    m_JobDoneCondition.notify_one();
+                }
+            }
+        }
+
+        void ThreadPool::RunTasks()
+        {
+            size_t taskIndex = m_NextTask.fetch_add(1, std::memory_order_relaxed);
+            while(taskIndex < m_JobNumTasks)
+            {
+                (*m_JobTask)(taskIndex);
+                taskIndex = m_NextTask.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    } // namespace util
+} // namespace vector
@@ -0,0 +1,99 @@
+#include "util/TickScheduler.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace vector
+{
+    namespace util
+    {
+        TickScheduler::TickScheduler(const uint32_t tickRateHz, const size_t maxCatchUpTicks)
+            : m_MaxCatchUpTicks(std::max<size_t>(maxCatchUpTicks, 1))
+        {
+            SetTickRateHz(tickRateHz);
+        }
+
+        void TickScheduler::SetTickRateHz(const uint32_t tickRateHz)
+        {
+            m_TickRateHz = std::max<uint32_t>(tickRateHz, 1);
+            m_TickPeriod = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) / m_TickRateHz;
+        }
+
+        uint32_t TickScheduler::GetTickRateHz() const
+        {
+            return m_TickRateHz;
+        }
+
+        void TickScheduler::Start()
+        {
+            m_NextDeadline = std::chrono::steady_clock::now();
+        }
+
+        size_t TickScheduler::WaitForNextTick()
+        {
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+            if(now < m_NextDeadline)
+            {
+                std::this_thread::sleep_until(m_NextDeadline);
+                now = m_NextDeadline;
+            }
+
+            return TakeDueTicks(now);
+        }
+
+        size_t TickScheduler::TakeDueTicks()
+        {
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if(now < m_NextDeadline)
+            {
+                return 0;
+            }
+
+            return TakeDueTicks(now);
+        }
+
+        std::chrono::steady_clock::time_point TickScheduler::GetNextDeadline() const
+        {
+            return m_NextDeadline;
+        }
+
+        size_t TickScheduler::TakeDueTicks(const std::chrono::steady_clock::time_point now)
+        {
+            // every deadline at or before now is due
+            uint64_t dueTicks = 1 + static_cast<uint64_t>((now - m_NextDeadline) / m_TickPeriod);
+            if(dueTicks > 1)
+            {
+                ++m_NumOverruns;
+            }
+
+            // deadlines stay on the grid, so lateness in one wait is not carried into the next
+            m_NextDeadline += m_TickPeriod * dueTicks;
+
+            if(dueTicks > m_MaxCatchUpTicks)
+            {
+                m_NumSkippedTicks += dueTicks - m_MaxCatchUpTicks;
+                dueTicks = m_MaxCatchUpTicks;
+            }
+
+            m_NumTicks += dueTicks;
+
+            return static_cast<size_t>(dueTicks);
+        }
+
+        uint64_t TickScheduler::GetNumTicks() const
+        {
+            return m_NumTicks;
+        }
+
+        uint64_t TickScheduler::GetNumOverruns() const
+        {
+            return m_NumOverruns;
+        }
+
+        uint64_t TickScheduler::GetNumSkippedTicks() const
+        {
+            return m_NumSkippedTicks;
+        }
+    } // namespace util
+} // namespace vector
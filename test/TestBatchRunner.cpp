@@ -0,0 +1,147 @@
+#include "gtest/gtest.h"
+
+#include "game/BatchRunner.h"
+#include "game/BatchSummary.h"
+#include "game/GameTypes.h"
+#include "game/HeadlessMatch.h"
+#include "game/MatchResult.h"
+#include "game/ScriptedCommand.h"
+#include "sim/SimConstants.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const size_t NUM_MATCHES = 16;
+    const uint64_t FIRST_SEED = 7;
+    const uint64_t MAX_TICKS = 1000;
+
+    vector::game::ScriptedCommand MakeScriptedCommand(const uint64_t tick, const vector::sim::team_ID teamID,
+                                                        const vector::util::COMMAND_TYPE command, const std::string& subject,
+                                                        const std::string& target)
+    {
+        vector::game::ScriptedCommand scriptedCommand;
+        scriptedCommand.tick = tick;
+        scriptedCommand.teamID = teamID;
+        scriptedCommand.cmd.command = command;
+        scriptedCommand.cmd.subject = subject;
+        scriptedCommand.cmd.payload = vector::util::TargetPayload{target};
+        return scriptedCommand;
+    }
+
+    // one fighter a side, and the seed picks which of them locks and fires first, and when, once in radar range
+    void Duel(vector::game::HeadlessMatch& match, const uint64_t seed)
+    {
+        match.SetUnitData(1, {vector::game::UnitData{"brot", vector::game::UNIT_TYPE::FIGHTER}});
+        match.SetUnitData(2, {vector::game::UnitData{"marm", vector::game::UNIT_TYPE::FIGHTER}});
+
+        std::mt19937_64 rng(seed);
+        const bool brotFires = std::uniform_int_distribution<int>(0, 1)(rng) == 0;
+        const uint64_t tick = std::uniform_int_distribution<uint64_t>(100, 120)(rng);
+        const vector::sim::team_ID teamID = brotFires ? 1 : 2;
+        const std::string subject = brotFires ? "brot" : "marm";
+        const std::string target = brotFires ? "marm" : "brot";
+        match.AddScriptedCommand(MakeScriptedCommand(tick, teamID, vector::util::COMMAND_TYPE::AQUIRE, subject, target));
+        match.AddScriptedCommand(MakeScriptedCommand(tick + 1, teamID, vector::util::COMMAND_TYPE::LAUNCH, subject, target));
+    }
+
+    TEST(TestBatchRunner, TestRunBatch)
+    {
+        vector::game::BatchRunner batchRunner(3);
+        EXPECT_EQ(3, batchRunner.GetNumThreads());
+
+        const vector::game::BatchSummary summary = batchRunner.Run(Duel, FIRST_SEED, NUM_MATCHES, MAX_TICKS);
+        ASSERT_EQ(NUM_MATCHES, batchRunner.GetResults().size());
+
+        // every duel ends with the side that fired first left
+        EXPECT_EQ(NUM_MATCHES, summary.numMatches);
+        EXPECT_EQ(NUM_MATCHES, summary.numDecided);
+        EXPECT_EQ(0, summary.numNoneLeft);
+        ASSERT_EQ(3, summary.wins.size());
+        EXPECT_EQ(NUM_MATCHES, summary.wins.at(1) + summary.wins.at(2));
+        ASSERT_EQ(3, summary.meanSurvivors.size());
+        EXPECT_DOUBLE_EQ(1.0, summary.meanSurvivors.at(1) + summary.meanSurvivors.at(2));
+        EXPECT_DOUBLE_EQ(static_cast<double>(summary.wins.at(1)) / NUM_MATCHES, summary.meanSurvivors.at(1));
+
+        EXPECT_EQ(NUM_MATCHES, summary.numFirstKills);
+        EXPECT_GT(summary.minFirstKillTick, 101);
+        EXPECT_LE(summary.minFirstKillTick, summary.meanFirstKillTick);
+        EXPECT_GE(summary.maxFirstKillTick, summary.meanFirstKillTick);
+        EXPECT_EQ(0, summary.commandsUnresolved);
+        EXPECT_EQ(0, summary.commandsRejected);
+        EXPECT_LT(0, summary.ticksRun);
+        EXPECT_GT(summary.ticksPerSecond, 0.0);
+    }
+
+    TEST(TestBatchRunner, TestSeedsReproduceBatch)
+    {
+        vector::game::BatchRunner serialRunner(1);
+        vector::game::BatchRunner parallelRunner(4);
+
+        const vector::game::BatchSummary serialSummary = serialRunner.Run(Duel, FIRST_SEED, NUM_MATCHES, MAX_TICKS);
+        const vector::game::BatchSummary parallelSummary = parallelRunner.Run(Duel, FIRST_SEED, NUM_MATCHES, MAX_TICKS);
+
+        // the same seeds give the same matches whatever thread each ran on
+        ASSERT_EQ(serialRunner.GetResults().size(), parallelRunner.GetResults().size());
+        for(size_t i = 0; i < NUM_MATCHES; ++i)
+        {
+            const vector::game::MatchResult& serialResult = serialRunner.GetResults().at(i);
+            const vector::game::MatchResult& parallelResult = parallelRunner.GetResults().at(i);
+            EXPECT_EQ(serialResult.ticksRun, parallelResult.ticksRun);
+            EXPECT_EQ(serialResult.winningTeamID, parallelResult.winningTeamID);
+            EXPECT_EQ(serialResult.firstKillTick, parallelResult.firstKillTick);
+            EXPECT_EQ(serialResult.survivors, parallelResult.survivors);
+        }
+        EXPECT_EQ(serialSummary.wins, parallelSummary.wins);
+        EXPECT_EQ(serialSummary.ticksRun, parallelSummary.ticksRun);
+        EXPECT_DOUBLE_EQ(serialSummary.meanFirstKillTick, parallelSummary.meanFirstKillTick);
+
+        // a batch run again replaces the last one's results
+        serialRunner.Run(Duel, FIRST_SEED, 2, MAX_TICKS);
+        EXPECT_EQ(2, serialRunner.GetResults().size());
+    }
+
+    TEST(TestBatchRunner, TestSummarize)
+    {
+        const vector::game::BatchSummary emptySummary = vector::game::BatchRunner::Summarize({});
+        EXPECT_EQ(0, emptySummary.numMatches);
+        EXPECT_EQ(0, emptySummary.numFirstKills);
+        EXPECT_EQ(UINT64_MAX, emptySummary.minFirstKillTick);
+        EXPECT_TRUE(emptySummary.wins.empty());
+
+        vector::game::MatchResult won;
+        won.ticksRun = 200;
+        won.decided = true;
+        won.winningTeamID = 2;
+        won.survivors = {0, 0, 3};
+        won.firstKillTick = 150;
+
+        vector::game::MatchResult noneLeft;
+        noneLeft.ticksRun = 100;
+        noneLeft.decided = true;
+        noneLeft.survivors = {0, 0, 0};
+        noneLeft.firstKillTick = 90;
+
+        vector::game::MatchResult undecided;
+        undecided.ticksRun = 300;
+        undecided.survivors = {0, 2, 3};
+        undecided.commandsRejected = 4;
+
+        const vector::game::BatchSummary summary = vector::game::BatchRunner::Summarize({won, noneLeft, undecided});
+        EXPECT_EQ(3, summary.numMatches);
+        EXPECT_EQ(2, summary.numDecided);
+        EXPECT_EQ(1, summary.numNoneLeft);
+        EXPECT_EQ((std::vector<size_t>{0, 0, 1}), summary.wins);
+        EXPECT_DOUBLE_EQ(2.0 / 3.0, summary.meanSurvivors.at(1));
+        EXPECT_DOUBLE_EQ(2.0, summary.meanSurvivors.at(2));
+        EXPECT_EQ(2, summary.numFirstKills);
+        EXPECT_EQ(90, summary.minFirstKillTick);
+        EXPECT_DOUBLE_EQ(120.0, summary.meanFirstKillTick);
+        EXPECT_EQ(150, summary.maxFirstKillTick);
+        EXPECT_EQ(4, summary.commandsRejected);
+        EXPECT_EQ(600, summary.ticksRun);
+        EXPECT_EQ(0.0, summary.elapsedSeconds);
+    }
+} // namespace
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+
+#include "util/BroadcastRingBuffer.h"
+
+#include <thread>
+#include <vector>
+
+TEST(TestBroadcastRingBuffer, TestCapacity)
+{
+    EXPECT_EQ(2, vector::util::BroadcastRingBuffer<int>(0).GetCapacity());
+    EXPECT_EQ(8, vector::util::BroadcastRingBuffer<int>(8).GetCapacity());
+    EXPECT_EQ(16, vector::util::BroadcastRingBuffer<int>(9).GetCapacity());
+}
+
+TEST(TestBroadcastRingBuffer, TestEveryCursorSeesEveryItem)
+{
+    vector::util::BroadcastRingBuffer<int> buffer(8);
+    vector::util::BroadcastRingBuffer<int>::Cursor firstCursor = buffer.Subscribe();
+    int item = 0;
+
+    EXPECT_FALSE(buffer.TryRead(firstCursor, item));
+
+    buffer.Publish(1);
+    vector::util::BroadcastRingBuffer<int>::Cursor secondCursor = buffer.Subscribe();
+
+    // several laps round the buffer, the cursors reading at different paces
+    for(int i = 2; i < 40; ++i)
+    {
+        buffer.Publish(i);
+
+        ASSERT_TRUE(buffer.TryRead(secondCursor, item));
+        EXPECT_EQ(i, item);
+        EXPECT_FALSE(buffer.TryRead(secondCursor, item));
+
+        if(i % 4 == 0)
+        {
+            for(int expected = i - 3; expected <= i; ++expected)
+            {
+                ASSERT_TRUE(buffer.TryRead(firstCursor, item));
+                EXPECT_EQ(expected, item);
+            }
+            EXPECT_FALSE(buffer.TryRead(firstCursor, item));
+        }
+    }
+
+    EXPECT_EQ(39, buffer.GetNumPublished());
+    EXPECT_EQ(0, firstCursor.numMissed);
+    EXPECT_EQ(0, secondCursor.numMissed);
+}
+
+TEST(TestBroadcastRingBuffer, TestLaggingCursorSkipsAhead)
+{
+    vector::util::BroadcastRingBuffer<int> buffer(4);
+    vector::util::BroadcastRingBuffer<int>::Cursor cursor = buffer.Subscribe();
+    int item = 0;
+
+    for(int i = 0; i < 10; ++i)
+    {
+        buffer.Publish(i);
+    }
+
+    // all but one slot hold items, the oldest of the rest were overwritten
+    for(int expected = 7; expected < 10; ++expected)
+    {
+        ASSERT_TRUE(buffer.TryRead(cursor, item));
+        EXPECT_EQ(expected, item);
+    }
+    EXPECT_FALSE(buffer.TryRead(cursor, item));
+    EXPECT_EQ(7, cursor.numMissed);
+}
+
+TEST(TestBroadcastRingBuffer, TestConcurrentConsumers)
+{
+    constexpr int NUM_CONSUMERS = 4;
+    constexpr int NUM_ITEMS = 50000;
+    vector::util::BroadcastRingBuffer<int> buffer(64);
+
+    // every consumer sees items in the order published, with any it missed counted
+    std::vector<vector::util::BroadcastRingBuffer<int>::Cursor> cursors(NUM_CONSUMERS, buffer.Subscribe());
+    std::vector<std::thread> consumers;
+    for(int consumer = 0; consumer < NUM_CONSUMERS; ++consumer)
+    {
+        consumers.emplace_back([&buffer, &cursors, consumer]()
+        {
+            vector::util::BroadcastRingBuffer<int>::Cursor& cursor = cursors[consumer];
+            uint64_t numRead = 0;
+            int item = 0;
+            while(cursor.position < NUM_ITEMS)
+            {
+                if(buffer.TryRead(cursor, item))
+                {
+                    // an item is exactly the one at its sequence number, never a torn or stale one
+                    ASSERT_EQ(static_cast<int>(cursor.position) - 1, item);
+                    ++numRead;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            EXPECT_EQ(cursor.position, numRead + cursor.numMissed);
+        });
+    }
+
+    for(int i = 0; i < NUM_ITEMS; ++i)
+    {
+        buffer.Publish(i);
+    }
+
+    for(auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+}
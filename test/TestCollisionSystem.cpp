@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+
+#include "sim/CollisionSystem.h"
+#include "sim/SimConstants.h"
+#include "util/MathUtil.h"
+#include "util/ThreadPool.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    vector::sim::InertialData MakeInertialData(const vector::sim::coord xCoord, const vector::sim::coord yCoord)
+    {
+        vector::sim::InertialData inertialData;
+        inertialData.xCoord = xCoord;
+        inertialData.yCoord = yCoord;
+        return inertialData;
+    }
+
+    struct Path
+    {
+        vector::sim::InertialData startData;
+        vector::sim::InertialData endData;
+    };
+
+    void AddPaths(vector::sim::CollisionSystem& collisions, const std::vector<Path>& paths)
+    {
+        collisions.ClearBodies();
+        for(uint32_t i = 0; i < paths.size(); ++i)
+        {
+            collisions.AddBody(i, paths[i].startData, paths[i].endData);
+        }
+    }
+
+    TEST(TestCollisionSystem, TestDetect)
+    {
+        vector::sim::CollisionSystem collisions(50.0, vector::sim::COLLISION_GRID_CELL_SIZE);
+        const vector::sim::coord centre = vector::sim::X_COORD_MAX / 2;
+
+        // 0 and 1 fly head on through each other at top speed, ending the tick further apart than they started;
+        // 2 and 3 fly side by side 100 apart; 4 and 5 end the tick on the same spot
+        std::vector<Path> paths = {
+            {MakeInertialData(centre, centre), MakeInertialData(centre, centre + 838.0)},
+            {MakeInertialData(centre + 10.0, centre + 500.0), MakeInertialData(centre + 10.0, centre - 338.0)},
+            {MakeInertialData(centre + 20000.0, centre), MakeInertialData(centre + 20000.0, centre + 838.0)},
+            {MakeInertialData(centre + 20100.0, centre), MakeInertialData(centre + 20100.0, centre + 838.0)},
+            {MakeInertialData(centre - 20000.0, centre), MakeInertialData(centre - 20000.0, centre + 838.0)},
+            {MakeInertialData(centre - 19000.0, centre + 838.0), MakeInertialData(centre - 20000.0, centre + 838.0)},
+        };
+        AddPaths(collisions, paths);
+
+        std::vector<vector::sim::CollisionSystem::Collision> found;
+        collisions.Detect(nullptr, found);
+
+        ASSERT_EQ(2, found.size());
+        EXPECT_EQ(0, found.at(0).firstIndex);
+        EXPECT_EQ(1, found.at(0).secondIndex);
+        EXPECT_EQ(4, found.at(1).firstIndex);
+        EXPECT_EQ(5, found.at(1).secondIndex);
+
+        // bodies are forgotten between detections
+        collisions.ClearBodies();
+        collisions.AddBody(2, paths[2].startData, paths[2].endData);
+        found.clear();
+        collisions.Detect(nullptr, found);
+        EXPECT_TRUE(found.empty());
+    }
+
+    TEST(TestCollisionSystem, TestMatchesBruteForce)
+    {
+        constexpr int NUM_BODIES = 3000;
+        constexpr vector::sim::coord RADIUS = 200.0;
+        vector::sim::CollisionSystem collisions(RADIUS, vector::sim::COLLISION_GRID_CELL_SIZE);
+        vector::sim::CollisionSystem parallelCollisions(RADIUS, vector::sim::COLLISION_GRID_CELL_SIZE);
+        vector::util::ThreadPool pool(4);
+
+        // a crowded furball in a small box, so that there are plenty of collisions
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<vector::sim::coord> positionDistribution(100000.0, 130000.0);
+        std::uniform_int_distribution<int> headingDistribution(vector::sim::HEADING_MIN, vector::sim::HEADING_MAX);
+        std::uniform_real_distribution<vector::sim::speed> speedDistribution(0.0, 2500.0);
+
+        std::vector<Path> paths(NUM_BODIES);
+        for(auto& path : paths)
+        {
+            path.startData = MakeInertialData(positionDistribution(generator), positionDistribution(generator));
+            vector::util::VelocityComponents velocity = vector::util::MathUtil::GetVelocityComponents(speedDistribution(generator),
+                                                                                                    headingDistribution(generator));
+            path.endData = MakeInertialData(path.startData.xCoord + velocity.xComponent, path.startData.yCoord + velocity.yComponent);
+        }
+        AddPaths(collisions, paths);
+        AddPaths(parallelCollisions, paths);
+
+        std::vector<vector::sim::CollisionSystem::Collision> found;
+        collisions.Detect(nullptr, found);
+        std::vector<vector::sim::CollisionSystem::Collision> parallelFound;
+        parallelCollisions.Detect(&pool, parallelFound);
+
+        std::vector<vector::sim::CollisionSystem::Collision> expected;
+        for(uint32_t i = 0; i < NUM_BODIES; ++i)
+        {
+            for(uint32_t j = i + 1; j < NUM_BODIES; ++j)
+            {
+                if(vector::util::MathUtil::GetClosestApproachSquared(
+                        paths[j].startData.xCoord - paths[i].startData.xCoord, paths[j].startData.yCoord - paths[i].startData.yCoord,
+                        paths[j].endData.xCoord - paths[i].endData.xCoord, paths[j].endData.yCoord - paths[i].endData.yCoord) <= RADIUS * RADIUS)
+                {
+                    expected.push_back(vector::sim::CollisionSystem::Collision{i, j});
+                }
+            }
+        }
+
+        EXPECT_GT(expected.size(), 10);
+        ASSERT_EQ(expected.size(), found.size());
+        ASSERT_EQ(expected.size(), parallelFound.size());
+        for(size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(expected[i].firstIndex, found[i].firstIndex);
+            EXPECT_EQ(expected[i].secondIndex, found[i].secondIndex);
+            EXPECT_EQ(expected[i].firstIndex, parallelFound[i].firstIndex);
+            EXPECT_EQ(expected[i].secondIndex, parallelFound[i].secondIndex);
+        }
+    }
+} // namespace
@@ -0,0 +1,149 @@
+#include "gtest/gtest.h"
+#include "sim/FighterKinematics.h"
+#include "sim/InertialData.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t NUM_FIGHTERS = 1031;
+    constexpr int NUM_TICKS = 60;
+
+    /**
+     * @brief Fighters laid out as arrays, with a per-fighter reference copy advanced by FighterKinematics::Move
+     *
+     */
+    struct FighterArrays
+    {
+        std::vector<vector::sim::angle> headings;
+        std::vector<vector::sim::angle> desiredHeadings;
+        std::vector<vector::sim::speed> speeds;
+        std::vector<vector::sim::coord> xCoords;
+        std::vector<vector::sim::coord> yCoords;
+        std::vector<uint8_t> statuses;
+
+        vector::sim::FighterBatch GetBatch()
+        {
+            vector::sim::FighterBatch batch;
+            batch.headings = headings.data();
+            batch.desiredHeadings = desiredHeadings.data();
+            batch.speeds = speeds.data();
+            batch.xCoords = xCoords.data();
+            batch.yCoords = yCoords.data();
+            batch.statuses = statuses.data();
+            batch.count = headings.size();
+            return batch;
+        }
+    };
+
+    FighterArrays GenerateFighters(const unsigned int seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> headingDist(vector::sim::HEADING_MIN, vector::sim::HEADING_MAX);
+        std::uniform_real_distribution<double> speedDist(vector::sim::SPEED_MIN, vector::sim::FIGHTER_SPEED_MAX);
+        std::uniform_real_distribution<double> xDist(vector::sim::X_COORD_MIN, vector::sim::X_COORD_MAX);
+        std::uniform_real_distribution<double> yDist(vector::sim::Y_COORD_MIN, vector::sim::Y_COORD_MAX);
+        std::uniform_int_distribution<int> percentDist(0, 99);
+
+        FighterArrays fighters;
+        for(size_t i = 0; i < NUM_FIGHTERS; ++i)
+        {
+            vector::sim::angle heading = headingDist(generator);
+
+            fighters.headings.push_back(heading);
+            // roughly half of the fighters fly straight
+            fighters.desiredHeadings.push_back(percentDist(generator) < 50 ? heading : headingDist(generator));
+            fighters.speeds.push_back(speedDist(generator));
+            fighters.xCoords.push_back(xDist(generator));
+            fighters.yCoords.push_back(yDist(generator));
+            // a few fighters start destroyed and must be left untouched
+            fighters.statuses.push_back(percentDist(generator) >= 5);
+        }
+
+        // some fighters start right at the arena edges so that they leave it during the run
+        fighters.xCoords[0] = vector::sim::X_COORD_MAX;
+        fighters.headings[0] = 90;
+        fighters.desiredHeadings[0] = 90;
+        fighters.yCoords[1] = vector::sim::Y_COORD_MIN;
+        fighters.headings[1] = 180;
+        fighters.desiredHeadings[1] = 180;
+
+        return fighters;
+    }
+
+    void ExpectBitIdentical(const vector::sim::KINEMATICS_ISA isa)
+    {
+        FighterArrays batched = GenerateFighters(17);
+        FighterArrays reference = GenerateFighters(17);
+
+        for(int tick = 0; tick < NUM_TICKS; ++tick)
+        {
+            vector::sim::FighterKinematics::MoveBatch(batched.GetBatch(), isa);
+
+            for(size_t i = 0; i < NUM_FIGHTERS; ++i)
+            {
+                if(reference.statuses[i])
+                {
+                    vector::sim::InertialData inertialData;
+                    inertialData.curHeading = reference.headings[i];
+                    inertialData.curSpeed = reference.speeds[i];
+                    inertialData.xCoord = reference.xCoords[i];
+                    inertialData.yCoord = reference.yCoords[i];
+
+                    reference.statuses[i] = vector::sim::FighterKinematics::Move(inertialData, reference.desiredHeadings[i]);
+
+                    reference.headings[i] = inertialData.curHeading;
+                    reference.speeds[i] = inertialData.curSpeed;
+                    reference.xCoords[i] = inertialData.xCoord;
+                    reference.yCoords[i] = inertialData.yCoord;
+                }
+            }
+        }
+
+        // exact equality, not a tolerance: the batched kernel must reproduce Move bit for bit
+        for(size_t i = 0; i < NUM_FIGHTERS; ++i)
+        {
+            EXPECT_EQ(reference.headings[i], batched.headings[i]);
+            EXPECT_EQ(reference.speeds[i], batched.speeds[i]);
+            EXPECT_EQ(reference.xCoords[i], batched.xCoords[i]);
+            EXPECT_EQ(reference.yCoords[i], batched.yCoords[i]);
+            EXPECT_EQ(reference.statuses[i], batched.statuses[i]);
+        }
+
+        EXPECT_FALSE(batched.statuses[0]);
+        EXPECT_FALSE(batched.statuses[1]);
+    }
+
+    TEST(TestFighterKinematics, TestBatchScalarMatchesMove)
+    {
+        ExpectBitIdentical(vector::sim::KINEMATICS_ISA::SCALAR);
+    }
+
+    TEST(TestFighterKinematics, TestBatchSse2MatchesMove)
+    {
+        if(!vector::sim::FighterKinematics::IsIsaSupported(vector::sim::KINEMATICS_ISA::SSE2))
+        {
+            GTEST_SKIP() << "SSE2 not supported on this CPU";
+        }
+        ExpectBitIdentical(vector::sim::KINEMATICS_ISA::SSE2);
+    }
+
+    TEST(TestFighterKinematics, TestBatchAvx2MatchesMove)
+    {
+        if(!vector::sim::FighterKinematics::IsIsaSupported(vector::sim::KINEMATICS_ISA::AVX2))
+        {
+            GTEST_SKIP() << "AVX2 not supported on this CPU";
+        }
+        ExpectBitIdentical(vector::sim::KINEMATICS_ISA::AVX2);
+    }
+
+    TEST(TestFighterKinematics, TestBestIsaSupported)
+    {
+        // the runtime-selected instruction set is always usable, and scalar is always available
+        EXPECT_TRUE(vector::sim::FighterKinematics::IsIsaSupported(vector::sim::FighterKinematics::GetBestIsa()));
+        EXPECT_TRUE(vector::sim::FighterKinematics::IsIsaSupported(vector::sim::KINEMATICS_ISA::SCALAR));
+    }
+} // namespace
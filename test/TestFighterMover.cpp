@@ -155,6 +155,7 @@ namespace
         // 359 is the high boundary on valid heading [0 - 359]
         valid = mover.SetNewHeading(359);
         EXPECT_TRUE(valid);
+        EXPECT_EQ(359, mover.GetDesiredHeading());
     }
 
     TEST_F(TestFighterMover, TestSetHeadingInvalid)
@@ -172,6 +173,7 @@ namespace
         // 359 is the high boundary on valid heading [0 - 359]
         valid = mover.SetNewHeading(360);
         EXPECT_FALSE(valid);
+        EXPECT_EQ(0, mover.GetDesiredHeading());
 
         // Mover should accept valid headings after invalid headings
         valid = mover.SetNewHeading(1);
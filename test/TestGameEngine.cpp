@@ -3,6 +3,16 @@
 
 #include "sim/GameEngine.h"
 #include "sim/MoverInterface.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+#include "util/MathUtil.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
 
 class MockMover : public vector::sim::MoverInterface
 {
@@ -10,14 +20,63 @@ class MockMover : public vector::sim::MoverInterface
         MOCK_METHOD(std::string, GetID, (), (const, override));
         MOCK_METHOD(void, Move, (), (override));
         MOCK_METHOD(bool, SetNewHeading, (const vector::sim::angle), (override));
+        MOCK_METHOD(vector::sim::angle, GetDesiredHeading, (), (const, override));
         MOCK_METHOD(bool, SetInitialInertialData, (const vector::sim::InertialData), (override));
         MOCK_METHOD(vector::sim::InertialData, GetInertialData, (), (const, override));
         MOCK_METHOD(void, Destroy, (), (override));
         MOCK_METHOD(bool, GetStatus, (), (const, override));
         MOCK_METHOD(uint8_t, GetTeam, (), (const, override));
+        MOCK_METHOD(vector::sim::MoverParams, GetPerformanceValues, (), (const, override));
         MOCK_METHOD(std::string, ToString, (), (const, override));
 };
 
+static void ExpectSameCheckpoint(const vector::sim::EngineCheckpoint& expected, const vector::sim::EngineCheckpoint& actual)
+{
+    EXPECT_EQ(expected.ticks, actual.ticks);
+    EXPECT_EQ(expected.numMissilesLaunched, actual.numMissilesLaunched);
+    EXPECT_EQ(expected.freeEntries, actual.freeEntries);
+    EXPECT_EQ(expected.storeOrder, actual.storeOrder);
+    EXPECT_EQ(expected.missileEntries, actual.missileEntries);
+
+    ASSERT_EQ(expected.entries.size(), actual.entries.size());
+    for(size_t i = 0; i < expected.entries.size(); ++i)
+    {
+        const vector::sim::EntryCheckpoint& expectedEntry = expected.entries.at(i);
+        const vector::sim::EntryCheckpoint& actualEntry = actual.entries.at(i);
+        EXPECT_EQ(expectedEntry.type, actualEntry.type);
+        EXPECT_EQ(expectedEntry.generation, actualEntry.generation);
+        EXPECT_EQ(expectedEntry.teamID, actualEntry.teamID);
+        if(expectedEntry.type == vector::sim::CHECKPOINT_ENTRY_TYPE::FREE)
+        {
+            continue;
+        }
+
+        EXPECT_EQ(expectedEntry.ID, actualEntry.ID);
+        EXPECT_EQ(expectedEntry.inertialData.curHeading, actualEntry.inertialData.curHeading);
+        EXPECT_EQ(expectedEntry.inertialData.curSpeed, actualEntry.inertialData.curSpeed);
+        EXPECT_EQ(expectedEntry.inertialData.xCoord, actualEntry.inertialData.xCoord);
+        EXPECT_EQ(expectedEntry.inertialData.yCoord, actualEntry.inertialData.yCoord);
+        EXPECT_EQ(expectedEntry.desiredHeading, actualEntry.desiredHeading);
+        EXPECT_EQ(expectedEntry.status, actualEntry.status);
+        EXPECT_EQ(expectedEntry.inSpatialIndex, actualEntry.inSpatialIndex);
+        EXPECT_EQ(expectedEntry.lockedTarget, actualEntry.lockedTarget);
+        EXPECT_EQ(expectedEntry.missilesRemaining, actualEntry.missilesRemaining);
+        EXPECT_EQ(expectedEntry.target, actualEntry.target);
+        EXPECT_EQ(expectedEntry.fuelTicks, actualEntry.fuelTicks);
+    }
+
+    ASSERT_EQ(expected.teamContacts.size(), actual.teamContacts.size());
+    for(size_t teamID = 0; teamID < expected.teamContacts.size(); ++teamID)
+    {
+        ASSERT_EQ(expected.teamContacts.at(teamID).size(), actual.teamContacts.at(teamID).size());
+        for(size_t i = 0; i < expected.teamContacts.at(teamID).size(); ++i)
+        {
+            EXPECT_EQ(expected.teamContacts.at(teamID).at(i).index, actual.teamContacts.at(teamID).at(i).index);
+            EXPECT_EQ(expected.teamContacts.at(teamID).at(i).identified, actual.teamContacts.at(teamID).at(i).identified);
+        }
+    }
+}
+
 TEST(TestGameEngine, TestAddMover)
 {
     std::string moverID = "brot";
@@ -26,7 +85,7 @@ TEST(TestGameEngine, TestAddMover)
 
     // sucessfully add Mover with unique ID
     EXPECT_CALL(*mockMover, GetID()).WillRepeatedly(::testing::Return(moverID));
-    bool added = engine.AddMover(mockMover);
+    bool added = engine.AddMover(mockMover).IsValid();
     EXPECT_TRUE(added);
     auto mover = engine.GetMover(moverID);
 
@@ -38,6 +97,979 @@ TEST(TestGameEngine, TestAddMover)
     EXPECT_EQ(nullptr, mover);
 }
 
+TEST(TestGameEngine, TestAddFighter)
+{
+    std::string moverID = "brot";
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    // sucessfully add fighter with unique ID
+    EXPECT_TRUE(engine.AddFighter(moverID, 1, perfValues).IsValid());
+
+    // IDs are unique across stored fighters and Mover objects
+    EXPECT_FALSE(engine.AddFighter(moverID, 2, perfValues).IsValid());
+    std::shared_ptr<MockMover> mockMover = std::make_shared<MockMover>();
+    EXPECT_CALL(*mockMover, GetID()).WillRepeatedly(::testing::Return(moverID));
+    EXPECT_FALSE(engine.AddMover(mockMover).IsValid());
+
+    // stored fighters are retrievable as MoverInterface views
+    auto mover = engine.GetMover(moverID);
+    ASSERT_NE(nullptr, mover);
+    EXPECT_EQ(moverID, mover->GetID());
+    EXPECT_EQ(1, mover->GetTeam());
+}
+
+TEST(TestGameEngine, TestTickStoredFighter)
+{
+    std::string moverID = "brot";
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    EXPECT_TRUE(engine.AddFighter(moverID, 1, perfValues).IsValid());
+
+    // start the fighter one Move away from the top boundary heading straight up
+    vector::sim::InertialData initialPos;
+    initialPos.curHeading = 0;
+    initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX - vector::sim::FIGHTER_SPEED_MAX;
+    EXPECT_TRUE(engine.GetMover(moverID)->SetInitialInertialData(initialPos));
+
+    // one Tick brings the fighter to the boundary
+    engine.Tick();
+    EXPECT_EQ(vector::sim::Y_COORD_MAX, engine.GetMover(moverID)->GetInertialData().yCoord);
+    EXPECT_EQ(1, engine.GetGameState().moverList.size());
+
+    // the next Tick takes it out of bounds, and the one after removes it
+    engine.Tick();
+    EXPECT_FALSE(engine.GetMover(moverID)->GetStatus());
+    engine.Tick();
+    EXPECT_EQ(nullptr, engine.GetMover(moverID));
+    EXPECT_EQ(0, engine.GetGameState().moverList.size());
+}
+
+TEST(TestGameEngine, TestMoverHandles)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    ASSERT_TRUE(brotHandle.IsValid());
+    ASSERT_TRUE(marmHandle.IsValid());
+    EXPECT_NE(brotHandle, marmHandle);
+
+    // handles are looked up by ID at the edge, and address the same Mover as the ID
+    EXPECT_EQ(brotHandle, engine.GetMoverHandle("brot"));
+    EXPECT_FALSE(engine.GetMoverHandle("fake").IsValid());
+    ASSERT_NE(nullptr, engine.GetMover(brotHandle));
+    EXPECT_EQ("brot", engine.GetMover(brotHandle)->GetID());
+
+    // commands can be addressed by handle alone
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    cmd.payload = vector::util::HeadingPayload{90};
+    EXPECT_TRUE(engine.InputCommand(marmHandle, cmd));
+    EXPECT_FALSE(engine.InputCommand(vector::sim::MoverHandle(), cmd));
+
+    // GameState carries handles, ordered by handle index
+    vector::sim::GameState gameState = engine.GetGameState();
+    ASSERT_EQ(2, gameState.moverList.size());
+    EXPECT_EQ(brotHandle, gameState.moverList.at(0).handle);
+    EXPECT_EQ(marmHandle, gameState.moverList.at(1).handle);
+
+    // once removed, the handle goes stale
+    engine.GetMover(brotHandle)->Destroy();
+    engine.Tick();
+    EXPECT_EQ(nullptr, engine.GetMover(brotHandle));
+    EXPECT_FALSE(engine.InputCommand(brotHandle, cmd));
+
+    // the freed index is reused by a new Mover, but the stale handle still does not resolve
+    vector::sim::MoverHandle gnarHandle = engine.AddFighter("gnar", 1, perfValues);
+    EXPECT_EQ(brotHandle.index, gnarHandle.index);
+    EXPECT_NE(brotHandle.generation, gnarHandle.generation);
+    EXPECT_EQ(nullptr, engine.GetMover(brotHandle));
+    EXPECT_EQ("gnar", engine.GetMover(gnarHandle)->GetID());
+
+    // the removed Mover's ID is free to be used again
+    EXPECT_TRUE(engine.AddFighter("brot", 1, perfValues).IsValid());
+}
+
+TEST(TestGameEngine, TestGameStateSnapshot)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    vector::sim::MoverHandle handle = engine.AddFighter("brot", 1, perfValues);
+
+    vector::sim::InertialData initialPos;
+    initialPos.curHeading = 90;
+    initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    EXPECT_TRUE(engine.GetMover(handle)->SetInitialInertialData(initialPos));
+
+    // changes made before the first Tick are captured on request
+    std::shared_ptr<const vector::sim::GameState> heldSnapshot = engine.GetGameStateSnapshot();
+    ASSERT_EQ(1, heldSnapshot->moverList.size());
+    EXPECT_EQ(initialPos.xCoord, heldSnapshot->moverList.at(0).inertialData.xCoord);
+
+    // without changes, readers share the same snapshot
+    EXPECT_EQ(heldSnapshot, engine.GetGameStateSnapshot());
+
+    // a held snapshot is never rebuilt underneath its reader, however many Ticks pass
+    for(int i = 0; i < 4; ++i)
+    {
+        engine.Tick();
+    }
+    EXPECT_EQ(initialPos.xCoord, heldSnapshot->moverList.at(0).inertialData.xCoord);
+
+    std::shared_ptr<const vector::sim::GameState> latestSnapshot = engine.GetGameStateSnapshot();
+    ASSERT_EQ(1, latestSnapshot->moverList.size());
+    EXPECT_EQ(initialPos.xCoord + 4 * vector::sim::FIGHTER_SPEED_MAX, latestSnapshot->moverList.at(0).inertialData.xCoord);
+}
+
+TEST(TestGameEngine, TestGameStateSnapshotConcurrentReaders)
+{
+    constexpr int NUM_FIGHTERS = 100;
+    constexpr int NUM_TICKS = 200;
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    // each fighter flies out from the centre along its own ray, so none collide
+    for(int i = 0; i < NUM_FIGHTERS; ++i)
+    {
+        vector::sim::InertialData initialPos;
+        initialPos.curHeading = (i * 7) % vector::sim::HEADING_FULL_CIRCLE;
+        initialPos.xCoord = vector::sim::X_COORD_MAX / 2 + vector::util::MathUtil::GetXComponentOfSpeed(2000.0, initialPos.curHeading);
+        initialPos.yCoord = vector::sim::Y_COORD_MAX / 2 + vector::util::MathUtil::GetYComponentOfSpeed(2000.0, initialPos.curHeading);
+
+        vector::sim::MoverHandle handle = engine.AddFighter("brot" + std::to_string(i), i % 2, perfValues);
+        EXPECT_TRUE(engine.GetMover(handle)->SetInitialInertialData(initialPos));
+    }
+    engine.GetGameStateSnapshot();
+
+    // readers grab snapshots while the engine ticks, and always see a complete, ordered state
+    std::atomic<bool> ticking{true};
+    std::atomic<int> badSnapshots{0};
+    std::vector<std::thread> readers;
+    for(int r = 0; r < 3; ++r)
+    {
+        readers.emplace_back([&engine, &ticking, &badSnapshots]()
+        {
+            while(ticking)
+            {
+                auto snapshot = engine.GetGameStateSnapshot();
+                if(snapshot->moverList.size() != NUM_FIGHTERS)
+                {
+                    ++badSnapshots;
+                    continue;
+                }
+                for(int i = 0; i < NUM_FIGHTERS; ++i)
+                {
+                    if(snapshot->moverList[i].ID != "brot" + std::to_string(i))
+                    {
+                        ++badSnapshots;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+
+    for(int i = 0; i < NUM_TICKS; ++i)
+    {
+        engine.Tick();
+    }
+    ticking = false;
+    for(auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(0, badSnapshots);
+}
+
+TEST(TestGameEngine, TestTeamGameStateSnapshot)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    // brot looks north at marm, kilo closes on brot from behind and tnir is well behind brot, looking away
+    vector::sim::InertialData initialPos;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+    engine.GetMover(brotHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.yCoord += 30000.0;
+    initialPos.curHeading = vector::sim::HEADING_HALF_CIRCLE;
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2 - 5000.0;
+    initialPos.curHeading = 0;
+    vector::sim::MoverHandle kiloHandle = engine.AddFighter("kilo", 2, perfValues);
+    engine.GetMover(kiloHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2 - 30000.0;
+    initialPos.curHeading = vector::sim::HEADING_HALF_CIRCLE;
+    vector::sim::MoverHandle tnirHandle = engine.AddFighter("tnir", 2, perfValues);
+    engine.GetMover(tnirHandle)->SetInitialInertialData(initialPos);
+
+    engine.Tick();
+
+    // brot's radar holds marm, and kilo is within view range
+    std::shared_ptr<const vector::sim::GameState> teamOneView = engine.GetTeamGameStateSnapshot(1);
+    ASSERT_EQ(3, teamOneView->moverList.size());
+    EXPECT_EQ(brotHandle, teamOneView->moverList.at(0).handle);
+    EXPECT_EQ(marmHandle, teamOneView->moverList.at(1).handle);
+    EXPECT_EQ(kiloHandle, teamOneView->moverList.at(2).handle);
+
+    // a team always sees all of its own
+    std::shared_ptr<const vector::sim::GameState> teamTwoView = engine.GetTeamGameStateSnapshot(2);
+    ASSERT_EQ(4, teamTwoView->moverList.size());
+    EXPECT_EQ(tnirHandle, teamTwoView->moverList.at(3).handle);
+
+    // without changes, readers share the same view
+    EXPECT_EQ(teamOneView, engine.GetTeamGameStateSnapshot(1));
+
+    // a team with no Movers sees nothing
+    EXPECT_TRUE(engine.GetTeamGameStateSnapshot(3)->moverList.empty());
+
+    // by radar alone, kilo drops out of view, while a held view is left as it was
+    EXPECT_FALSE(engine.SetViewRange(-1.0));
+    EXPECT_TRUE(engine.SetViewRange(0.0));
+    EXPECT_EQ(0.0, engine.GetViewRange());
+    std::shared_ptr<const vector::sim::GameState> radarOnlyView = engine.GetTeamGameStateSnapshot(1);
+    ASSERT_EQ(2, radarOnlyView->moverList.size());
+    EXPECT_EQ(marmHandle, radarOnlyView->moverList.at(1).handle);
+    EXPECT_EQ(3, teamOneView->moverList.size());
+}
+
+TEST(TestGameEngine, TestTeamGameStateSnapshotEveryTeam)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+    perfValues.radarRange = 0.0;
+    EXPECT_TRUE(engine.SetViewRange(0.0));
+
+    // one fighter on each of the 256 teams, none of which see another
+    std::vector<vector::sim::MoverHandle> handles;
+    vector::sim::InertialData initialPos;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    for(uint32_t teamID = 0; teamID <= UINT8_MAX; ++teamID)
+    {
+        initialPos.xCoord = 1000.0 + 1000.0 * teamID;
+        handles.push_back(engine.AddFighter("fighter" + std::to_string(teamID), static_cast<vector::sim::team_ID>(teamID), perfValues));
+        ASSERT_TRUE(handles.back().IsValid());
+        engine.GetMover(handles.back())->SetInitialInertialData(initialPos);
+    }
+    engine.Tick();
+
+    // the last team sees its own fighter like any other
+    for(uint32_t teamID = 0; teamID <= UINT8_MAX; ++teamID)
+    {
+        std::shared_ptr<const vector::sim::GameState> teamView = engine.GetTeamGameStateSnapshot(static_cast<vector::sim::team_ID>(teamID));
+        ASSERT_EQ(1, teamView->moverList.size());
+        EXPECT_EQ(handles.at(teamID), teamView->moverList.at(0).handle);
+    }
+}
+
+TEST(TestGameEngine, TestMetrics)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    vector::sim::MoverHandle handle = engine.AddFighter("brot", 1, perfValues);
+    engine.AddFighter("marm", 2, perfValues);
+
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    cmd.payload = vector::util::HeadingPayload{90};
+    EXPECT_TRUE(engine.InputCommand(handle, cmd));
+    cmd.payload = vector::util::TargetPayload{"fake"};
+    EXPECT_FALSE(engine.InputCommand(handle, cmd));
+
+    engine.GetMover(handle)->Destroy();
+    engine.Tick();
+    engine.Tick();
+
+    // counters and one histogram sample per Tick and per command
+    std::string metricsText = engine.GetMetrics().ToText("");
+    EXPECT_NE(std::string::npos, metricsText.find("ticks 2\n"));
+    EXPECT_NE(std::string::npos, metricsText.find("commands_processed 1\n"));
+    EXPECT_NE(std::string::npos, metricsText.find("commands_rejected 1\n"));
+    EXPECT_NE(std::string::npos, metricsText.find("movers_added 2\n"));
+    EXPECT_NE(std::string::npos, metricsText.find("movers_removed 1\n"));
+    EXPECT_NE(std::string::npos, metricsText.find("tick count=2 "));
+    EXPECT_NE(std::string::npos, metricsText.find("tick_move_stored count=2 "));
+    EXPECT_NE(std::string::npos, metricsText.find("command_lock_wait count=2 "));
+}
+
+TEST(TestGameEngine, TestQueueCommand)
+{
+    std::shared_ptr<MockMover> mockMover = std::make_shared<MockMover>();
+    EXPECT_CALL(*mockMover, GetID()).WillRepeatedly(::testing::Return("brot"));
+    EXPECT_CALL(*mockMover, GetStatus()).WillRepeatedly(::testing::Return(true));
+
+    vector::sim::GameEngine engine;
+    vector::sim::MoverHandle handle = engine.AddMover(mockMover);
+    ASSERT_TRUE(handle.IsValid());
+
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    cmd.payload = vector::util::HeadingPayload{90};
+    std::future<bool> first = engine.QueueCommand(handle, cmd);
+    cmd.payload = vector::util::HeadingPayload{180};
+    std::future<bool> second = engine.QueueCommand(handle, cmd);
+    cmd.payload = vector::util::TargetPayload{"fake"};
+    std::future<bool> bad = engine.QueueCommand(handle, cmd);
+    std::future<bool> stale = engine.QueueCommand(vector::sim::MoverHandle(), cmd);
+
+    // nothing is applied until the next Tick
+    EXPECT_EQ(std::future_status::timeout, first.wait_for(std::chrono::milliseconds(0)));
+
+    // then in the order queued, ahead of the move
+    {
+        ::testing::InSequence sequence;
+        EXPECT_CALL(*mockMover, SetNewHeading(90)).WillOnce(::testing::Return(true));
+        EXPECT_CALL(*mockMover, SetNewHeading(180)).WillOnce(::testing::Return(true));
+        EXPECT_CALL(*mockMover, Move());
+    }
+    engine.Tick();
+
+    ASSERT_EQ(std::future_status::ready, first.wait_for(std::chrono::milliseconds(0)));
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+    EXPECT_FALSE(bad.get());
+    EXPECT_FALSE(stale.get());
+
+    std::string metricsText = engine.GetMetrics().ToText("");
+    EXPECT_NE(std::string::npos, metricsText.find("commands_queued 4\n"));
+    EXPECT_NE(std::string::npos, metricsText.find("commands_processed 2\n"));
+    EXPECT_NE(std::string::npos, metricsText.find("commands_rejected 2\n"));
+}
+
+TEST(TestGameEngine, TestQueueCommandFull)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+    vector::sim::MoverHandle handle = engine.AddFighter("brot", 1, perfValues);
+
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    cmd.payload = vector::util::HeadingPayload{90};
+
+    std::vector<std::future<bool>> results;
+    for(size_t i = 0; i < vector::sim::COMMAND_QUEUE_CAPACITY; ++i)
+    {
+        results.push_back(engine.QueueCommand(handle, cmd));
+    }
+
+    // a full queue fails the command straight away
+    std::future<bool> dropped = engine.QueueCommand(handle, cmd);
+    ASSERT_EQ(std::future_status::ready, dropped.wait_for(std::chrono::milliseconds(0)));
+    EXPECT_FALSE(dropped.get());
+
+    engine.Tick();
+    for(auto& result : results)
+    {
+        EXPECT_TRUE(result.get());
+    }
+
+    // and the drained queue takes commands again
+    std::future<bool> accepted = engine.QueueCommand(handle, cmd);
+    engine.Tick();
+    EXPECT_TRUE(accepted.get());
+    EXPECT_NE(std::string::npos, engine.GetMetrics().ToText("").find("commands_dropped 1\n"));
+}
+
+TEST(TestGameEngine, TestSpatialQueries)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    // two fighters close together mid-arena and one far away
+    vector::sim::InertialData initialPos;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    vector::sim::MoverHandle nearHandle = engine.AddFighter("brot", 1, perfValues);
+    engine.GetMover(nearHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord += 3000.0;
+    vector::sim::MoverHandle closeHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(closeHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 8;
+    vector::sim::MoverHandle farHandle = engine.AddFighter("gnar", 2, perfValues);
+    engine.GetMover(farHandle)->SetInitialInertialData(initialPos);
+
+    // the index is brought up to date by Tick
+    std::vector<vector::sim::MoverHandle> results;
+    engine.GetMoversInRadius(vector::sim::X_COORD_MAX / 2, vector::sim::Y_COORD_MAX / 2, 10000.0, results);
+    EXPECT_TRUE(results.empty());
+
+    engine.Tick();
+    engine.GetMoversInRadius(vector::sim::X_COORD_MAX / 2, vector::sim::Y_COORD_MAX / 2, 10000.0, results);
+    EXPECT_EQ(2, results.size());
+    EXPECT_NE(results.end(), std::find(results.begin(), results.end(), nearHandle));
+    EXPECT_NE(results.end(), std::find(results.begin(), results.end(), closeHandle));
+
+    results.clear();
+    engine.GetNearestMovers(vector::sim::X_COORD_MAX / 2, vector::sim::Y_COORD_MAX / 2, 3, results);
+    ASSERT_EQ(3, results.size());
+    EXPECT_EQ(nearHandle, results.at(0));
+    EXPECT_EQ(closeHandle, results.at(1));
+    EXPECT_EQ(farHandle, results.at(2));
+
+    // removed Movers leave the index
+    engine.GetMover(closeHandle)->Destroy();
+    engine.Tick();
+    results.clear();
+    engine.GetMoversInRadius(vector::sim::X_COORD_MAX / 2, vector::sim::Y_COORD_MAX / 2, 10000.0, results);
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(nearHandle, results.at(0));
+}
+
+TEST(TestGameEngine, TestRadarCommands)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    // brot looks north at marm, gnar is brot's wingman and tnir is well behind brot
+    vector::sim::InertialData initialPos;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+    engine.GetMover(brotHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord += 2000.0;
+    vector::sim::MoverHandle gnarHandle = engine.AddFighter("gnar", 1, perfValues);
+    engine.GetMover(gnarHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.yCoord += 30000.0;
+    initialPos.curHeading = vector::sim::HEADING_HALF_CIRCLE;
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2 - 30000.0;
+    vector::sim::MoverHandle tnirHandle = engine.AddFighter("tnir", 2, perfValues);
+    engine.GetMover(tnirHandle)->SetInitialInertialData(initialPos);
+
+    engine.Tick();
+
+    std::vector<vector::sim::RadarContact> contacts;
+    engine.GetTeamContacts(1, contacts);
+    ASSERT_EQ(1, contacts.size());
+    EXPECT_EQ(marmHandle, contacts.at(0).handle);
+    EXPECT_FALSE(contacts.at(0).identified);
+
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::IDENTIFY;
+    cmd.payload = vector::util::TargetPayload{"marm"};
+    EXPECT_TRUE(engine.InputCommand(brotHandle, cmd));
+
+    // not a contact, not a unit, and no target at all
+    cmd.payload = vector::util::TargetPayload{"tnir"};
+    EXPECT_FALSE(engine.InputCommand(brotHandle, cmd));
+    cmd.payload = vector::util::TargetPayload{"fake"};
+    EXPECT_FALSE(engine.InputCommand(brotHandle, cmd));
+    cmd.payload = vector::util::HeadingPayload{90};
+    EXPECT_FALSE(engine.InputCommand(brotHandle, cmd));
+
+    contacts.clear();
+    engine.GetTeamContacts(1, contacts);
+    ASSERT_EQ(1, contacts.size());
+    EXPECT_TRUE(contacts.at(0).identified);
+
+    // any unit of the team may lock on to the team's contacts
+    cmd.command = vector::util::COMMAND_TYPE::AQUIRE;
+    cmd.payload = vector::util::TargetPayload{"gnar"};
+    EXPECT_FALSE(engine.InputCommand(brotHandle, cmd));
+    cmd.payload = vector::util::TargetPayload{"marm"};
+    EXPECT_TRUE(engine.InputCommand(gnarHandle, cmd));
+    EXPECT_EQ(marmHandle, engine.GetLockedTarget(gnarHandle));
+    EXPECT_FALSE(engine.GetLockedTarget(brotHandle).IsValid());
+
+    engine.Tick();
+    EXPECT_EQ(marmHandle, engine.GetLockedTarget(gnarHandle));
+
+    // the lock is lost with the contact
+    engine.GetMover(marmHandle)->Destroy();
+    engine.Tick();
+    EXPECT_FALSE(engine.GetLockedTarget(gnarHandle).IsValid());
+    contacts.clear();
+    engine.GetTeamContacts(1, contacts);
+    EXPECT_TRUE(contacts.empty());
+}
+
+TEST(TestGameEngine, TestLaunchMissile)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+    perfValues.numMissiles = 2;
+
+    // brot and gnar look north at marm, which flies south toward them
+    vector::sim::InertialData initialPos;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+    engine.GetMover(brotHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord += 2000.0;
+    vector::sim::MoverHandle gnarHandle = engine.AddFighter("gnar", 1, perfValues);
+    engine.GetMover(gnarHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.yCoord += 30000.0;
+    initialPos.curHeading = vector::sim::HEADING_HALF_CIRCLE;
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+
+    engine.Tick();
+    EXPECT_EQ(2, engine.GetMissilesRemaining(brotHandle));
+
+    // a missile can only be launched at the launcher's locked target
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::LAUNCH;
+    cmd.payload = vector::util::TargetPayload{"marm"};
+    EXPECT_FALSE(engine.InputCommand(brotHandle, cmd));
+
+    cmd.command = vector::util::COMMAND_TYPE::AQUIRE;
+    EXPECT_TRUE(engine.InputCommand(brotHandle, cmd));
+    cmd.command = vector::util::COMMAND_TYPE::LAUNCH;
+    EXPECT_FALSE(engine.InputCommand(gnarHandle, cmd));
+    EXPECT_TRUE(engine.InputCommand(brotHandle, cmd));
+    EXPECT_EQ(1, engine.GetMissilesRemaining(brotHandle));
+    EXPECT_NE(std::string::npos, engine.GetMetrics().ToText("").find("missiles_launched 1\n"));
+
+    // the missile is a Mover of the launcher's team, seen through the GameState but neither commandable nor found by ID
+    vector::sim::GameState gameState = engine.GetGameState();
+    ASSERT_EQ(4, gameState.moverList.size());
+    EXPECT_EQ("brot-M1", gameState.moverList.at(3).ID);
+    EXPECT_EQ(1, gameState.moverList.at(3).teamID);
+    vector::sim::MoverHandle missileHandle = gameState.moverList.at(3).handle;
+    ASSERT_TRUE(missileHandle.IsValid());
+    EXPECT_EQ(nullptr, engine.GetMover(missileHandle));
+    EXPECT_FALSE(engine.GetMoverHandle("brot-M1").IsValid());
+
+    vector::util::Command vectorCmd;
+    vectorCmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    vectorCmd.payload = vector::util::HeadingPayload{90};
+    EXPECT_FALSE(engine.InputCommand(missileHandle, vectorCmd));
+
+    // the missile runs marm down well within its fuel, and both are removed
+    vector::sim::GameEngine::EventCursor cursor = engine.SubscribeEvents();
+    int ticks = 0;
+    while(engine.GetMover(marmHandle) != nullptr && ticks < 20)
+    {
+        engine.Tick();
+        ++ticks;
+    }
+    EXPECT_LT(ticks, 20);
+    EXPECT_NE(std::string::npos, engine.GetMetrics().ToText("").find("missile_hits 1\n"));
+    EXPECT_EQ(2, engine.GetGameState().moverList.size());
+
+    // the hit is published, then the missile and the wreck are removed in the Tick after
+    vector::sim::EngineEvent event;
+    ASSERT_TRUE(engine.PollEvent(cursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_DESTROYED, event.type);
+    EXPECT_EQ(vector::sim::DESTRUCTION_CAUSE::MISSILE_HIT, event.cause);
+    EXPECT_EQ(marmHandle, event.handle);
+    EXPECT_EQ(missileHandle, event.otherHandle);
+    EXPECT_EQ(2, event.teamID);
+    ASSERT_TRUE(engine.PollEvent(cursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_REMOVED, event.type);
+    EXPECT_EQ(missileHandle, event.handle);
+    ASSERT_TRUE(engine.PollEvent(cursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_REMOVED, event.type);
+    EXPECT_EQ(marmHandle, event.handle);
+    EXPECT_FALSE(engine.PollEvent(cursor, event));
+
+    // with the target gone there is nothing to lock on to or launch at
+    EXPECT_FALSE(engine.InputCommand(brotHandle, cmd));
+    EXPECT_EQ(1, engine.GetMissilesRemaining(brotHandle));
+}
+
+TEST(TestGameEngine, TestMissileIDLongLauncher)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+    const std::string launcherID(vector::sim::MISSILE_ID_SIZE + 8, 'b');
+
+    vector::sim::InertialData initialPos;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    vector::sim::MoverHandle launcherHandle = engine.AddFighter(launcherID, 1, perfValues);
+    engine.GetMover(launcherHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.yCoord += 30000.0;
+    initialPos.curHeading = vector::sim::HEADING_HALF_CIRCLE;
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+    engine.Tick();
+
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::AQUIRE;
+    cmd.payload = vector::util::TargetPayload{"marm"};
+    ASSERT_TRUE(engine.InputCommand(launcherHandle, cmd));
+    cmd.command = vector::util::COMMAND_TYPE::LAUNCH;
+    ASSERT_TRUE(engine.InputCommand(launcherHandle, cmd));
+
+    // the launcher's ID is cut short so the missile's fits in place, keeping the launch number that makes it unique
+    vector::sim::GameState gameState = engine.GetGameState();
+    ASSERT_EQ(3, gameState.moverList.size());
+    const std::string& missileID = gameState.moverList.at(2).ID;
+    EXPECT_EQ(vector::sim::MISSILE_ID_SIZE, missileID.size());
+    EXPECT_EQ(launcherID.substr(0, vector::sim::MISSILE_ID_SIZE - 3) + "-M1", missileID);
+}
+
+TEST(TestGameEngine, TestMissileExpires)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+
+    vector::sim::InertialData initialPos;
+    initialPos.xCoord = 20000.0;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    initialPos.curHeading = 90;
+    vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+    engine.GetMover(brotHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord += 50000.0;
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+
+    engine.Tick();
+
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::AQUIRE;
+    cmd.payload = vector::util::TargetPayload{"marm"};
+    ASSERT_TRUE(engine.InputCommand(brotHandle, cmd));
+    cmd.command = vector::util::COMMAND_TYPE::LAUNCH;
+    ASSERT_TRUE(engine.InputCommand(brotHandle, cmd));
+
+    // the target is lost before the missile gets there, so it flies on until its fuel runs out
+    engine.GetMover(marmHandle)->Destroy();
+    for(uint32_t tick = 1; tick < vector::sim::MISSILE_FUEL_TICKS; ++tick)
+    {
+        engine.Tick();
+    }
+    ASSERT_EQ(2, engine.GetGameState().moverList.size());
+    EXPECT_EQ("brot-M1", engine.GetGameState().moverList.at(1).ID);
+
+    engine.Tick();
+    EXPECT_NE(std::string::npos, engine.GetMetrics().ToText("").find("missile_hits 0\n"));
+    EXPECT_EQ(1, engine.GetGameState().moverList.size());
+
+    // the missile's entry is recycled for the next Mover
+    vector::sim::MoverHandle gnarHandle = engine.AddFighter("gnar", 1, perfValues);
+    EXPECT_EQ(marmHandle.index + 1, gnarHandle.index);
+}
+
+TEST(TestGameEngine, TestCheckpoint)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+    perfValues.numMissiles = 2;
+
+    // brot and gnar look north at marm, which flies south toward them; vexa is shot down before the checkpoint
+    vector::sim::InertialData initialPos;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+    engine.GetMover(brotHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord += 2000.0;
+    vector::sim::MoverHandle gnarHandle = engine.AddFighter("gnar", 1, perfValues);
+    engine.GetMover(gnarHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.yCoord += 30000.0;
+    initialPos.curHeading = vector::sim::HEADING_HALF_CIRCLE;
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord += 20000.0;
+    vector::sim::MoverHandle vexaHandle = engine.AddFighter("vexa", 2, perfValues);
+    engine.GetMover(vexaHandle)->SetInitialInertialData(initialPos);
+
+    engine.Tick();
+
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::IDENTIFY;
+    cmd.payload = vector::util::TargetPayload{"marm"};
+    ASSERT_TRUE(engine.InputCommand(brotHandle, cmd));
+    cmd.command = vector::util::COMMAND_TYPE::AQUIRE;
+    ASSERT_TRUE(engine.InputCommand(brotHandle, cmd));
+    ASSERT_TRUE(engine.InputCommand(gnarHandle, cmd));
+    cmd.command = vector::util::COMMAND_TYPE::LAUNCH;
+    ASSERT_TRUE(engine.InputCommand(brotHandle, cmd));
+    cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    cmd.payload = vector::util::HeadingPayload{90};
+    ASSERT_TRUE(engine.InputCommand(gnarHandle, cmd));
+
+    engine.GetMover(vexaHandle)->Destroy();
+    engine.Tick();
+    engine.Tick();
+
+    // mid-flight, with gnar still turning and vexa's entry free for the next Mover
+    vector::sim::EngineCheckpoint checkpoint;
+    ASSERT_TRUE(engine.GetCheckpoint(checkpoint));
+    EXPECT_EQ(3, checkpoint.ticks);
+    ASSERT_EQ(5, checkpoint.entries.size());
+    EXPECT_EQ(std::vector<uint32_t>{vexaHandle.index}, checkpoint.freeEntries);
+    EXPECT_EQ(vexaHandle.generation + 1, checkpoint.entries.at(vexaHandle.index).generation);
+    ASSERT_EQ(1, checkpoint.missileEntries.size());
+    const vector::sim::EntryCheckpoint& missileCheckpoint = checkpoint.entries.at(checkpoint.missileEntries.at(0));
+    EXPECT_EQ(vector::sim::CHECKPOINT_ENTRY_TYPE::MISSILE, missileCheckpoint.type);
+    EXPECT_EQ(marmHandle, missileCheckpoint.target);
+    EXPECT_EQ(vector::sim::MISSILE_FUEL_TICKS - 2, missileCheckpoint.fuelTicks);
+    EXPECT_EQ(90, checkpoint.entries.at(gnarHandle.index).desiredHeading);
+    EXPECT_NE(90, checkpoint.entries.at(gnarHandle.index).inertialData.curHeading);
+    EXPECT_EQ(marmHandle, checkpoint.entries.at(brotHandle.index).lockedTarget);
+    EXPECT_EQ(1, checkpoint.entries.at(brotHandle.index).missilesRemaining);
+    ASSERT_LE(2, checkpoint.teamContacts.size());
+    ASSERT_EQ(1, checkpoint.teamContacts.at(1).size());
+    EXPECT_TRUE(checkpoint.teamContacts.at(1).at(0).identified);
+
+    vector::sim::GameEngine restored;
+    ASSERT_TRUE(restored.RestoreCheckpoint(checkpoint));
+    vector::sim::EngineCheckpoint restoredCheckpoint;
+    ASSERT_TRUE(restored.GetCheckpoint(restoredCheckpoint));
+    ExpectSameCheckpoint(checkpoint, restoredCheckpoint);
+
+    // both engines run the missile down on marm in step, and hand vexa's entry to the next Mover
+    for(int tick = 0; tick < 20; ++tick)
+    {
+        engine.Tick();
+        restored.Tick();
+    }
+    EXPECT_EQ(nullptr, restored.GetMover(marmHandle));
+    ASSERT_TRUE(engine.GetCheckpoint(checkpoint));
+    ASSERT_TRUE(restored.GetCheckpoint(restoredCheckpoint));
+    ExpectSameCheckpoint(checkpoint, restoredCheckpoint);
+    EXPECT_EQ(engine.AddFighter("tnir", 2, perfValues), restored.AddFighter("tnir", 2, perfValues));
+
+    // only a new engine is restored into, and only from a consistent checkpoint
+    EXPECT_FALSE(restored.RestoreCheckpoint(checkpoint));
+    checkpoint.storeOrder.push_back(checkpoint.storeOrder.front());
+    vector::sim::GameEngine rejecting;
+    EXPECT_FALSE(rejecting.RestoreCheckpoint(checkpoint));
+    EXPECT_EQ(0, rejecting.GetGameState().moverList.size());
+
+    // Mover objects cannot be checkpointed
+    auto mockMover = std::make_shared<::testing::NiceMock<MockMover>>();
+    ON_CALL(*mockMover, GetID()).WillByDefault(::testing::Return("brot"));
+    ASSERT_TRUE(rejecting.AddMover(mockMover).IsValid());
+    EXPECT_FALSE(rejecting.GetCheckpoint(checkpoint));
+}
+
+TEST(TestGameEngine, TestCollisions)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+    perfValues.radarRange = 0.0;
+
+    // brot and marm fly head on at each other, close enough to pass through each other in one tick;
+    // gnar flies alongside brot far enough out to survive
+    vector::sim::InertialData initialPos;
+    initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+    vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+    engine.GetMover(brotHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord += 2000.0;
+    vector::sim::MoverHandle gnarHandle = engine.AddFighter("gnar", 1, perfValues);
+    engine.GetMover(gnarHandle)->SetInitialInertialData(initialPos);
+
+    initialPos.xCoord -= 2000.0;
+    initialPos.yCoord += 1000.0;
+    initialPos.curHeading = vector::sim::HEADING_HALF_CIRCLE;
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+
+    vector::sim::GameEngine::EventCursor cursor = engine.SubscribeEvents();
+    engine.Tick();
+
+    vector::sim::EngineEvent event;
+    ASSERT_TRUE(engine.PollEvent(cursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_DESTROYED, event.type);
+    EXPECT_EQ(vector::sim::DESTRUCTION_CAUSE::COLLISION, event.cause);
+    EXPECT_EQ(brotHandle, event.handle);
+    EXPECT_EQ(marmHandle, event.otherHandle);
+    ASSERT_TRUE(engine.PollEvent(cursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_DESTROYED, event.type);
+    EXPECT_EQ(marmHandle, event.handle);
+    EXPECT_EQ(brotHandle, event.otherHandle);
+    EXPECT_FALSE(engine.PollEvent(cursor, event));
+    EXPECT_NE(std::string::npos, engine.GetMetrics().ToText("").find("collisions 1\n"));
+
+    // the wrecks are out of the spatial index at once, and removed on the next Tick
+    std::vector<vector::sim::MoverHandle> nearby;
+    engine.GetMoversInRadius(vector::sim::X_COORD_MAX / 2, vector::sim::Y_COORD_MAX / 2, 5000.0, nearby);
+    ASSERT_EQ(1, nearby.size());
+    EXPECT_EQ(gnarHandle, nearby.at(0));
+
+    engine.Tick();
+    EXPECT_EQ(nullptr, engine.GetMover(brotHandle));
+    EXPECT_EQ(nullptr, engine.GetMover(marmHandle));
+    EXPECT_NE(nullptr, engine.GetMover(gnarHandle));
+
+    ASSERT_TRUE(engine.PollEvent(cursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_REMOVED, event.type);
+    EXPECT_EQ(brotHandle, event.handle);
+    EXPECT_EQ(1, event.tick);
+    ASSERT_TRUE(engine.PollEvent(cursor, event));
+    EXPECT_EQ(marmHandle, event.handle);
+    EXPECT_FALSE(engine.PollEvent(cursor, event));
+}
+
+TEST(TestGameEngine, TestEventStream)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+    perfValues.radarRange = 0.0;
+
+    // subscribers only see what is published after they subscribe, each at its own pace
+    vector::sim::GameEngine::EventCursor earlyCursor = engine.SubscribeEvents();
+    vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+    vector::sim::GameEngine::EventCursor lateCursor = engine.SubscribeEvents();
+
+    // marm is about to fly out of the arena
+    vector::sim::InertialData initialPos;
+    initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+    initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+    initialPos.yCoord = vector::sim::Y_COORD_MAX - 100.0;
+    vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+    engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+
+    vector::util::Command cmd;
+    cmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    cmd.payload = vector::util::HeadingPayload{90};
+    EXPECT_FALSE(engine.InputCommand(vector::sim::MoverHandle(), cmd));
+
+    vector::sim::EngineEvent event;
+    ASSERT_TRUE(engine.PollEvent(earlyCursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_ADDED, event.type);
+    EXPECT_EQ(brotHandle, event.handle);
+    EXPECT_EQ(1, event.teamID);
+    EXPECT_FALSE(event.otherHandle.IsValid());
+
+    for(auto cursorPtr : {&earlyCursor, &lateCursor})
+    {
+        ASSERT_TRUE(engine.PollEvent(*cursorPtr, event));
+        EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_ADDED, event.type);
+        EXPECT_EQ(marmHandle, event.handle);
+        EXPECT_EQ(2, event.teamID);
+
+        ASSERT_TRUE(engine.PollEvent(*cursorPtr, event));
+        EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::COMMAND_REJECTED, event.type);
+        EXPECT_EQ(vector::util::COMMAND_TYPE::VECTOR, event.command);
+        EXPECT_FALSE(event.handle.IsValid());
+        EXPECT_EQ(0, event.tick);
+
+        EXPECT_FALSE(engine.PollEvent(*cursorPtr, event));
+    }
+
+    // leaving the arena is published in the Tick it happens, removal in the next
+    engine.Tick();
+    ASSERT_TRUE(engine.PollEvent(earlyCursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::OUT_OF_BOUNDS, event.type);
+    EXPECT_EQ(marmHandle, event.handle);
+    EXPECT_EQ(0, event.tick);
+    EXPECT_FALSE(engine.PollEvent(earlyCursor, event));
+
+    engine.Tick();
+    ASSERT_TRUE(engine.PollEvent(earlyCursor, event));
+    EXPECT_EQ(vector::sim::ENGINE_EVENT_TYPE::MOVER_REMOVED, event.type);
+    EXPECT_EQ(marmHandle, event.handle);
+    EXPECT_EQ(1, event.tick);
+    EXPECT_FALSE(engine.PollEvent(earlyCursor, event));
+    EXPECT_EQ(0, earlyCursor.numMissed);
+    EXPECT_NE(std::string::npos, engine.GetMetrics().ToText("").find("events_published 5\n"));
+}
+
+TEST(TestGameEngine, TestParallelTickMatchesSerial)
+{
+    constexpr int NUM_FIGHTERS = 3000;
+    vector::sim::GameEngine serialEngine;
+    vector::sim::GameEngine parallelEngine(4);
+    vector::sim::MoverParams perfValues;
+
+    EXPECT_EQ(1, serialEngine.GetNumTickThreads());
+    EXPECT_EQ(4, parallelEngine.GetNumTickThreads());
+
+    for(int i = 0; i < NUM_FIGHTERS; ++i)
+    {
+        std::string moverID = "fighter" + std::to_string(i);
+
+        // spread the fighters across the arena, some close enough to the edge to leave it
+        vector::sim::InertialData initialPos;
+        initialPos.curHeading = (i * 7) % vector::sim::HEADING_FULL_CIRCLE;
+        initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+        initialPos.xCoord = (i * 997) % static_cast<int>(vector::sim::X_COORD_MAX);
+        initialPos.yCoord = (i * 331) % static_cast<int>(vector::sim::Y_COORD_MAX);
+
+        EXPECT_TRUE(serialEngine.AddFighter(moverID, i % 2, perfValues).IsValid());
+        EXPECT_TRUE(parallelEngine.AddFighter(moverID, i % 2, perfValues).IsValid());
+        EXPECT_TRUE(serialEngine.GetMover(moverID)->SetInitialInertialData(initialPos));
+        EXPECT_TRUE(parallelEngine.GetMover(moverID)->SetInitialInertialData(initialPos));
+        serialEngine.GetMover(moverID)->SetNewHeading((i * 13) % vector::sim::HEADING_FULL_CIRCLE);
+        parallelEngine.GetMover(moverID)->SetNewHeading((i * 13) % vector::sim::HEADING_FULL_CIRCLE);
+    }
+
+    for(int tick = 0; tick < 30; ++tick)
+    {
+        serialEngine.Tick();
+        parallelEngine.Tick();
+    }
+
+    vector::sim::GameState serialState = serialEngine.GetGameState();
+    vector::sim::GameState parallelState = parallelEngine.GetGameState();
+
+    // some fighters have left the arena and been removed, the same ones from both engines
+    EXPECT_LT(serialState.moverList.size(), NUM_FIGHTERS);
+    ASSERT_EQ(serialState.moverList.size(), parallelState.moverList.size());
+
+    for(size_t i = 0; i < serialState.moverList.size(); ++i)
+    {
+        EXPECT_EQ(serialState.moverList.at(i).ID, parallelState.moverList.at(i).ID);
+        EXPECT_EQ(serialState.moverList.at(i).inertialData.curHeading, parallelState.moverList.at(i).inertialData.curHeading);
+        EXPECT_EQ(serialState.moverList.at(i).inertialData.curSpeed, parallelState.moverList.at(i).inertialData.curSpeed);
+        EXPECT_EQ(serialState.moverList.at(i).inertialData.xCoord, parallelState.moverList.at(i).inertialData.xCoord);
+        EXPECT_EQ(serialState.moverList.at(i).inertialData.yCoord, parallelState.moverList.at(i).inertialData.yCoord);
+    }
+}
+
+TEST(TestGameEngine, TestParallelTickMoverObjects)
+{
+    vector::sim::GameEngine engine(3);
+    std::vector<std::shared_ptr<MockMover>> mockMovers;
+
+    for(int i = 0; i < 10; ++i)
+    {
+        auto mockMover = std::make_shared<MockMover>();
+        EXPECT_CALL(*mockMover, GetID()).WillRepeatedly(::testing::Return("brot" + std::to_string(i)));
+        EXPECT_TRUE(engine.AddMover(mockMover).IsValid());
+        mockMovers.push_back(mockMover);
+    }
+
+    // functioning Movers are moved exactly once, destroyed ones are not moved and are removed
+    for(int i = 0; i < 10; ++i)
+    {
+        bool functioning = (i % 3) != 0;
+        EXPECT_CALL(*mockMovers[i], GetStatus()).WillOnce(::testing::Return(functioning));
+        EXPECT_CALL(*mockMovers[i], Move).Times(functioning ? 1 : 0);
+    }
+    engine.Tick();
+
+    for(int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ((i % 3) != 0, engine.GetMover("brot" + std::to_string(i)) != nullptr);
+    }
+}
+
 TEST(TestGameEngine, TestTick)
 {
     std::string moverID = "brot";
@@ -46,7 +1078,7 @@ TEST(TestGameEngine, TestTick)
 
     // sucessfully add Mover with unique ID
     EXPECT_CALL(*mockMover, GetID()).WillRepeatedly(::testing::Return(moverID));
-    bool added = engine.AddMover(mockMover);
+    bool added = engine.AddMover(mockMover).IsValid();
     EXPECT_TRUE(added);
 
     // Move() is called on Mover's with status true (not destroyed)
@@ -63,7 +1095,7 @@ TEST(TestGameEngine, TestTickDestroyed)
 
     // sucessfully add Mover with unique ID
     EXPECT_CALL(*mockMover, GetID()).WillRepeatedly(::testing::Return(moverID));
-    bool added = engine.AddMover(mockMover);
+    bool added = engine.AddMover(mockMover).IsValid();
     EXPECT_TRUE(added);
 
     // Move() is not called on Movers with status false (destroyed)
@@ -75,7 +1107,6 @@ TEST(TestGameEngine, TestTickDestroyed)
 TEST(TestGameEngine, TestInputCommandVector)
 {
     std::string moverID = "brot";
-    std::string vectorString = "123";
     vector::sim::angle vectorAngle = 123;
 
     std::shared_ptr<MockMover> mockMover = std::make_shared<MockMover>();
@@ -85,21 +1116,21 @@ TEST(TestGameEngine, TestInputCommandVector)
     vector::util::Command goodCmd;
     goodCmd.command = vector::util::COMMAND_TYPE::VECTOR;
     goodCmd.subject = moverID;
-    goodCmd.object = vectorString;
+    goodCmd.payload = vector::util::HeadingPayload{vectorAngle};
 
     vector::util::Command badSubjectCmd;
     badSubjectCmd.command = vector::util::COMMAND_TYPE::VECTOR;
     badSubjectCmd.subject = "fake";
-    badSubjectCmd.object = vectorString;
+    badSubjectCmd.payload = vector::util::HeadingPayload{vectorAngle};
 
     vector::util::Command badObjectCmd;
     badObjectCmd.command = vector::util::COMMAND_TYPE::VECTOR;
     badObjectCmd.subject = moverID;
-    badObjectCmd.object = "fake";
+    badObjectCmd.payload = vector::util::TargetPayload{"fake"};
 
     // sucessfully add Mover with unique ID
     EXPECT_CALL(*mockMover, GetID()).WillRepeatedly(::testing::Return(moverID));
-    bool added = engine.AddMover(mockMover);
+    bool added = engine.AddMover(mockMover).IsValid();
     EXPECT_TRUE(added);
 
     // SetNewHeading should be called on receipt of valid vector cmd
@@ -115,6 +1146,31 @@ TEST(TestGameEngine, TestInputCommandVector)
     engine.InputCommand(badObjectCmd);
 }
 
+TEST(TestGameEngine, TestInputCommandVectorOutOfRange)
+{
+    vector::sim::GameEngine engine;
+    vector::sim::MoverParams perfValues;
+    const vector::sim::MoverHandle handle = engine.AddFighter("brot", 1, perfValues);
+    ASSERT_TRUE(handle.IsValid());
+
+    vector::util::Command vectorCmd;
+    vectorCmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    vectorCmd.subject = "brot";
+
+    // a heading the fighter does not take is rejected, not reported as applied
+    vectorCmd.payload = vector::util::HeadingPayload{360};
+    EXPECT_FALSE(engine.InputCommand(handle, vectorCmd));
+    vectorCmd.payload = vector::util::HeadingPayload{400};
+    EXPECT_FALSE(engine.InputCommand(handle, vectorCmd));
+
+    vectorCmd.payload = vector::util::HeadingPayload{359};
+    EXPECT_TRUE(engine.InputCommand(handle, vectorCmd));
+
+    const std::string text = engine.GetMetrics().ToText("");
+    EXPECT_NE(std::string::npos, text.find("commands_processed 1\n"));
+    EXPECT_NE(std::string::npos, text.find("commands_rejected 2\n"));
+}
+
 TEST(TestGameEngine, TestGameState)
 {
     std::string moverOneID = "brot";
@@ -164,10 +1220,10 @@ TEST(TestGameEngine, TestGameState)
     EXPECT_CALL(*mockMoverTwo, GetInertialData()).WillOnce(::testing::Return(expectedIntertialTwo));
 
     // sucessfully add Mover with unique ID
-    bool added = engine.AddMover(mockMoverOne);
+    bool added = engine.AddMover(mockMoverOne).IsValid();
     EXPECT_TRUE(added);
     
-    added = engine.AddMover(mockMoverTwo);
+    added = engine.AddMover(mockMoverTwo).IsValid();
     EXPECT_TRUE(added);
 
     vector::sim::GameState gameState = engine.GetGameState();
@@ -1,15 +1,22 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include "game/GameConstants.h"
 #include "game/GameManager.h"
 #include "game/PlayerInterface.h"
 #include "game/GameTypes.h"
 #include "game/GameSettingsInterface.h"
 #include "sim/SimTypes.h"
 #include "sim/GameEngine.h"
+#include "sim/ReplayPlayer.h"
+#include "sim/SimConstants.h"
 
+#include <chrono>
+#include <cmath>
+#include <functional>
 #include <vector>
 #include <memory>
+#include <thread>
 
 class MockPlayer : public vector::game::PlayerInterface
 {
@@ -17,7 +24,8 @@ class MockPlayer : public vector::game::PlayerInterface
         MOCK_METHOD(std::string,  GetPlayerID, (), (const, override));
         MOCK_METHOD(vector::sim::team_ID, GetTeamID, (), (const, override));
         MOCK_METHOD(bool, IsReady, (), (const, override));
-        MOCK_METHOD(void, UpdateGameState, (const vector::sim::GameState gameState), ());
+        MOCK_METHOD(void, UpdateGameState, (std::shared_ptr<const vector::sim::GameState> gameStatePtr), ());
+        MOCK_METHOD(void, UpdateGameStateDelta, (const vector::sim::GameStateDelta& gameStateDelta), ());
         MOCK_METHOD(void, RegisterCommandFunction, (std::function<bool (const std::string playerID, const vector::util::Command cmd)>), ());
 }; 
 
@@ -48,6 +56,58 @@ TEST(TestGameManager, TestSetGameType)
     EXPECT_EQ(vector::game::GAME_TYPE::DOGFIGHT, gameManager.GetGameType());
 }
 
+TEST(TestGameManager, TestSetTickRate)
+{
+    auto gameEnginePtr = std::make_unique<vector::sim::GameEngine>();
+    auto gameSettingsPtr = std::make_unique<MockGameSettings>();
+
+    vector::game::GameManager gameManager(std::move(gameEnginePtr), std::move(gameSettingsPtr));
+
+    // default tick rate
+    EXPECT_EQ(vector::game::DEFAULT_TICK_RATE_HZ, gameManager.GetTickRateHz());
+
+    // tick rates outside of Min and Max are rejected
+    EXPECT_FALSE(gameManager.SetTickRateHz(vector::game::MIN_TICK_RATE_HZ - 1));
+    EXPECT_FALSE(gameManager.SetTickRateHz(vector::game::MAX_TICK_RATE_HZ + 1));
+    EXPECT_EQ(vector::game::DEFAULT_TICK_RATE_HZ, gameManager.GetTickRateHz());
+
+    EXPECT_TRUE(gameManager.SetTickRateHz(60));
+    EXPECT_EQ(60, gameManager.GetTickRateHz());
+}
+
+TEST(TestGameManager, TestSetViewRange)
+{
+    auto gameEnginePtr = std::make_unique<vector::sim::GameEngine>();
+    auto gameSettingsPtr = std::make_unique<MockGameSettings>();
+
+    vector::game::GameManager gameManager(std::move(gameEnginePtr), std::move(gameSettingsPtr));
+
+    EXPECT_EQ(vector::sim::DEFAULT_VIEW_RANGE, gameManager.GetViewRange());
+
+    EXPECT_FALSE(gameManager.SetViewRange(-1.0));
+    EXPECT_EQ(vector::sim::DEFAULT_VIEW_RANGE, gameManager.GetViewRange());
+
+    EXPECT_TRUE(gameManager.SetViewRange(0.0));
+    EXPECT_EQ(0.0, gameManager.GetViewRange());
+}
+
+TEST(TestGameManager, TestMetricsDump)
+{
+    auto gameEnginePtr = std::make_unique<vector::sim::GameEngine>();
+    auto gameSettingsPtr = std::make_unique<MockGameSettings>();
+
+    vector::game::GameManager gameManager(std::move(gameEnginePtr), std::move(gameSettingsPtr));
+
+    // engine and game loop metrics are dumped together
+    std::string metricsJson = gameManager.GetMetricsJson();
+    EXPECT_EQ(0, metricsJson.find("{\"engine\":{\"ticks\":0,"));
+    EXPECT_NE(std::string::npos, metricsJson.find(",\"game\":{\"updates_sent\":0,"));
+
+    std::string metricsText = gameManager.GetMetricsText();
+    EXPECT_NE(std::string::npos, metricsText.find("engine.tick count=0 "));
+    EXPECT_NE(std::string::npos, metricsText.find("game.fan_out count=0 "));
+}
+
 TEST(TestGameManager, TestSetPlayerSlotsMin)
 {
     auto gameEnginePtr = std::make_unique<vector::sim::GameEngine>();
@@ -252,6 +312,105 @@ TEST(TestGameManager, TestStartGameGood)
     gameManager.Stop();
 }
 
+TEST(TestGameManager, TestRecordReplay)
+{
+    auto mockPlayerOne = std::make_shared<::testing::NiceMock<MockPlayer>>();
+    auto mockPlayerTwo = std::make_shared<::testing::NiceMock<MockPlayer>>();
+
+    ON_CALL(*mockPlayerOne, GetPlayerID()).WillByDefault(::testing::Return("nick"));
+    ON_CALL(*mockPlayerTwo, GetPlayerID()).WillByDefault(::testing::Return("mar"));
+    ON_CALL(*mockPlayerOne, GetTeamID()).WillByDefault(::testing::Return(1));
+    ON_CALL(*mockPlayerTwo, GetTeamID()).WillByDefault(::testing::Return(2));
+    ON_CALL(*mockPlayerOne, IsReady()).WillByDefault(::testing::Return(true));
+    ON_CALL(*mockPlayerTwo, IsReady()).WillByDefault(::testing::Return(true));
+
+    auto gameEnginePtr = std::make_unique<vector::sim::GameEngine>();
+    auto gameSettingsPtr = std::make_unique<MockGameSettings>();
+
+    vector::game::GameManager gameManager(std::move(gameEnginePtr), std::move(gameSettingsPtr));
+    gameManager.AddPlayer(mockPlayerOne);
+    gameManager.AddPlayer(mockPlayerTwo);
+    gameManager.SetGameType(vector::game::GAME_TYPE::DOGFIGHT);
+
+    const std::string path = testing::TempDir() + "TestGameManagerRecordReplay.vrl";
+    EXPECT_TRUE(gameManager.SetReplayPath(path));
+    EXPECT_EQ(path, gameManager.GetReplayPath());
+
+    ASSERT_TRUE(gameManager.Start());
+    EXPECT_FALSE(gameManager.SetReplayPath(""));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    gameManager.Stop();
+
+    // the log holds the whole game, and re-runs it exactly; stepped rather than run to the end, which would
+    // restore the last checkpoint, so every keyframe is checked against the re-run
+    vector::sim::ReplayPlayer player;
+    ASSERT_TRUE(player.Open(path));
+    EXPECT_LT(0, player.GetNumTicks());
+    EXPECT_LT(0, player.GetNumKeyframes());
+    EXPECT_EQ(player.GetNumKeyframes(), player.GetNumCheckpoints());
+    while(player.Step())
+    {
+    }
+    EXPECT_EQ(player.GetNumTicks(), player.GetTicksRun());
+    EXPECT_EQ(0, player.GetNumDivergences());
+}
+
+TEST(TestGameManager, TestRecordReplayCommandBeforeStart)
+{
+    auto mockPlayerOne = std::make_shared<::testing::NiceMock<MockPlayer>>();
+    auto mockPlayerTwo = std::make_shared<::testing::NiceMock<MockPlayer>>();
+
+    ON_CALL(*mockPlayerOne, GetPlayerID()).WillByDefault(::testing::Return("nick"));
+    ON_CALL(*mockPlayerTwo, GetPlayerID()).WillByDefault(::testing::Return("mar"));
+    ON_CALL(*mockPlayerOne, GetTeamID()).WillByDefault(::testing::Return(1));
+    ON_CALL(*mockPlayerTwo, GetTeamID()).WillByDefault(::testing::Return(2));
+    ON_CALL(*mockPlayerOne, IsReady()).WillByDefault(::testing::Return(true));
+    ON_CALL(*mockPlayerTwo, IsReady()).WillByDefault(::testing::Return(true));
+
+    std::function<bool (const std::string playerID, const vector::util::Command cmd)> commandFunction;
+    EXPECT_CALL(*mockPlayerOne, RegisterCommandFunction(::testing::_)).WillOnce(::testing::SaveArg<0>(&commandFunction));
+
+    vector::game::GameManager gameManager(std::make_unique<vector::sim::GameEngine>(), std::make_unique<MockGameSettings>());
+    gameManager.AddPlayer(mockPlayerOne);
+    gameManager.AddPlayer(mockPlayerTwo);
+    gameManager.SetGameType(vector::game::GAME_TYPE::DOGFIGHT);
+    gameManager.SetTickRateHz(vector::game::MAX_TICK_RATE_HZ);
+    ASSERT_TRUE(gameManager.SetUnitData(1, {vector::game::UnitData{"brot", vector::game::UNIT_TYPE::FIGHTER}}));
+    ASSERT_TRUE(gameManager.SetUnitData(2, {vector::game::UnitData{"marm", vector::game::UNIT_TYPE::FIGHTER}}));
+
+    const std::string path = testing::TempDir() + "TestGameManagerRecordReplayCommandBeforeStart.vrl";
+    ASSERT_TRUE(gameManager.SetReplayPath(path));
+
+    // applied to the engine at once, before the log or the first tick
+    vector::util::Command vectorCmd;
+    vectorCmd.command = vector::util::COMMAND_TYPE::VECTOR;
+    vectorCmd.subject = "brot";
+    vectorCmd.payload = vector::util::HeadingPayload{90};
+    ASSERT_TRUE(commandFunction != nullptr);
+    ASSERT_TRUE(commandFunction("nick", vectorCmd));
+
+    ASSERT_TRUE(gameManager.Start());
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    gameManager.Stop();
+
+    // the replayed fighter turns as the live one did, rather than flying on at its spawn heading
+    vector::sim::ReplayPlayer player;
+    ASSERT_TRUE(player.Open(path));
+    ASSERT_LT(vector::sim::REPLAY_KEYFRAME_INTERVAL, player.GetNumTicks());
+    while(player.GetTicksRun() < vector::sim::REPLAY_KEYFRAME_INTERVAL)
+    {
+        ASSERT_TRUE(player.Step());
+    }
+    std::shared_ptr<vector::sim::MoverInterface> brotPtr = player.GetGameEngine()->GetMover("brot");
+    ASSERT_NE(nullptr, brotPtr);
+    EXPECT_EQ(90, brotPtr->GetInertialData().curHeading);
+
+    while(player.Step())
+    {
+    }
+    EXPECT_EQ(0, player.GetNumDivergences());
+}
+
 TEST(TestGameManager, TestStartGameUnkGameType)
 {
     // default number of players is 2, create two mock players
@@ -340,4 +499,66 @@ TEST(TestGameManager, TestStartGamePlayersNotReady)
 
     // player two not ready, game cannot start
     EXPECT_FALSE(result);
-}
\ No newline at end of file
+}
+
+TEST(TestGameManager, TestStartHosted)
+{
+    auto mockPlayerOne = std::make_shared<::testing::NiceMock<MockPlayer>>();
+    auto mockPlayerTwo = std::make_shared<::testing::NiceMock<MockPlayer>>();
+
+    ON_CALL(*mockPlayerOne, GetPlayerID()).WillByDefault(::testing::Return("nick"));
+    ON_CALL(*mockPlayerTwo, GetPlayerID()).WillByDefault(::testing::Return("mar"));
+    ON_CALL(*mockPlayerOne, IsReady()).WillByDefault(::testing::Return(true));
+    ON_CALL(*mockPlayerTwo, IsReady()).WillByDefault(::testing::Return(true));
+
+    auto gameEnginePtr = std::make_unique<vector::sim::GameEngine>();
+    auto gameSettingsPtr = std::make_unique<MockGameSettings>();
+
+    vector::game::GameManager gameManager(std::move(gameEnginePtr), std::move(gameSettingsPtr));
+    gameManager.AddPlayer(mockPlayerOne);
+    gameManager.AddPlayer(mockPlayerTwo);
+    gameManager.SetGameType(vector::game::GAME_TYPE::DOGFIGHT);
+
+    // nothing to run before the game starts
+    EXPECT_EQ(std::chrono::steady_clock::time_point::max(), gameManager.RunDueTicks());
+
+    // the first tick is due at once, and runs on this thread, after which the next is due later
+    ASSERT_TRUE(gameManager.StartHosted());
+    EXPECT_FALSE(gameManager.Start());
+    EXPECT_LT(std::chrono::steady_clock::now(), gameManager.RunDueTicks());
+
+    gameManager.Stop();
+    EXPECT_EQ(std::chrono::steady_clock::time_point::max(), gameManager.RunDueTicks());
+}
+
+TEST(TestGameManager, TestGetSpawnData)
+{
+    // one unit, a full single line, and teams so large they form blocks of ranks
+    const size_t maxUnitsPerLine = static_cast<size_t>(vector::game::SPAWN_FRONT_WIDTH / vector::game::SPAWN_SPACING) + 1;
+    for(const size_t numUnits : {static_cast<size_t>(1), maxUnitsPerLine, static_cast<size_t>(400)})
+    {
+        std::vector<vector::sim::InertialData> spawns;
+        for(vector::sim::team_ID teamID = 1; teamID <= vector::game::MAX_NUM_PLAYERS; ++teamID)
+        {
+            for(size_t i = 0; i < numUnits; ++i)
+            {
+                const vector::sim::InertialData spawnData = vector::game::GameManager::GetSpawnData(teamID, i, numUnits);
+                EXPECT_GE(spawnData.xCoord, vector::sim::X_COORD_MIN);
+                EXPECT_LE(spawnData.xCoord, vector::sim::X_COORD_MAX);
+                EXPECT_GE(spawnData.yCoord, vector::sim::Y_COORD_MIN);
+                EXPECT_LE(spawnData.yCoord, vector::sim::Y_COORD_MAX);
+                spawns.push_back(spawnData);
+            }
+        }
+
+        // no two units of any team start close enough to collide
+        for(size_t i = 0; i < spawns.size(); ++i)
+        {
+            for(size_t j = i + 1; j < spawns.size(); ++j)
+            {
+                const double distance = std::hypot(spawns[i].xCoord - spawns[j].xCoord, spawns[i].yCoord - spawns[j].yCoord);
+                ASSERT_GT(distance, vector::sim::COLLISION_RADIUS) << numUnits << " units, " << i << " and " << j;
+            }
+        }
+    }
+}
@@ -0,0 +1,251 @@
+#include "gtest/gtest.h"
+#include "sim/GameState.h"
+#include "sim/GameStateBinaryDecoder.h"
+#include "sim/GameStateBinaryEncoder.h"
+#include "sim/SimConstants.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    void ExpectSameMovers(const vector::sim::GameState& expected, const vector::sim::GameState& actual, const double tolerance)
+    {
+        ASSERT_EQ(expected.moverList.size(), actual.moverList.size());
+
+        for(size_t i = 0; i < expected.moverList.size(); ++i)
+        {
+            EXPECT_EQ(expected.moverList.at(i).handle, actual.moverList.at(i).handle);
+            EXPECT_EQ(expected.moverList.at(i).ID, actual.moverList.at(i).ID);
+            EXPECT_EQ(expected.moverList.at(i).teamID, actual.moverList.at(i).teamID);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.curHeading, actual.moverList.at(i).inertialData.curHeading);
+            EXPECT_NEAR(expected.moverList.at(i).inertialData.curSpeed, actual.moverList.at(i).inertialData.curSpeed, tolerance);
+            EXPECT_NEAR(expected.moverList.at(i).inertialData.xCoord, actual.moverList.at(i).inertialData.xCoord, tolerance);
+            EXPECT_NEAR(expected.moverList.at(i).inertialData.yCoord, actual.moverList.at(i).inertialData.yCoord, tolerance);
+        }
+    }
+
+    vector::sim::MoverState MakeMoverState(const uint32_t index, const uint32_t generation, std::mt19937& random)
+    {
+        std::uniform_real_distribution<double> coordDistribution(-1000.0, vector::sim::X_COORD_MAX + 1000.0);
+        std::uniform_real_distribution<double> speedDistribution(0.0, vector::sim::SPEED_MAX);
+        std::uniform_int_distribution<int> headingDistribution(vector::sim::HEADING_MIN, vector::sim::HEADING_MAX);
+        std::uniform_int_distribution<int> lengthDistribution(0, 12);
+
+        vector::sim::MoverState moverState;
+        moverState.handle = vector::sim::MoverHandle{index, generation};
+        moverState.ID = std::string(lengthDistribution(random), 'a' + index % 26) + std::to_string(index);
+        moverState.teamID = static_cast<vector::sim::team_ID>(index % 4);
+        moverState.inertialData.curHeading = static_cast<vector::sim::angle>(headingDistribution(random));
+        moverState.inertialData.curSpeed = speedDistribution(random);
+        moverState.inertialData.xCoord = coordDistribution(random);
+        moverState.inertialData.yCoord = coordDistribution(random);
+        return moverState;
+    }
+
+    /**
+     * @brief Evolve a GameState as a game would: Movers move, some are removed, and new ones take
+     * free indices with a new generation
+     *
+     */
+    void Evolve(vector::sim::GameState& gameState, std::vector<uint32_t>& generations, std::mt19937& random)
+    {
+        std::bernoulli_distribution removeDistribution(0.1);
+        std::bernoulli_distribution addDistribution(0.2);
+
+        std::vector<vector::sim::MoverState> next;
+        size_t moverIndex = 0;
+        for(uint32_t index = 0; index < generations.size(); ++index)
+        {
+            const bool occupied = moverIndex < gameState.moverList.size() && gameState.moverList[moverIndex].handle.index == index;
+            if(occupied)
+            {
+                vector::sim::MoverState moverState = gameState.moverList[moverIndex++];
+                if(removeDistribution(random))
+                {
+                    ++generations[index];
+                    continue;
+                }
+                moverState.inertialData = MakeMoverState(index, 0, random).inertialData;
+                next.push_back(moverState);
+            }
+            else if(addDistribution(random))
+            {
+                next.push_back(MakeMoverState(index, generations[index], random));
+            }
+        }
+        gameState.moverList.swap(next);
+    }
+
+    TEST(TestGameStateBinaryCodec, TestRoundTrip)
+    {
+        std::mt19937 random(1);
+        vector::sim::GameState gameState;
+        for(uint32_t i = 0; i < 20; ++i)
+        {
+            gameState.moverList.push_back(MakeMoverState(i, 0, random));
+        }
+
+        vector::sim::GameStateBinaryEncoder encoder(false);
+        vector::sim::GameStateBinaryDecoder decoder;
+        std::vector<uint8_t> buffer(encoder.GetMaxEncodedSize(gameState));
+
+        const size_t firstSize = encoder.Encode(gameState, buffer.data(), buffer.size());
+        EXPECT_EQ(buffer.size(), firstSize);
+
+        vector::sim::GameState decoded;
+        ASSERT_TRUE(decoder.Decode(buffer.data(), firstSize, decoded));
+        ExpectSameMovers(gameState, decoded, 0.0);
+
+        // IDs are only sent once
+        gameState.moverList.at(3).inertialData.xCoord += 100.0;
+        const size_t secondSize = encoder.Encode(gameState, buffer.data(), buffer.size());
+        EXPECT_EQ(vector::sim::GAME_STATE_CODEC_HEADER_SIZE + gameState.moverList.size() * vector::sim::GAME_STATE_CODEC_MOVER_SIZE, secondSize);
+
+        ASSERT_TRUE(decoder.Decode(buffer.data(), secondSize, decoded));
+        ExpectSameMovers(gameState, decoded, 0.0);
+    }
+
+    TEST(TestGameStateBinaryCodec, TestLittleEndianHeader)
+    {
+        vector::sim::GameState gameState;
+        vector::sim::GameStateBinaryEncoder encoder(true);
+        std::vector<uint8_t> buffer(encoder.GetMaxEncodedSize(gameState));
+
+        ASSERT_EQ(vector::sim::GAME_STATE_CODEC_HEADER_SIZE, encoder.Encode(gameState, buffer.data(), buffer.size()));
+        EXPECT_EQ(vector::sim::GAME_STATE_CODEC_MAGIC & 0xFF, buffer.at(0));
+        EXPECT_EQ(vector::sim::GAME_STATE_CODEC_MAGIC >> 8, buffer.at(1));
+        EXPECT_EQ(vector::sim::GAME_STATE_CODEC_VERSION, buffer.at(2));
+        EXPECT_EQ(vector::sim::GAME_STATE_CODEC_FLAG_QUANTIZED | vector::sim::GAME_STATE_CODEC_FLAG_RESET_IDS, buffer.at(3));
+    }
+
+    TEST(TestGameStateBinaryCodec, TestQuantized)
+    {
+        std::mt19937 random(2);
+        vector::sim::GameState gameState;
+        for(uint32_t i = 0; i < 20; ++i)
+        {
+            gameState.moverList.push_back(MakeMoverState(i, 0, random));
+        }
+
+        vector::sim::GameStateBinaryEncoder encoder(true);
+        vector::sim::GameStateBinaryDecoder decoder;
+        std::vector<uint8_t> buffer(encoder.GetMaxEncodedSize(gameState));
+
+        const size_t size = encoder.Encode(gameState, buffer.data(), buffer.size());
+        ASSERT_NE(0, size);
+
+        vector::sim::GameState decoded;
+        ASSERT_TRUE(decoder.Decode(buffer.data(), size, decoded));
+        ExpectSameMovers(gameState, decoded, vector::sim::GAME_STATE_SPEED_QUANTUM / 2 + 1e-9);
+
+        // speeds out of the field's range are clamped rather than wrapped
+        gameState.moverList.at(0).inertialData.curSpeed = 1e9;
+        const size_t clampedSize = encoder.Encode(gameState, buffer.data(), buffer.size());
+        ASSERT_TRUE(decoder.Decode(buffer.data(), clampedSize, decoded));
+        EXPECT_NEAR(UINT16_MAX * vector::sim::GAME_STATE_SPEED_QUANTUM, decoded.moverList.at(0).inertialData.curSpeed, 1e-6);
+    }
+
+    TEST(TestGameStateBinaryCodec, TestBufferTooSmall)
+    {
+        std::mt19937 random(3);
+        vector::sim::GameState gameState;
+        for(uint32_t i = 0; i < 5; ++i)
+        {
+            gameState.moverList.push_back(MakeMoverState(i, 0, random));
+        }
+
+        vector::sim::GameStateBinaryEncoder encoder(false);
+        std::vector<uint8_t> buffer(encoder.GetMaxEncodedSize(gameState));
+
+        EXPECT_EQ(0, encoder.Encode(gameState, buffer.data(), buffer.size() - 1));
+
+        // the IDs of a message that did not fit are still to be sent
+        vector::sim::GameStateBinaryDecoder decoder;
+        vector::sim::GameState decoded;
+        const size_t size = encoder.Encode(gameState, buffer.data(), buffer.size());
+        ASSERT_EQ(buffer.size(), size);
+        ASSERT_TRUE(decoder.Decode(buffer.data(), size, decoded));
+        ExpectSameMovers(gameState, decoded, 0.0);
+    }
+
+    TEST(TestGameStateBinaryCodec, TestRejectsBadMessages)
+    {
+        std::mt19937 random(4);
+        vector::sim::GameState gameState;
+        for(uint32_t i = 0; i < 5; ++i)
+        {
+            gameState.moverList.push_back(MakeMoverState(i, 0, random));
+        }
+
+        vector::sim::GameStateBinaryEncoder encoder(false);
+        std::vector<uint8_t> buffer(encoder.GetMaxEncodedSize(gameState));
+        const size_t size = encoder.Encode(gameState, buffer.data(), buffer.size());
+        ASSERT_NE(0, size);
+
+        // every truncation is rejected, and leaves the caller's state alone
+        vector::sim::GameState decoded;
+        decoded.moverList.push_back(gameState.moverList.at(0));
+        for(size_t truncated = 0; truncated < size; ++truncated)
+        {
+            vector::sim::GameStateBinaryDecoder decoder;
+            EXPECT_FALSE(decoder.Decode(buffer.data(), truncated, decoded));
+            EXPECT_EQ(1, decoded.moverList.size());
+        }
+
+        // another version
+        std::vector<uint8_t> otherVersion(buffer.begin(), buffer.begin() + size);
+        otherVersion.at(2) = vector::sim::GAME_STATE_CODEC_VERSION + 1;
+        vector::sim::GameStateBinaryDecoder decoder;
+        EXPECT_FALSE(decoder.Decode(otherVersion.data(), otherVersion.size(), decoded));
+
+        // a receiver that missed the message carrying the IDs cannot decode later ones until the encoder resets
+        const size_t laterSize = encoder.Encode(gameState, buffer.data(), buffer.size());
+        EXPECT_FALSE(decoder.Decode(buffer.data(), laterSize, decoded));
+
+        encoder.Reset();
+        const size_t resetSize = encoder.Encode(gameState, buffer.data(), buffer.size());
+        ASSERT_TRUE(decoder.Decode(buffer.data(), resetSize, decoded));
+        ExpectSameMovers(gameState, decoded, 0.0);
+    }
+
+    TEST(TestGameStateBinaryCodec, TestFuzzRoundTrip)
+    {
+        std::mt19937 random(5);
+        std::vector<uint32_t> generations(64, 0);
+        vector::sim::GameState gameState;
+
+        for(const bool quantize : {false, true})
+        {
+            vector::sim::GameStateBinaryEncoder encoder(quantize);
+            vector::sim::GameStateBinaryDecoder decoder;
+            vector::sim::GameState decoded;
+            std::vector<uint8_t> buffer;
+            const double tolerance = quantize ? vector::sim::GAME_STATE_SPEED_QUANTUM / 2 + 1e-9 : 0.0;
+
+            for(int round = 0; round < 200; ++round)
+            {
+                Evolve(gameState, generations, random);
+
+                buffer.resize(encoder.GetMaxEncodedSize(gameState));
+                const size_t size = encoder.Encode(gameState, buffer.data(), buffer.size());
+                ASSERT_NE(0, size);
+                ASSERT_TRUE(decoder.Decode(buffer.data(), size, decoded));
+                ExpectSameMovers(gameState, decoded, tolerance);
+
+                // corrupted copies are decoded or rejected, never read past their end; a separate decoder keeps
+                // the corruption out of the stream's string table
+                std::vector<uint8_t> corrupted(buffer.begin(), buffer.begin() + size);
+                std::uniform_int_distribution<size_t> positionDistribution(0, size - 1);
+                for(int flip = 0; flip < 4; ++flip)
+                {
+                    corrupted.at(positionDistribution(random)) ^= static_cast<uint8_t>(1 + random() % 255);
+                }
+                vector::sim::GameStateBinaryDecoder corruptedDecoder;
+                vector::sim::GameState corruptedState;
+                corruptedDecoder.Decode(corrupted.data(), corrupted.size(), corruptedState);
+            }
+        }
+    }
+} // namespace
@@ -0,0 +1,162 @@
+#include "gtest/gtest.h"
+#include "sim/GameEngine.h"
+#include "sim/GameState.h"
+#include "sim/GameStateDelta.h"
+#include "sim/GameStateDeltaDecoder.h"
+#include "sim/GameStateDeltaEncoder.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+
+#include <memory>
+#include <string>
+
+namespace
+{
+    void ExpectSameGameState(const vector::sim::GameState& expected, const vector::sim::GameState& actual)
+    {
+        ASSERT_EQ(expected.moverList.size(), actual.moverList.size());
+
+        for(size_t i = 0; i < expected.moverList.size(); ++i)
+        {
+            EXPECT_EQ(expected.moverList.at(i).handle, actual.moverList.at(i).handle);
+            EXPECT_EQ(expected.moverList.at(i).ID, actual.moverList.at(i).ID);
+            EXPECT_EQ(expected.moverList.at(i).teamID, actual.moverList.at(i).teamID);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.curHeading, actual.moverList.at(i).inertialData.curHeading);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.curSpeed, actual.moverList.at(i).inertialData.curSpeed);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.xCoord, actual.moverList.at(i).inertialData.xCoord);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.yCoord, actual.moverList.at(i).inertialData.yCoord);
+        }
+    }
+
+    vector::sim::MoverHandle AddFighter(vector::sim::GameEngine& engine, const std::string& ID, const vector::sim::InertialData& initialPos)
+    {
+        vector::sim::MoverParams perfValues;
+        vector::sim::MoverHandle handle = engine.AddFighter(ID, 1, perfValues);
+        EXPECT_TRUE(engine.GetMover(handle)->SetInitialInertialData(initialPos));
+        return handle;
+    }
+
+    TEST(TestGameStateDelta, TestReconstructionMatchesSnapshot)
+    {
+        vector::sim::GameEngine engine;
+        vector::sim::GameStateDeltaEncoder encoder(10);
+        vector::sim::GameStateDeltaDecoder decoder;
+
+        // fighters circling mid-arena, flying out of the arena, and accelerating from a standstill
+        for(int i = 0; i < 30; ++i)
+        {
+            vector::sim::InertialData initialPos;
+            initialPos.curHeading = (i * 37) % vector::sim::HEADING_FULL_CIRCLE;
+            initialPos.curSpeed = (i % 3 == 0) ? 0.0 : vector::sim::FIGHTER_SPEED_MAX;
+            initialPos.xCoord = (i % 5 == 0) ? vector::sim::X_COORD_MAX - 1 : vector::sim::X_COORD_MAX / 2;
+            initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+
+            vector::sim::MoverHandle handle = AddFighter(engine, "brot" + std::to_string(i), initialPos);
+            if(i % 5 == 0)
+            {
+                engine.GetMover(handle)->SetNewHeading(90);
+            }
+            else if(i % 3 != 0)
+            {
+                engine.GetMover(handle)->SetNewHeading((initialPos.curHeading + 180) % vector::sim::HEADING_FULL_CIRCLE);
+            }
+        }
+
+        for(int tick = 0; tick < 40; ++tick)
+        {
+            // new fighters join part way through, reusing the handle indices of removed ones
+            if(tick == 5 || tick == 23)
+            {
+                vector::sim::InertialData initialPos;
+                initialPos.xCoord = vector::sim::X_COORD_MAX / 4;
+                initialPos.yCoord = vector::sim::Y_COORD_MAX / 4;
+                AddFighter(engine, "marm" + std::to_string(tick), initialPos);
+            }
+
+            engine.Tick();
+
+            std::shared_ptr<const vector::sim::GameState> snapshot = engine.GetGameStateSnapshot();
+            vector::sim::GameStateDelta delta = encoder.Encode(snapshot);
+
+            EXPECT_EQ(tick % 10 == 0, delta.keyframe);
+            ASSERT_TRUE(decoder.Apply(delta));
+            EXPECT_EQ(delta.sequence, decoder.GetSequence());
+            ExpectSameGameState(*snapshot, decoder.GetGameState());
+        }
+    }
+
+    TEST(TestGameStateDelta, TestOnlyChangedFieldsAreSent)
+    {
+        vector::sim::GameEngine engine;
+        vector::sim::GameStateDeltaEncoder encoder(100);
+
+        // both fighters fly straight at full speed
+        vector::sim::InertialData northPos;
+        northPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+        northPos.xCoord = vector::sim::X_COORD_MAX / 2;
+        northPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+        vector::sim::MoverHandle northHandle = AddFighter(engine, "brot", northPos);
+
+        vector::sim::InertialData eastPos = northPos;
+        eastPos.curHeading = 90;
+        eastPos.xCoord += 5000.0;
+        vector::sim::MoverHandle eastHandle = AddFighter(engine, "marm", eastPos);
+
+        engine.Tick();
+        EXPECT_TRUE(encoder.Encode(engine.GetGameStateSnapshot()).keyframe);
+
+        // flying north only changes the y coordinate, flying east only the x coordinate
+        engine.Tick();
+        vector::sim::GameStateDelta delta = encoder.Encode(engine.GetGameStateSnapshot());
+        EXPECT_FALSE(delta.keyframe);
+        EXPECT_TRUE(delta.added.empty());
+        EXPECT_TRUE(delta.removed.empty());
+        ASSERT_EQ(2, delta.changed.size());
+        EXPECT_EQ(northHandle, delta.changed.at(0).handle);
+        EXPECT_EQ(vector::sim::MOVER_FIELD_Y_COORD, delta.changed.at(0).changedFields);
+        EXPECT_EQ(eastHandle, delta.changed.at(1).handle);
+        EXPECT_EQ(vector::sim::MOVER_FIELD_X_COORD, delta.changed.at(1).changedFields);
+    }
+
+    TEST(TestGameStateDelta, TestDecoderNeedsKeyframe)
+    {
+        vector::sim::GameEngine engine;
+        vector::sim::GameStateDeltaEncoder encoder(100);
+        vector::sim::GameStateDeltaDecoder decoder;
+
+        vector::sim::InertialData initialPos;
+        initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+        initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+        initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+        AddFighter(engine, "brot", initialPos);
+
+        engine.Tick();
+        vector::sim::GameStateDelta keyframe = encoder.Encode(engine.GetGameStateSnapshot());
+        engine.Tick();
+        vector::sim::GameStateDelta first = encoder.Encode(engine.GetGameStateSnapshot());
+        engine.Tick();
+        vector::sim::GameStateDelta second = encoder.Encode(engine.GetGameStateSnapshot());
+
+        // nothing can be applied before a keyframe
+        EXPECT_FALSE(decoder.Apply(first));
+        EXPECT_FALSE(decoder.IsSynchronised());
+
+        EXPECT_TRUE(decoder.Apply(keyframe));
+        EXPECT_TRUE(decoder.IsSynchronised());
+
+        // a skipped delta is rejected and the reconstructed state is left as it was
+        vector::sim::GameState beforeSkip = decoder.GetGameState();
+        EXPECT_FALSE(decoder.Apply(second));
+        ExpectSameGameState(beforeSkip, decoder.GetGameState());
+        EXPECT_EQ(keyframe.sequence, decoder.GetSequence());
+
+        // until the encoder is asked for a fresh keyframe
+        encoder.RequestKeyframe();
+        engine.Tick();
+        std::shared_ptr<const vector::sim::GameState> snapshot = engine.GetGameStateSnapshot();
+        vector::sim::GameStateDelta recovery = encoder.Encode(snapshot);
+        EXPECT_TRUE(recovery.keyframe);
+        EXPECT_TRUE(decoder.Apply(recovery));
+        ExpectSameGameState(*snapshot, decoder.GetGameState());
+    }
+} // namespace
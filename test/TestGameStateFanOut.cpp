@@ -0,0 +1,311 @@
+#include "gtest/gtest.h"
+
+#include "game/GameStateFanOut.h"
+#include "game/PlayerInterface.h"
+#include "sim/GameState.h"
+#include "sim/GameStateDelta.h"
+#include "sim/GameStateDeltaDecoder.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Player that records the updates it receives, and can be held up to lag behind
+     *
+     */
+    class RecordingPlayer : public vector::game::PlayerInterface
+    {
+        public:
+            explicit RecordingPlayer(const vector::sim::team_ID teamID = 1)
+                : m_TeamID(teamID)
+            {
+            }
+
+            std::string GetPlayerID() const override
+            {
+                return "nick";
+            }
+
+            vector::sim::team_ID GetTeamID() const override
+            {
+                return m_TeamID;
+            }
+
+            bool IsReady() const override
+            {
+                return true;
+            }
+
+            void UpdateGameState(std::shared_ptr<const vector::sim::GameState> gameStatePtr) override
+            {
+                WaitUntilReleased();
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                m_GameStates.push_back(std::move(gameStatePtr));
+            }
+
+            void UpdateGameStateDelta(const vector::sim::GameStateDelta& gameStateDelta) override
+            {
+                WaitUntilReleased();
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                m_Deltas.push_back(gameStateDelta);
+            }
+
+            void RegisterCommandFunction(std::function<bool (const std::string playerID, const vector::util::Command cmd)>) override
+            {
+            }
+
+            void SetDelay(const std::chrono::milliseconds delay)
+            {
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                m_Delay = delay;
+            }
+
+            void Hold()
+            {
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                m_Held = true;
+            }
+
+            void Release()
+            {
+                {
+                    std::scoped_lock<std::mutex> lock(m_Mutex);
+                    m_Held = false;
+                }
+                m_ReleaseCondition.notify_all();
+            }
+
+            std::vector<std::shared_ptr<const vector::sim::GameState>> GetGameStates()
+            {
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                return m_GameStates;
+            }
+
+            std::vector<vector::sim::GameStateDelta> GetDeltas()
+            {
+                std::scoped_lock<std::mutex> lock(m_Mutex);
+                return m_Deltas;
+            }
+
+        private:
+            void WaitUntilReleased()
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_ReleaseCondition.wait(lock, [this]{ return !m_Held; });
+                if(m_Delay.count() > 0)
+                {
+                    lock.unlock();
+                    std::this_thread::sleep_for(m_Delay);
+                }
+            }
+
+            vector::sim::team_ID m_TeamID;
+            std::mutex m_Mutex;
+            std::condition_variable m_ReleaseCondition;
+            bool m_Held{false};
+            std::chrono::milliseconds m_Delay{0};
+            std::vector<std::shared_ptr<const vector::sim::GameState>> m_GameStates;
+            std::vector<vector::sim::GameStateDelta> m_Deltas;
+    };
+
+    std::shared_ptr<const vector::sim::GameState> MakeGameState(const size_t numMovers, const double xCoord)
+    {
+        auto gameStatePtr = std::make_shared<vector::sim::GameState>();
+        for(size_t i = 0; i < numMovers; ++i)
+        {
+            vector::sim::MoverState moverState;
+            moverState.handle = vector::sim::MoverHandle{static_cast<uint32_t>(i), 0};
+            moverState.ID = "brot" + std::to_string(i);
+            moverState.teamID = 1;
+            moverState.inertialData.xCoord = xCoord + static_cast<double>(i);
+            gameStatePtr->moverList.push_back(moverState);
+        }
+        return gameStatePtr;
+    }
+} // namespace
+
+TEST(TestGameStateFanOut, TestEveryPlayerSharesEverySnapshot)
+{
+    std::atomic<uint64_t> updatesSent{0};
+    std::atomic<uint64_t> updatesCoalesced{0};
+    vector::game::GameStateFanOut fanOut(2, 4, vector::game::GAME_STATE_UPDATE_MODE::FULL, updatesSent, updatesCoalesced);
+
+    auto playerOnePtr = std::make_shared<RecordingPlayer>();
+    auto playerTwoPtr = std::make_shared<RecordingPlayer>();
+    fanOut.AddPlayer(playerOnePtr);
+    fanOut.AddPlayer(playerTwoPtr);
+
+    std::vector<std::shared_ptr<const vector::sim::GameState>> published;
+    for(int i = 0; i < 10; ++i)
+    {
+        published.push_back(MakeGameState(3, i * 100.0));
+        fanOut.Publish(published.back());
+        fanOut.Flush();
+    }
+
+    // players that keep up get every snapshot, in order, and the very same snapshot rather than a copy
+    for(auto playerPtr : {playerOnePtr, playerTwoPtr})
+    {
+        std::vector<std::shared_ptr<const vector::sim::GameState>> received = playerPtr->GetGameStates();
+        ASSERT_EQ(published.size(), received.size());
+        for(size_t i = 0; i < published.size(); ++i)
+        {
+            EXPECT_EQ(published[i].get(), received[i].get());
+        }
+    }
+    EXPECT_EQ(20, updatesSent);
+    EXPECT_EQ(0, updatesCoalesced);
+}
+
+TEST(TestGameStateFanOut, TestPlayersReceiveTheirTeamsView)
+{
+    std::atomic<uint64_t> updatesSent{0};
+    std::atomic<uint64_t> updatesCoalesced{0};
+    vector::game::GameStateFanOut fanOut(2, 4, vector::game::GAME_STATE_UPDATE_MODE::FULL, updatesSent, updatesCoalesced);
+
+    auto teamOnePlayerPtr = std::make_shared<RecordingPlayer>(1);
+    auto teamOneWingmanPtr = std::make_shared<RecordingPlayer>(1);
+    auto teamTwoPlayerPtr = std::make_shared<RecordingPlayer>(2);
+    auto teamThreePlayerPtr = std::make_shared<RecordingPlayer>(3);
+    fanOut.AddPlayer(teamOnePlayerPtr);
+    fanOut.AddPlayer(teamOneWingmanPtr);
+    fanOut.AddPlayer(teamTwoPlayerPtr);
+    fanOut.AddPlayer(teamThreePlayerPtr);
+
+    // no view for team 3
+    std::vector<std::shared_ptr<const vector::sim::GameState>> teamStatePtrs(3);
+    teamStatePtrs[1] = MakeGameState(2, 0.0);
+    teamStatePtrs[2] = MakeGameState(3, 0.0);
+    fanOut.Publish(teamStatePtrs);
+    fanOut.Flush();
+
+    // the players of a team share the team's view
+    ASSERT_EQ(1, teamOnePlayerPtr->GetGameStates().size());
+    EXPECT_EQ(teamStatePtrs[1], teamOnePlayerPtr->GetGameStates().at(0));
+    ASSERT_EQ(1, teamOneWingmanPtr->GetGameStates().size());
+    EXPECT_EQ(teamStatePtrs[1], teamOneWingmanPtr->GetGameStates().at(0));
+    ASSERT_EQ(1, teamTwoPlayerPtr->GetGameStates().size());
+    EXPECT_EQ(teamStatePtrs[2], teamTwoPlayerPtr->GetGameStates().at(0));
+
+    // a team without a view still gets an update, with nothing in it
+    ASSERT_EQ(1, teamThreePlayerPtr->GetGameStates().size());
+    EXPECT_TRUE(teamThreePlayerPtr->GetGameStates().at(0)->moverList.empty());
+    EXPECT_EQ(4, updatesSent);
+}
+
+TEST(TestGameStateFanOut, TestSlowPlayerIsCoalesced)
+{
+    constexpr size_t QUEUE_DEPTH = 4;
+    std::atomic<uint64_t> updatesSent{0};
+    std::atomic<uint64_t> updatesCoalesced{0};
+    vector::game::GameStateFanOut fanOut(2, QUEUE_DEPTH, vector::game::GAME_STATE_UPDATE_MODE::FULL, updatesSent, updatesCoalesced);
+
+    auto slowPlayerPtr = std::make_shared<RecordingPlayer>();
+    auto fastPlayerPtr = std::make_shared<RecordingPlayer>();
+    fanOut.AddPlayer(slowPlayerPtr);
+    fanOut.AddPlayer(fastPlayerPtr);
+
+    // the slow player's sender is stuck on the first update, publishing carries on regardless
+    slowPlayerPtr->Hold();
+    std::vector<std::shared_ptr<const vector::sim::GameState>> published;
+    for(int i = 0; i < 20; ++i)
+    {
+        published.push_back(MakeGameState(1, i * 100.0));
+        fanOut.Publish(published.back());
+    }
+
+    // the other sender serves the fast player meanwhile
+    while(fastPlayerPtr->GetGameStates().empty() || fastPlayerPtr->GetGameStates().back() != published.back())
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(slowPlayerPtr->GetGameStates().empty());
+
+    slowPlayerPtr->Release();
+    fanOut.Flush();
+
+    // the slow player got whatever it was stuck on, then a queue's worth at most, ending with the latest
+    std::vector<std::shared_ptr<const vector::sim::GameState>> received = slowPlayerPtr->GetGameStates();
+    ASSERT_GE(received.size(), 2);
+    EXPECT_LE(received.size(), QUEUE_DEPTH + 1);
+    EXPECT_EQ(published.back().get(), received.back().get());
+    EXPECT_EQ(published.size() * 2, updatesSent + updatesCoalesced);
+    EXPECT_GT(updatesCoalesced, 0);
+}
+
+TEST(TestGameStateFanOut, TestSlowPlayersDoNotStarveOthers)
+{
+    std::atomic<uint64_t> updatesSent{0};
+    std::atomic<uint64_t> updatesCoalesced{0};
+    vector::game::GameStateFanOut fanOut(2, 4, vector::game::GAME_STATE_UPDATE_MODE::FULL, updatesSent, updatesCoalesced);
+
+    // as many slow players as senders, each always with another update waiting
+    auto slowPlayerOnePtr = std::make_shared<RecordingPlayer>();
+    auto slowPlayerTwoPtr = std::make_shared<RecordingPlayer>();
+    auto fastPlayerPtr = std::make_shared<RecordingPlayer>();
+    slowPlayerOnePtr->SetDelay(std::chrono::milliseconds(20));
+    slowPlayerTwoPtr->SetDelay(std::chrono::milliseconds(20));
+    fanOut.AddPlayer(slowPlayerOnePtr);
+    fanOut.AddPlayer(slowPlayerTwoPtr);
+    fanOut.AddPlayer(fastPlayerPtr);
+
+    std::shared_ptr<const vector::sim::GameState> gameStatePtr = MakeGameState(1, 0.0);
+    for(int i = 0; i < 50; ++i)
+    {
+        fanOut.Publish(gameStatePtr);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // the fast player is served while the slow players still have updates pending
+    EXPECT_FALSE(fastPlayerPtr->GetGameStates().empty());
+    EXPECT_FALSE(slowPlayerOnePtr->GetGameStates().empty());
+    EXPECT_FALSE(slowPlayerTwoPtr->GetGameStates().empty());
+
+    fanOut.Flush();
+    EXPECT_EQ(150, updatesSent + updatesCoalesced);
+}
+
+TEST(TestGameStateFanOut, TestCoalescedDeltasStillReconstruct)
+{
+    std::atomic<uint64_t> updatesSent{0};
+    std::atomic<uint64_t> updatesCoalesced{0};
+    vector::game::GameStateFanOut fanOut(1, 2, vector::game::GAME_STATE_UPDATE_MODE::DELTA, updatesSent, updatesCoalesced);
+
+    auto playerPtr = std::make_shared<RecordingPlayer>();
+    fanOut.AddPlayer(playerPtr);
+
+    playerPtr->Hold();
+    for(size_t i = 1; i <= 12; ++i)
+    {
+        // Movers come and go, and move, between snapshots
+        fanOut.Publish(MakeGameState(i % 5 + 1, static_cast<double>(i) * 100.0));
+    }
+    std::shared_ptr<const vector::sim::GameState> latestPtr = MakeGameState(4, 5000.0);
+    fanOut.Publish(latestPtr);
+    playerPtr->Release();
+    fanOut.Flush();
+    EXPECT_GT(updatesCoalesced, 0);
+
+    // each delta is encoded against what the player last received, so skipped snapshots do not break the chain
+    vector::sim::GameStateDeltaDecoder decoder;
+    for(const auto& delta : playerPtr->GetDeltas())
+    {
+        EXPECT_TRUE(decoder.Apply(delta));
+    }
+
+    const vector::sim::GameState& reconstructed = decoder.GetGameState();
+    ASSERT_EQ(latestPtr->moverList.size(), reconstructed.moverList.size());
+    for(size_t i = 0; i < latestPtr->moverList.size(); ++i)
+    {
+        EXPECT_EQ(latestPtr->moverList[i].handle, reconstructed.moverList[i].handle);
+        EXPECT_EQ(latestPtr->moverList[i].inertialData.xCoord, reconstructed.moverList[i].inertialData.xCoord);
+    }
+}
@@ -0,0 +1,152 @@
+#include "gtest/gtest.h"
+
+#include "game/GameConstants.h"
+#include "game/GameTypes.h"
+#include "game/HeadlessMatch.h"
+#include "game/MatchResult.h"
+#include "game/ScriptedCommand.h"
+#include "sim/GameEngine.h"
+#include "sim/InertialData.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<vector::game::UnitData> MakeUnits(const std::vector<std::string>& callsigns)
+    {
+        std::vector<vector::game::UnitData> unitData;
+        for(const auto& callsign : callsigns)
+        {
+            unitData.push_back(vector::game::UnitData{callsign, vector::game::UNIT_TYPE::FIGHTER});
+        }
+        return unitData;
+    }
+
+    vector::game::ScriptedCommand MakeScriptedCommand(const uint64_t tick, const vector::sim::team_ID teamID,
+                                                        const vector::util::COMMAND_TYPE command, const std::string& subject,
+                                                        const std::string& target)
+    {
+        vector::game::ScriptedCommand scriptedCommand;
+        scriptedCommand.tick = tick;
+        scriptedCommand.teamID = teamID;
+        scriptedCommand.cmd.command = command;
+        scriptedCommand.cmd.subject = subject;
+        scriptedCommand.cmd.payload = vector::util::TargetPayload{target};
+        return scriptedCommand;
+    }
+
+    TEST(TestHeadlessMatch, TestSetUnitData)
+    {
+        vector::game::HeadlessMatch match(std::make_unique<vector::sim::GameEngine>());
+
+        EXPECT_FALSE(match.SetUnitData(vector::sim::UNK_TEAM_ID, MakeUnits({"brot"})));
+        std::vector<vector::game::UnitData> unknownUnits = MakeUnits({"brot"});
+        unknownUnits.front().unitType = vector::game::UNIT_TYPE::UNK;
+        EXPECT_FALSE(match.SetUnitData(1, unknownUnits));
+
+        // a team past the last spawn bearing would spawn on top of another team
+        EXPECT_FALSE(match.SetUnitData(vector::game::MAX_NUM_PLAYERS + 1, MakeUnits({"brot"})));
+        EXPECT_FALSE(match.SetUnitData(UINT8_MAX, MakeUnits({"brot"})));
+
+        EXPECT_TRUE(match.SetUnitData(1, MakeUnits({"brot", "gnar"})));
+        EXPECT_FALSE(match.SetUnitData(1, MakeUnits({"marm"})));
+        EXPECT_EQ(2, match.GetGameEngine().GetGameState().moverList.size());
+
+        // a single team is never decided, and runs every tick asked for
+        vector::game::MatchResult result = match.Run(5);
+        EXPECT_EQ(5, result.ticksRun);
+        EXPECT_FALSE(result.decided);
+        EXPECT_EQ(2, result.survivors.at(1));
+        EXPECT_GT(result.ticksPerSecond, 0.0);
+
+        // units cannot join once the match has run
+        EXPECT_FALSE(match.SetUnitData(2, MakeUnits({"marm"})));
+    }
+
+    TEST(TestHeadlessMatch, TestRunToWin)
+    {
+        vector::game::HeadlessMatch match(std::make_unique<vector::sim::GameEngine>());
+        ASSERT_TRUE(match.SetUnitData(1, MakeUnits({"brot"})));
+        ASSERT_TRUE(match.SetUnitData(2, MakeUnits({"marm"})));
+
+        // added out of order, applied in order of tick once the fighters have closed to radar range
+        match.AddScriptedCommand(MakeScriptedCommand(101, 1, vector::util::COMMAND_TYPE::LAUNCH, "brot", "marm"));
+        match.AddScriptedCommand(MakeScriptedCommand(100, 1, vector::util::COMMAND_TYPE::AQUIRE, "brot", "marm"));
+        // marm is not on team 1, and nothing is locked for the launch before the lock
+        match.AddScriptedCommand(MakeScriptedCommand(100, 1, vector::util::COMMAND_TYPE::AQUIRE, "marm", "brot"));
+        match.AddScriptedCommand(MakeScriptedCommand(99, 1, vector::util::COMMAND_TYPE::LAUNCH, "brot", "marm"));
+
+        // not yet decided, and the match carries on from where it stopped
+        vector::game::MatchResult result = match.Run(10);
+        EXPECT_EQ(10, result.ticksRun);
+        EXPECT_FALSE(result.decided);
+        EXPECT_EQ(vector::sim::UNK_TEAM_ID, result.winningTeamID);
+        EXPECT_EQ(UINT64_MAX, result.firstKillTick);
+
+        result = match.Run(1000);
+        EXPECT_TRUE(result.decided);
+        EXPECT_LT(result.ticksRun, 1000);
+        EXPECT_EQ(1, result.winningTeamID);
+        ASSERT_EQ(3, result.survivors.size());
+        EXPECT_EQ(1, result.survivors.at(1));
+        EXPECT_EQ(0, result.survivors.at(2));
+        EXPECT_GT(result.firstKillTick, 101);
+        EXPECT_LT(result.firstKillTick, result.ticksRun);
+        EXPECT_EQ(1, result.commandsUnresolved);
+        EXPECT_EQ(1, result.commandsRejected);
+
+        // a decided match runs no further
+        EXPECT_EQ(result.ticksRun, match.Run(2000).ticksRun);
+    }
+
+    TEST(TestHeadlessMatch, TestFirstKillLostToEventOverflow)
+    {
+        // the same duel twice, the second time with the kill drowned out by fighters leaving the arena in the same tick
+        std::vector<uint64_t> firstKillTicks;
+        for(const bool overflow : {false, true})
+        {
+            vector::game::HeadlessMatch match(std::make_unique<vector::sim::GameEngine>());
+            ASSERT_TRUE(match.SetUnitData(1, MakeUnits({"brot"})));
+            ASSERT_TRUE(match.SetUnitData(2, MakeUnits({"marm"})));
+            match.AddScriptedCommand(MakeScriptedCommand(100, 1, vector::util::COMMAND_TYPE::AQUIRE, "brot", "marm"));
+            match.AddScriptedCommand(MakeScriptedCommand(101, 1, vector::util::COMMAND_TYPE::LAUNCH, "brot", "marm"));
+
+            if(overflow)
+            {
+                ASSERT_FALSE(firstKillTicks.empty());
+                ASSERT_EQ(UINT64_MAX, match.Run(firstKillTicks.front()).firstKillTick);
+
+                // missile hits are published before fighters are found out of bounds, so the ring only keeps the latter
+                vector::sim::GameEngine& gameEngine = match.GetGameEngine();
+                vector::sim::MoverParams fighterParams;
+                fighterParams.maxSpeed = vector::sim::FIGHTER_SPEED_MAX;
+                fighterParams.turnRate = vector::sim::FIGHTER_TURN_RATE;
+                const size_t numPerEdge = vector::sim::ENGINE_EVENT_CAPACITY / 2 + 100;
+                for(size_t i = 0; i < 2 * numPerEdge; ++i)
+                {
+                    const vector::sim::MoverHandle handle = gameEngine.AddFighter("gnar" + std::to_string(i), 3, fighterParams);
+                    ASSERT_TRUE(handle.IsValid());
+
+                    vector::sim::InertialData inertialData;
+                    inertialData.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+                    inertialData.curHeading = i < numPerEdge ? 90 : 270;
+                    inertialData.xCoord = i < numPerEdge ? vector::sim::X_COORD_MAX : vector::sim::X_COORD_MIN;
+                    inertialData.yCoord = 1000.0 + static_cast<double>(i % numPerEdge) * 80.0;
+                    gameEngine.GetMover(handle)->SetInitialInertialData(inertialData);
+                }
+            }
+
+            const vector::game::MatchResult result = match.Run(1000);
+            EXPECT_TRUE(result.decided);
+            EXPECT_EQ(1, result.winningTeamID);
+            EXPECT_NE(UINT64_MAX, result.firstKillTick);
+            firstKillTicks.push_back(result.firstKillTick);
+        }
+
+        EXPECT_EQ(firstKillTicks.front(), firstKillTicks.back());
+    }
+} // namespace
@@ -2,6 +2,8 @@
 
 #include "util/InputParser.h"
 
+#include <variant>
+
 TEST(TestInputParser, TestParseCommand)
 {
     std::string vectorString = "vector brot 123";
@@ -14,22 +16,26 @@ TEST(TestInputParser, TestParseCommand)
     result = vector::util::InputParser::Parse(vectorString);
     EXPECT_EQ(vector::util::COMMAND_TYPE::VECTOR, result.command);
     EXPECT_EQ("brot", result.subject);
-    EXPECT_EQ("123", result.object);
+    ASSERT_TRUE(std::holds_alternative<vector::util::HeadingPayload>(result.payload));
+    EXPECT_EQ(123, std::get<vector::util::HeadingPayload>(result.payload).heading);
 
     result = vector::util::InputParser::Parse(identifyString);
     EXPECT_EQ(vector::util::COMMAND_TYPE::IDENTIFY, result.command);
     EXPECT_EQ("brot", result.subject);
-    EXPECT_EQ("marm", result.object);
+    ASSERT_TRUE(std::holds_alternative<vector::util::TargetPayload>(result.payload));
+    EXPECT_EQ("marm", std::get<vector::util::TargetPayload>(result.payload).callsign);
 
     result = vector::util::InputParser::Parse(aquireString);
     EXPECT_EQ(vector::util::COMMAND_TYPE::AQUIRE, result.command);
     EXPECT_EQ("brot", result.subject);
-    EXPECT_EQ("marm", result.object);
+    ASSERT_TRUE(std::holds_alternative<vector::util::TargetPayload>(result.payload));
+    EXPECT_EQ("marm", std::get<vector::util::TargetPayload>(result.payload).callsign);
 
     result = vector::util::InputParser::Parse(launchString);
     EXPECT_EQ(vector::util::COMMAND_TYPE::LAUNCH, result.command);
     EXPECT_EQ("brot", result.subject);
-    EXPECT_EQ("marm", result.object);
+    ASSERT_TRUE(std::holds_alternative<vector::util::TargetPayload>(result.payload));
+    EXPECT_EQ("marm", std::get<vector::util::TargetPayload>(result.payload).callsign);
 }
 
 TEST(TestInputParser, TestTrim)
@@ -66,4 +72,92 @@ TEST(TestInputParser, TestParseInvalids)
 
     result = vector::util::InputParser::Parse(capsString);
     EXPECT_EQ(vector::util::COMMAND_TYPE::UNK, result.command);
-}
\ No newline at end of file
+}
+
+TEST(TestInputParser, TestParsePayloadValidation)
+{
+    vector::util::Command result;
+
+    // an object that does not suit the command type leaves the payload empty
+    result = vector::util::InputParser::Parse("vector brot marm");
+    EXPECT_EQ(vector::util::COMMAND_TYPE::VECTOR, result.command);
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(result.payload));
+
+    result = vector::util::InputParser::Parse("vector brot 70000");
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(result.payload));
+
+    // headings outside 0 to 359 are not headings
+    result = vector::util::InputParser::Parse("vector brot 359");
+    ASSERT_TRUE(std::holds_alternative<vector::util::HeadingPayload>(result.payload));
+    EXPECT_EQ(359, std::get<vector::util::HeadingPayload>(result.payload).heading);
+
+    result = vector::util::InputParser::Parse("vector brot 360");
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(result.payload));
+
+    result = vector::util::InputParser::Parse("vector brot 400");
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(result.payload));
+
+    result = vector::util::InputParser::Parse("vector brot");
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(result.payload));
+
+    result = vector::util::InputParser::Parse("identify brot");
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(result.payload));
+
+    result = vector::util::InputParser::Parse("garbage brot marm");
+    EXPECT_EQ(vector::util::COMMAND_TYPE::UNK, result.command);
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(result.payload));
+}
+
+TEST(TestInputParser, TestParseView)
+{
+    vector::util::ParsedCommand result;
+
+    // repeated spaces between tokens are skipped
+    std::string paddedString = "  vector   brot   123  ";
+    result = vector::util::InputParser::ParseView(paddedString);
+    EXPECT_EQ(vector::util::COMMAND_TYPE::VECTOR, result.command);
+    EXPECT_EQ("brot", result.subject);
+    EXPECT_EQ("123", result.object);
+    EXPECT_TRUE(result.hasNumber);
+    EXPECT_EQ(123, result.number);
+
+    // the tokens view the input rather than copy it
+    EXPECT_GE(result.subject.data(), paddedString.data());
+    EXPECT_LT(result.subject.data(), paddedString.data() + paddedString.size());
+
+    result = vector::util::InputParser::ParseView("identify brot marm");
+    EXPECT_EQ(vector::util::COMMAND_TYPE::IDENTIFY, result.command);
+    EXPECT_EQ("marm", result.object);
+    EXPECT_FALSE(result.hasNumber);
+
+    // verbs sharing a length are told apart
+    EXPECT_EQ(vector::util::COMMAND_TYPE::AQUIRE, vector::util::InputParser::ParseView("aquire brot marm").command);
+    EXPECT_EQ(vector::util::COMMAND_TYPE::LAUNCH, vector::util::InputParser::ParseView("launch brot marm").command);
+    EXPECT_EQ(vector::util::COMMAND_TYPE::UNK, vector::util::InputParser::ParseView("vectro brot 123").command);
+    EXPECT_EQ(vector::util::COMMAND_TYPE::UNK, vector::util::InputParser::ParseView("unk").command);
+    EXPECT_EQ(vector::util::COMMAND_TYPE::UNK, vector::util::InputParser::ParseView("   ").command);
+}
+
+TEST(TestInputParser, TestParseViewNumbers)
+{
+    vector::util::ParsedCommand result;
+
+    result = vector::util::InputParser::ParseView("vector brot 0");
+    EXPECT_TRUE(result.hasNumber);
+    EXPECT_EQ(0, result.number);
+
+    // only an object that is wholly a number counts
+    result = vector::util::InputParser::ParseView("vector brot 12a");
+    EXPECT_FALSE(result.hasNumber);
+    EXPECT_EQ(0, result.number);
+
+    result = vector::util::InputParser::ParseView("vector brot -90");
+    EXPECT_FALSE(result.hasNumber);
+
+    result = vector::util::InputParser::ParseView("vector brot 99999999999");
+    EXPECT_FALSE(result.hasNumber);
+
+    result = vector::util::InputParser::ParseView("vector brot");
+    EXPECT_FALSE(result.hasNumber);
+    EXPECT_TRUE(result.object.empty());
+}
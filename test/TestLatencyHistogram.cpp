@@ -0,0 +1,81 @@
+#include "gtest/gtest.h"
+
+#include "util/LatencyHistogram.h"
+
+#include <thread>
+#include <vector>
+
+TEST(TestLatencyHistogram, TestBucketBounds)
+{
+    // small values are exact
+    for(uint64_t value = 0; value < 32; ++value)
+    {
+        EXPECT_EQ(value, vector::util::LatencyHistogram::GetBucketUpperBound(vector::util::LatencyHistogram::GetBucketIndex(value)));
+    }
+
+    // larger values land in a bucket whose upper bound is within 1/16 above them
+    for(uint64_t value = 32; value < (uint64_t(1) << 40); value = value * 3 / 2 + 7)
+    {
+        size_t index = vector::util::LatencyHistogram::GetBucketIndex(value);
+        uint64_t upperBound = vector::util::LatencyHistogram::GetBucketUpperBound(index);
+
+        EXPECT_GE(upperBound, value);
+        EXPECT_LE(upperBound - value, value / 16);
+        // the previous bucket ends just below this one
+        EXPECT_LT(vector::util::LatencyHistogram::GetBucketUpperBound(index - 1), value);
+    }
+}
+
+TEST(TestLatencyHistogram, TestPercentiles)
+{
+    vector::util::LatencyHistogram histogram;
+
+    EXPECT_EQ(0, histogram.GetCount());
+    EXPECT_EQ(0, histogram.GetPercentile(50.0));
+
+    for(uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.Record(value * 1000);
+    }
+
+    EXPECT_EQ(1000, histogram.GetCount());
+    EXPECT_EQ(1000, histogram.GetMin());
+    EXPECT_EQ(1000000, histogram.GetMax());
+    EXPECT_DOUBLE_EQ(500500.0, histogram.GetMean());
+
+    // percentiles are accurate to the bucket resolution
+    EXPECT_NEAR(500000, histogram.GetPercentile(50.0), 500000 / 16);
+    EXPECT_NEAR(990000, histogram.GetPercentile(99.0), 990000 / 16);
+    EXPECT_EQ(1000000, histogram.GetPercentile(100.0));
+
+    histogram.Reset();
+    EXPECT_EQ(0, histogram.GetCount());
+    EXPECT_EQ(0, histogram.GetMax());
+}
+
+TEST(TestLatencyHistogram, TestConcurrentRecord)
+{
+    constexpr int NUM_THREADS = 4;
+    constexpr int NUM_RECORDS = 10000;
+    vector::util::LatencyHistogram histogram;
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < NUM_THREADS; ++t)
+    {
+        threads.emplace_back([&histogram, t]()
+        {
+            for(int i = 0; i < NUM_RECORDS; ++i)
+            {
+                histogram.Record(t * NUM_RECORDS + i);
+            }
+        });
+    }
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(NUM_THREADS * NUM_RECORDS, histogram.GetCount());
+    EXPECT_EQ(0, histogram.GetMin());
+    EXPECT_EQ(NUM_THREADS * NUM_RECORDS - 1, histogram.GetMax());
+}
@@ -0,0 +1,140 @@
+#include "gtest/gtest.h"
+
+#include "game/DogfightGameSettings.h"
+#include "game/GameManager.h"
+#include "game/MatchHost.h"
+#include "game/PlayerInterface.h"
+#include "sim/GameEngine.h"
+#include "sim/GameState.h"
+#include "sim/GameStateDelta.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const size_t NUM_THREADS = 2;
+    const size_t NUM_MATCHES = 6;
+
+    /**
+     * @brief Player that counts the updates it receives
+     *
+     */
+    class CountingPlayer : public vector::game::PlayerInterface
+    {
+        public:
+            CountingPlayer(const std::string& playerID, const vector::sim::team_ID teamID, const bool ready = true)
+                : m_PlayerID(playerID)
+                , m_TeamID(teamID)
+                , m_Ready(ready)
+            {
+            }
+
+            std::string GetPlayerID() const override
+            {
+                return m_PlayerID;
+            }
+
+            vector::sim::team_ID GetTeamID() const override
+            {
+                return m_TeamID;
+            }
+
+            bool IsReady() const override
+            {
+                return m_Ready;
+            }
+
+            void UpdateGameState(std::shared_ptr<const vector::sim::GameState>) override
+            {
+                ++m_NumUpdates;
+            }
+
+            void UpdateGameStateDelta(const vector::sim::GameStateDelta&) override
+            {
+                ++m_NumUpdates;
+            }
+
+            void RegisterCommandFunction(std::function<bool (const std::string playerID, const vector::util::Command cmd)>) override
+            {
+            }
+
+            uint64_t GetNumUpdates() const
+            {
+                return m_NumUpdates;
+            }
+
+        private:
+            std::string m_PlayerID;
+            vector::sim::team_ID m_TeamID;
+            bool m_Ready;
+            std::atomic<uint64_t> m_NumUpdates{0};
+    };
+
+    std::unique_ptr<vector::game::GameManager> MakeMatch(const std::shared_ptr<CountingPlayer>& playerOne, const std::shared_ptr<CountingPlayer>& playerTwo)
+    {
+        auto gameManagerPtr = std::make_unique<vector::game::GameManager>(std::make_unique<vector::sim::GameEngine>(),
+                                                                            std::make_unique<vector::game::DogfightGameSettings>());
+        gameManagerPtr->SetGameType(vector::game::GAME_TYPE::DOGFIGHT);
+        gameManagerPtr->SetTickRateHz(100);
+        gameManagerPtr->AddPlayer(playerOne);
+        gameManagerPtr->AddPlayer(playerTwo);
+        return gameManagerPtr;
+    }
+
+    TEST(TestMatchHost, TestRunsMatches)
+    {
+        vector::game::MatchHost matchHost(NUM_THREADS);
+        EXPECT_EQ(NUM_THREADS, matchHost.GetNumThreads());
+
+        std::vector<std::shared_ptr<CountingPlayer>> players;
+        std::vector<vector::game::match_ID> matchIDs;
+        for(size_t i = 0; i < NUM_MATCHES; ++i)
+        {
+            players.push_back(std::make_shared<CountingPlayer>("nick", 1));
+            players.push_back(std::make_shared<CountingPlayer>("mar", 2));
+            const vector::game::match_ID matchID = matchHost.AddMatch(MakeMatch(players.at(2 * i), players.at(2 * i + 1)));
+            ASSERT_NE(0, matchID);
+            EXPECT_NE(nullptr, matchHost.GetMatch(matchID));
+            matchIDs.push_back(matchID);
+        }
+        EXPECT_EQ(NUM_MATCHES, matchHost.GetNumMatches());
+
+        // more matches than threads, and every one of them keeps ticking
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        for(const auto& player : players)
+        {
+            EXPECT_LT(0, player->GetNumUpdates());
+        }
+        EXPECT_NE(std::string::npos, matchHost.GetMetrics().ToText("host.").find("host.matches_added 6\n"));
+
+        // a removed match is stopped, and gets no more updates
+        ASSERT_TRUE(matchHost.RemoveMatch(matchIDs.front()));
+        EXPECT_FALSE(matchHost.RemoveMatch(matchIDs.front()));
+        EXPECT_EQ(nullptr, matchHost.GetMatch(matchIDs.front()));
+        EXPECT_EQ(NUM_MATCHES - 1, matchHost.GetNumMatches());
+
+        const uint64_t numUpdates = players.front()->GetNumUpdates();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_EQ(numUpdates, players.front()->GetNumUpdates());
+        EXPECT_LT(0, players.back()->GetNumUpdates());
+    }
+
+    TEST(TestMatchHost, TestRejectsMatchesThatCannotStart)
+    {
+        vector::game::MatchHost matchHost(0);
+        EXPECT_EQ(1, matchHost.GetNumThreads());
+
+        EXPECT_EQ(0, matchHost.AddMatch(nullptr));
+
+        auto playerOne = std::make_shared<CountingPlayer>("nick", 1);
+        auto playerTwo = std::make_shared<CountingPlayer>("mar", 2, false);
+        EXPECT_EQ(0, matchHost.AddMatch(MakeMatch(playerOne, playerTwo)));
+        EXPECT_EQ(0, matchHost.GetNumMatches());
+        EXPECT_FALSE(matchHost.RemoveMatch(1));
+    }
+} // namespace
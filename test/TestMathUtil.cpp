@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+
+#include "sim/SimConstants.h"
+#include "util/MathUtil.h"
+
+#include <math.h>
+
+namespace
+{
+    constexpr double PI = 3.14159265358979323846;
+    constexpr double TRIG_TOLERANCE = 1e-15;
+
+    TEST(TestMathUtil, TestTrigTableMatchesLibm)
+    {
+        // every whole-degree heading must agree with libm to within a couple of ulps
+        for(vector::sim::angle heading = vector::sim::HEADING_MIN; heading <= vector::sim::HEADING_MAX; ++heading)
+        {
+            double radians = heading / (vector::sim::HEADING_HALF_CIRCLE / PI);
+
+            EXPECT_NEAR(sin(radians), vector::util::MathUtil::GetHeadingSine(heading), TRIG_TOLERANCE) << "heading " << heading;
+            EXPECT_NEAR(cos(radians), vector::util::MathUtil::GetHeadingCosine(heading), TRIG_TOLERANCE) << "heading " << heading;
+        }
+    }
+
+    TEST(TestMathUtil, TestTrigTableCardinalHeadings)
+    {
+        // headings on the axes are exact
+        EXPECT_EQ(0.0, vector::util::MathUtil::GetHeadingSine(0));
+        EXPECT_EQ(1.0, vector::util::MathUtil::GetHeadingCosine(0));
+        EXPECT_EQ(1.0, vector::util::MathUtil::GetHeadingSine(90));
+        EXPECT_EQ(-1.0, vector::util::MathUtil::GetHeadingCosine(180));
+        EXPECT_EQ(-1.0, vector::util::MathUtil::GetHeadingSine(270));
+    }
+
+    TEST(TestMathUtil, TestVelocityComponents)
+    {
+        vector::sim::speed speedIn = vector::sim::SPEED_MAX;
+
+        for(vector::sim::angle heading = vector::sim::HEADING_MIN; heading <= vector::sim::HEADING_MAX; ++heading)
+        {
+            vector::util::VelocityComponents components = vector::util::MathUtil::GetVelocityComponents(speedIn, heading);
+            double radians = heading / (vector::sim::HEADING_HALF_CIRCLE / PI);
+
+            // the combined lookup matches the individual component functions exactly
+            EXPECT_EQ(vector::util::MathUtil::GetXComponentOfSpeed(speedIn, heading), components.xComponent);
+            EXPECT_EQ(vector::util::MathUtil::GetYComponentOfSpeed(speedIn, heading), components.yComponent);
+
+            // and libm within the table tolerance scaled by speed
+            EXPECT_NEAR(speedIn * sin(radians), components.xComponent, speedIn * TRIG_TOLERANCE);
+            EXPECT_NEAR(speedIn * cos(radians), components.yComponent, speedIn * TRIG_TOLERANCE);
+        }
+    }
+
+    TEST(TestMathUtil, TestBearing)
+    {
+        EXPECT_EQ(0, vector::util::MathUtil::GetBearing(0.0, 100.0));
+        EXPECT_EQ(90, vector::util::MathUtil::GetBearing(100.0, 0.0));
+        EXPECT_EQ(180, vector::util::MathUtil::GetBearing(0.0, -100.0));
+        EXPECT_EQ(270, vector::util::MathUtil::GetBearing(-100.0, 0.0));
+        EXPECT_EQ(315, vector::util::MathUtil::GetBearing(-100.0, 100.0));
+        EXPECT_EQ(0, vector::util::MathUtil::GetBearing(0.0, 0.0));
+
+        // just west of north rounds up to a full circle, which wraps to 0
+        EXPECT_EQ(0, vector::util::MathUtil::GetBearing(-0.1, 100.0));
+
+        // the bearing of each heading's unit vector is the heading
+        for(vector::sim::angle heading = vector::sim::HEADING_MIN; heading <= vector::sim::HEADING_MAX; ++heading)
+        {
+            vector::util::VelocityComponents components = vector::util::MathUtil::GetVelocityComponents(1000.0, heading);
+            EXPECT_EQ(heading, vector::util::MathUtil::GetBearing(components.xComponent, components.yComponent));
+        }
+    }
+
+    TEST(TestMathUtil, TestClosestApproach)
+    {
+        // passing straight through the origin between the ends of the line
+        EXPECT_EQ(0.0, vector::util::MathUtil::GetClosestApproachSquared(-1000.0, 0.0, 1000.0, 0.0));
+
+        // passing to one side
+        EXPECT_DOUBLE_EQ(300.0 * 300.0, vector::util::MathUtil::GetClosestApproachSquared(-1000.0, 300.0, 1000.0, 300.0));
+
+        // closest at an end when the line stops short or moves away
+        EXPECT_DOUBLE_EQ(500.0 * 500.0, vector::util::MathUtil::GetClosestApproachSquared(-2000.0, 0.0, -500.0, 0.0));
+        EXPECT_DOUBLE_EQ(500.0 * 500.0, vector::util::MathUtil::GetClosestApproachSquared(0.0, 500.0, 0.0, 2000.0));
+
+        // no motion
+        EXPECT_DOUBLE_EQ(2.0 * 400.0 * 400.0, vector::util::MathUtil::GetClosestApproachSquared(400.0, 400.0, 400.0, 400.0));
+    }
+} // namespace
@@ -0,0 +1,32 @@
+#include "gtest/gtest.h"
+
+#include "util/Metrics.h"
+
+#include <string>
+
+TEST(TestMetrics, TestDump)
+{
+    vector::util::Metrics metrics;
+
+    std::atomic<uint64_t>& ticks = metrics.AddCounter("ticks");
+    vector::util::LatencyHistogram& tick = metrics.AddHistogram("tick");
+
+    ticks += 3;
+    tick.Record(100);
+    tick.Record(200);
+
+    std::string text = metrics.ToText("engine.");
+    EXPECT_NE(std::string::npos, text.find("engine.ticks 3\n"));
+    EXPECT_NE(std::string::npos, text.find("engine.tick count=2 min=100 mean=150"));
+
+    EXPECT_EQ("{\"ticks\":3,\"tick\":{\"count\":2,\"min_ns\":100,\"mean_ns\":150,\"p50_ns\":103,\"p90_ns\":200,"
+        "\"p99_ns\":200,\"p999_ns\":200,\"max_ns\":200}}", metrics.ToJson());
+}
+
+TEST(TestMetrics, TestEmpty)
+{
+    vector::util::Metrics metrics;
+
+    EXPECT_EQ("", metrics.ToText("engine."));
+    EXPECT_EQ("{}", metrics.ToJson());
+}
@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+#include "sim/InertialData.h"
+#include "sim/MissileMover.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+
+#include <algorithm>
+
+namespace
+{
+    vector::sim::InertialData CentreLaunch()
+    {
+        vector::sim::InertialData launchData;
+        launchData.curHeading = 0;
+        launchData.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+        launchData.xCoord = vector::sim::X_COORD_MAX / 2;
+        launchData.yCoord = vector::sim::Y_COORD_MAX / 2;
+        return launchData;
+    }
+
+    TEST(TestMissileMover, TestDefaultVals)
+    {
+        vector::sim::MoverHandle targetHandle{7, 3};
+        vector::sim::MissileMover missile("brot-M1", 1, CentreLaunch(), targetHandle);
+
+        // the missile starts where its launcher was, and carries no radar or missiles
+        EXPECT_EQ("brot-M1", missile.GetID());
+        EXPECT_EQ("brot-M1", missile.GetIDView());
+        EXPECT_EQ(1, missile.GetTeam());
+        EXPECT_TRUE(missile.GetStatus());
+        EXPECT_EQ(targetHandle, missile.GetTarget());
+        EXPECT_EQ(vector::sim::MISSILE_FUEL_TICKS, missile.GetFuelTicks());
+        EXPECT_EQ(CentreLaunch().xCoord, missile.GetInertialData().xCoord);
+        EXPECT_EQ(CentreLaunch().curSpeed, missile.GetInertialData().curSpeed);
+        EXPECT_EQ(0.0, missile.GetPerformanceValues().radarRange);
+        EXPECT_EQ(0, missile.GetPerformanceValues().numMissiles);
+    }
+
+    TEST(TestMissileMover, TestAccelerates)
+    {
+        vector::sim::MissileMover missile("brot-M1", 1, CentreLaunch(), vector::sim::MoverHandle());
+
+        vector::sim::speed lastSpeed = missile.GetInertialData().curSpeed;
+        for(int tick = 0; tick < 20; ++tick)
+        {
+            const vector::sim::coord lastY = missile.GetInertialData().yCoord;
+            missile.Move();
+
+            // straight ahead, up to top speed
+            EXPECT_EQ(std::min(vector::sim::MISSILE_SPEED_MAX, lastSpeed + vector::sim::MISSILE_ACCL), missile.GetInertialData().curSpeed);
+            EXPECT_DOUBLE_EQ(lastY + missile.GetInertialData().curSpeed, missile.GetInertialData().yCoord);
+            lastSpeed = missile.GetInertialData().curSpeed;
+        }
+        EXPECT_EQ(vector::sim::MISSILE_SPEED_MAX, lastSpeed);
+    }
+
+    TEST(TestMissileMover, TestGuideTurnsShortestWay)
+    {
+        vector::sim::MissileMover missile("brot-M1", 1, CentreLaunch(), vector::sim::MoverHandle());
+        const vector::sim::InertialData launchData = CentreLaunch();
+
+        // a point due west is a left turn from north, at no more than the turn rate per tick
+        missile.Guide(launchData.xCoord - 50000.0, launchData.yCoord);
+        missile.Move();
+        EXPECT_EQ(vector::sim::HEADING_FULL_CIRCLE - vector::sim::MISSILE_TURN_RATE, missile.GetInertialData().curHeading);
+
+        // settles on the bearing rather than overshooting it
+        for(int tick = 0; tick < 10; ++tick)
+        {
+            missile.Guide(missile.GetInertialData().xCoord - 50000.0, missile.GetInertialData().yCoord);
+            missile.Move();
+        }
+        EXPECT_EQ(270, missile.GetInertialData().curHeading);
+    }
+
+    TEST(TestMissileMover, TestFuelRunsOut)
+    {
+        vector::sim::InertialData launchData = CentreLaunch();
+        launchData.curHeading = 90;
+        launchData.xCoord = vector::sim::X_COORD_MIN;
+        vector::sim::MissileMover missile("brot-M1", 1, launchData, vector::sim::MoverHandle());
+
+        for(uint32_t tick = 1; tick < vector::sim::MISSILE_FUEL_TICKS; ++tick)
+        {
+            missile.Move();
+            ASSERT_TRUE(missile.GetStatus()) << "tick " << tick;
+        }
+
+        missile.Move();
+        EXPECT_EQ(0, missile.GetFuelTicks());
+        EXPECT_FALSE(missile.GetStatus());
+
+        // a destroyed missile stays where it is
+        const vector::sim::coord xCoord = missile.GetInertialData().xCoord;
+        missile.Move();
+        EXPECT_EQ(xCoord, missile.GetInertialData().xCoord);
+    }
+
+    TEST(TestMissileMover, TestLeavesArena)
+    {
+        vector::sim::InertialData launchData = CentreLaunch();
+        launchData.yCoord = vector::sim::Y_COORD_MAX - 1000.0;
+        vector::sim::MissileMover missile("brot-M1", 1, launchData, vector::sim::MoverHandle());
+
+        missile.Move();
+        EXPECT_FALSE(missile.GetStatus());
+    }
+} // namespace
@@ -0,0 +1,183 @@
+#include "gtest/gtest.h"
+#include "sim/FighterMover.h"
+#include "sim/InertialData.h"
+#include "sim/MoverStore.h"
+#include "sim/MoverStoreView.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+
+namespace
+{
+    class TestMoverStore : public testing::Test
+    {
+        protected:
+            void SetUp() override
+            {
+                perfValues.maxSpeed = vector::sim::FIGHTER_SPEED_MAX;
+                perfValues.turnRate = vector::sim::FIGHTER_TURN_RATE;
+            }
+
+            vector::sim::MoverParams perfValues;
+    };
+
+    TEST_F(TestMoverStore, TestAddAndDefaults)
+    {
+        vector::sim::MoverStore store;
+
+        vector::sim::store_slot slot = store.Add("brot", 1, perfValues);
+
+        // a newly added fighter has the same defaults as a FighterMover
+        EXPECT_TRUE(store.IsValid(slot));
+        EXPECT_EQ(1, store.GetSize());
+        EXPECT_EQ("brot", store.GetID(slot));
+        EXPECT_EQ(1, store.GetTeam(slot));
+        EXPECT_TRUE(store.GetStatus(slot));
+        EXPECT_EQ(0, store.GetInertialData(slot).curHeading);
+        EXPECT_EQ(0.0, store.GetInertialData(slot).curSpeed);
+        EXPECT_EQ(0.0, store.GetInertialData(slot).xCoord);
+        EXPECT_EQ(0.0, store.GetInertialData(slot).yCoord);
+    }
+
+    TEST_F(TestMoverStore, TestRemoveKeepsSlotsStable)
+    {
+        vector::sim::MoverStore store;
+
+        vector::sim::store_slot slotOne = store.Add("brot", 1, perfValues);
+        vector::sim::store_slot slotTwo = store.Add("marm", 2, perfValues);
+        vector::sim::store_slot slotThree = store.Add("gnar", 1, perfValues);
+
+        // removing from the front swaps the last fighter into its place
+        EXPECT_TRUE(store.Remove(slotOne));
+        EXPECT_FALSE(store.Remove(slotOne));
+        EXPECT_EQ(2, store.GetSize());
+
+        // remaining slots still address the same fighters
+        EXPECT_FALSE(store.IsValid(slotOne));
+        EXPECT_EQ("marm", store.GetID(slotTwo));
+        EXPECT_EQ(2, store.GetTeam(slotTwo));
+        EXPECT_EQ("gnar", store.GetID(slotThree));
+        EXPECT_EQ(1, store.GetTeam(slotThree));
+
+        // a removed fighter's slot is reused rather than the slots growing
+        const uint32_t generation = store.GetGeneration(slotOne);
+        EXPECT_EQ(slotOne, store.Add("fox", 3, perfValues));
+        EXPECT_TRUE(store.IsValid(slotOne));
+        EXPECT_EQ("fox", store.GetID(slotOne));
+        EXPECT_EQ(generation, store.GetGeneration(slotOne));
+        EXPECT_TRUE(store.Remove(slotOne));
+        EXPECT_NE(generation, store.GetGeneration(slotOne));
+        EXPECT_EQ("marm", store.GetID(slotTwo));
+    }
+
+    TEST_F(TestMoverStore, TestRemoveDestroyed)
+    {
+        vector::sim::MoverStore store;
+
+        vector::sim::store_slot slotOne = store.Add("brot", 1, perfValues);
+        vector::sim::store_slot slotTwo = store.Add("marm", 2, perfValues);
+
+        store.Destroy(slotOne);
+        EXPECT_FALSE(store.GetStatus(slotOne));
+
+        std::vector<vector::sim::store_slot> removedSlots;
+        store.RemoveDestroyed(removedSlots);
+
+        ASSERT_EQ(1, removedSlots.size());
+        EXPECT_EQ(slotOne, removedSlots.at(0));
+        EXPECT_FALSE(store.IsValid(slotOne));
+        EXPECT_TRUE(store.IsValid(slotTwo));
+    }
+
+    TEST_F(TestMoverStore, TestMoveAllMatchesFighterMover)
+    {
+        vector::sim::MoverStore store;
+        vector::sim::FighterMover straight("brot", 1, perfValues);
+        vector::sim::FighterMover turning("marm", 2, perfValues);
+
+        vector::sim::InertialData initialPos;
+        initialPos.curHeading = 45;
+        initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX / 2;
+        initialPos.xCoord = vector::sim::X_COORD_MAX / 2;
+        initialPos.yCoord = vector::sim::Y_COORD_MAX / 2;
+
+        vector::sim::store_slot straightSlot = store.Add("brot", 1, perfValues);
+        vector::sim::store_slot turningSlot = store.Add("marm", 2, perfValues);
+
+        EXPECT_TRUE(straight.SetInitialInertialData(initialPos));
+        EXPECT_TRUE(turning.SetInitialInertialData(initialPos));
+        EXPECT_TRUE(store.SetInitialInertialData(straightSlot, initialPos));
+        EXPECT_TRUE(store.SetInitialInertialData(turningSlot, initialPos));
+
+        EXPECT_TRUE(turning.SetNewHeading(300));
+        EXPECT_TRUE(store.SetNewHeading(turningSlot, 300));
+        EXPECT_EQ(300, store.GetDesiredHeading(turningSlot));
+        EXPECT_EQ(initialPos.curHeading, store.GetDesiredHeading(straightSlot));
+
+        // the linear pass must advance stored fighters exactly as FighterMover::Move does
+        for(int i = 0; i < 20; ++i)
+        {
+            straight.Move();
+            turning.Move();
+            store.MoveAll();
+
+            EXPECT_EQ(straight.GetInertialData().curHeading, store.GetInertialData(straightSlot).curHeading);
+            EXPECT_EQ(straight.GetInertialData().curSpeed, store.GetInertialData(straightSlot).curSpeed);
+            EXPECT_EQ(straight.GetInertialData().xCoord, store.GetInertialData(straightSlot).xCoord);
+            EXPECT_EQ(straight.GetInertialData().yCoord, store.GetInertialData(straightSlot).yCoord);
+
+            EXPECT_EQ(turning.GetInertialData().curHeading, store.GetInertialData(turningSlot).curHeading);
+            EXPECT_EQ(turning.GetInertialData().curSpeed, store.GetInertialData(turningSlot).curSpeed);
+            EXPECT_EQ(turning.GetInertialData().xCoord, store.GetInertialData(turningSlot).xCoord);
+            EXPECT_EQ(turning.GetInertialData().yCoord, store.GetInertialData(turningSlot).yCoord);
+        }
+    }
+
+    TEST_F(TestMoverStore, TestMoveAllDestroysOutOfBounds)
+    {
+        vector::sim::MoverStore store;
+
+        // start the fighter one Move away from the top boundary heading straight up
+        vector::sim::InertialData initialPos;
+        initialPos.curHeading = 0;
+        initialPos.curSpeed = vector::sim::FIGHTER_SPEED_MAX;
+        initialPos.xCoord = vector::sim::X_COORD_MAX;
+        initialPos.yCoord = vector::sim::Y_COORD_MAX - vector::sim::FIGHTER_SPEED_MAX;
+
+        vector::sim::store_slot slot = store.Add("brot", 1, perfValues);
+        EXPECT_TRUE(store.SetInitialInertialData(slot, initialPos));
+
+        store.MoveAll();
+        EXPECT_TRUE(store.GetStatus(slot));
+
+        store.MoveAll();
+        EXPECT_FALSE(store.GetStatus(slot));
+    }
+
+    TEST_F(TestMoverStore, TestView)
+    {
+        vector::sim::MoverStore store;
+
+        vector::sim::store_slot slot = store.Add("brot", 1, perfValues);
+        vector::sim::MoverStoreView view(store, slot);
+
+        // the view forwards to the stored fighter
+        EXPECT_EQ("brot", view.GetID());
+        EXPECT_EQ(1, view.GetTeam());
+        EXPECT_TRUE(view.SetNewHeading(90));
+        EXPECT_FALSE(view.SetNewHeading(360));
+
+        view.Move();
+        EXPECT_EQ(vector::sim::FIGHTER_TURN_RATE, store.GetInertialData(slot).curHeading);
+
+        // once removed from the store the view reports a destroyed Mover
+        store.Remove(slot);
+        EXPECT_FALSE(view.GetStatus());
+        EXPECT_EQ("", view.GetID());
+
+        // nor does it see the fighter that takes its slot next
+        EXPECT_EQ(slot, store.Add("marm", 2, perfValues));
+        EXPECT_FALSE(view.GetStatus());
+        EXPECT_EQ("", view.GetID());
+        EXPECT_FALSE(view.SetNewHeading(90));
+    }
+} // namespace
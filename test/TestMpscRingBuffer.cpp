@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+
+#include "util/MpscRingBuffer.h"
+
+#include <thread>
+#include <vector>
+
+TEST(TestMpscRingBuffer, TestCapacity)
+{
+    EXPECT_EQ(2, vector::util::MpscRingBuffer<int>(0).GetCapacity());
+    EXPECT_EQ(8, vector::util::MpscRingBuffer<int>(8).GetCapacity());
+    EXPECT_EQ(16, vector::util::MpscRingBuffer<int>(9).GetCapacity());
+}
+
+TEST(TestMpscRingBuffer, TestFifoAndWraparound)
+{
+    vector::util::MpscRingBuffer<int> buffer(4);
+    int item = 0;
+
+    EXPECT_FALSE(buffer.TryPop(item));
+
+    // several laps round the buffer, filling it each time
+    for(int lap = 0; lap < 5; ++lap)
+    {
+        for(int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(buffer.TryPush(lap * 10 + i));
+        }
+        EXPECT_FALSE(buffer.TryPush(99));
+
+        for(int i = 0; i < 4; ++i)
+        {
+            ASSERT_TRUE(buffer.TryPop(item));
+            EXPECT_EQ(lap * 10 + i, item);
+        }
+        EXPECT_FALSE(buffer.TryPop(item));
+    }
+}
+
+TEST(TestMpscRingBuffer, TestItemNotMovedWhenFull)
+{
+    vector::util::MpscRingBuffer<std::vector<int>> buffer(2);
+    EXPECT_TRUE(buffer.TryPush(std::vector<int>{1}));
+    EXPECT_TRUE(buffer.TryPush(std::vector<int>{2}));
+
+    std::vector<int> rejected{3, 4};
+    EXPECT_FALSE(buffer.TryPush(std::move(rejected)));
+    EXPECT_EQ(2, rejected.size());
+}
+
+TEST(TestMpscRingBuffer, TestConcurrentProducers)
+{
+    constexpr int NUM_PRODUCERS = 4;
+    constexpr int ITEMS_PER_PRODUCER = 20000;
+    vector::util::MpscRingBuffer<int> buffer(64);
+
+    std::vector<std::thread> producers;
+    for(int producer = 0; producer < NUM_PRODUCERS; ++producer)
+    {
+        producers.emplace_back([&buffer, producer]()
+        {
+            for(int i = 0; i < ITEMS_PER_PRODUCER; ++i)
+            {
+                int item = producer * ITEMS_PER_PRODUCER + i;
+                while(!buffer.TryPush(std::move(item)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // every item arrives exactly once, and each producer's items arrive in the order pushed
+    std::vector<int> nextExpected(NUM_PRODUCERS, 0);
+    int numPopped = 0;
+    int item = 0;
+    while(numPopped < NUM_PRODUCERS * ITEMS_PER_PRODUCER)
+    {
+        if(buffer.TryPop(item))
+        {
+            const int producer = item / ITEMS_PER_PRODUCER;
+            ASSERT_EQ(nextExpected.at(producer), item % ITEMS_PER_PRODUCER);
+            ++nextExpected.at(producer);
+            ++numPopped;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    for(auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_FALSE(buffer.TryPop(item));
+}
@@ -0,0 +1,128 @@
+#include "gtest/gtest.h"
+
+#include "util/ObjectPool.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // counts live instances, so tests can see objects constructed and destroyed in place
+    struct Counted
+    {
+        Counted(const std::string& nameIn, int& liveCountIn)
+            : name(nameIn)
+            , liveCount(liveCountIn)
+        {
+            ++liveCount;
+        }
+
+        ~Counted()
+        {
+            --liveCount;
+        }
+
+        std::string name;
+        int& liveCount;
+    };
+} // namespace
+
+TEST(TestObjectPool, TestAllocateAndRelease)
+{
+    int liveCount = 0;
+    vector::util::ObjectPool<Counted> pool(3);
+
+    EXPECT_EQ(3, pool.GetCapacity());
+    EXPECT_EQ(0, pool.GetNumAllocated());
+
+    Counted* onePtr = pool.Allocate("one", liveCount);
+    Counted* twoPtr = pool.Allocate("two", liveCount);
+    Counted* threePtr = pool.Allocate("three", liveCount);
+    ASSERT_NE(nullptr, onePtr);
+    ASSERT_NE(nullptr, twoPtr);
+    ASSERT_NE(nullptr, threePtr);
+    EXPECT_EQ("one", onePtr->name);
+    EXPECT_EQ("three", threePtr->name);
+    EXPECT_EQ(3, liveCount);
+    EXPECT_EQ(3, pool.GetNumAllocated());
+
+    // exhausted
+    EXPECT_EQ(nullptr, pool.Allocate("four", liveCount));
+    EXPECT_EQ(3, liveCount);
+
+    EXPECT_TRUE(pool.Release(twoPtr));
+    EXPECT_EQ(2, liveCount);
+    EXPECT_EQ(2, pool.GetNumAllocated());
+
+    // the most recently released slot is reused first
+    Counted* fourPtr = pool.Allocate("four", liveCount);
+    EXPECT_EQ(twoPtr, fourPtr);
+    EXPECT_EQ("four", fourPtr->name);
+    EXPECT_EQ(3, liveCount);
+}
+
+TEST(TestObjectPool, TestReleaseForeignObject)
+{
+    int liveCount = 0;
+    vector::util::ObjectPool<Counted> pool(2);
+    Counted outside("outside", liveCount);
+
+    EXPECT_FALSE(pool.Owns(&outside));
+    EXPECT_FALSE(pool.Release(&outside));
+    EXPECT_FALSE(pool.Release(nullptr));
+    EXPECT_EQ(1, liveCount);
+
+    Counted* insidePtr = pool.Allocate("inside", liveCount);
+    EXPECT_TRUE(pool.Owns(insidePtr));
+}
+
+TEST(TestObjectPool, TestRecycleManyTimes)
+{
+    int liveCount = 0;
+    vector::util::ObjectPool<Counted> pool(16);
+    std::vector<Counted*> allocated;
+
+    // churn through far more objects than the pool holds, never more than its capacity at once
+    for(int round = 0; round < 100; ++round)
+    {
+        while(allocated.size() < pool.GetCapacity())
+        {
+            Counted* objectPtr = pool.Allocate(std::to_string(round), liveCount);
+            ASSERT_NE(nullptr, objectPtr);
+            allocated.push_back(objectPtr);
+        }
+
+        for(size_t i = 0; i < allocated.size(); i += 2)
+        {
+            EXPECT_TRUE(pool.Release(allocated[i]));
+        }
+
+        std::vector<Counted*> kept;
+        for(size_t i = 1; i < allocated.size(); i += 2)
+        {
+            kept.push_back(allocated[i]);
+        }
+        allocated.swap(kept);
+
+        EXPECT_EQ(static_cast<int>(allocated.size()), liveCount);
+        EXPECT_EQ(allocated.size(), pool.GetNumAllocated());
+    }
+}
+
+TEST(TestObjectPool, TestDestructorDestroysAllocated)
+{
+    int liveCount = 0;
+
+    {
+        vector::util::ObjectPool<Counted> pool(4);
+        pool.Allocate("one", liveCount);
+        Counted* twoPtr = pool.Allocate("two", liveCount);
+        pool.Allocate("three", liveCount);
+        pool.Release(twoPtr);
+        EXPECT_EQ(2, liveCount);
+    }
+
+    // only the objects still allocated are destroyed, and each only once
+    EXPECT_EQ(0, liveCount);
+}
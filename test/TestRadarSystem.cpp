@@ -0,0 +1,168 @@
+#include "gtest/gtest.h"
+
+#include "sim/RadarSystem.h"
+#include "sim/SimConstants.h"
+#include "sim/SpatialGrid.h"
+#include "util/MathUtil.h"
+#include "util/ThreadPool.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    vector::sim::InertialData MakeInertialData(const vector::sim::coord xCoord, const vector::sim::coord yCoord, const vector::sim::angle heading)
+    {
+        vector::sim::InertialData inertialData;
+        inertialData.xCoord = xCoord;
+        inertialData.yCoord = yCoord;
+        inertialData.curHeading = heading;
+        return inertialData;
+    }
+
+    TEST(TestRadarSystem, TestIsInCone)
+    {
+        // heading 0 points along +y, with a 60 degree half angle
+        const double sine = vector::util::MathUtil::GetHeadingSine(0);
+        const double cosine = vector::util::MathUtil::GetHeadingCosine(0);
+        const double halfAngleCosine = vector::util::MathUtil::GetHeadingCosine(60);
+
+        EXPECT_TRUE(vector::sim::RadarSystem::IsInCone(sine, cosine, halfAngleCosine, 0.0, 100.0));
+        EXPECT_TRUE(vector::sim::RadarSystem::IsInCone(sine, cosine, halfAngleCosine, 80.0, 100.0));
+        EXPECT_FALSE(vector::sim::RadarSystem::IsInCone(sine, cosine, halfAngleCosine, 100.0, 10.0));
+        EXPECT_FALSE(vector::sim::RadarSystem::IsInCone(sine, cosine, halfAngleCosine, 0.0, -100.0));
+
+        // wider than a half circle, only directly behind is out of view
+        const double wideCosine = vector::util::MathUtil::GetHeadingCosine(150);
+        EXPECT_TRUE(vector::sim::RadarSystem::IsInCone(sine, cosine, wideCosine, 100.0, -10.0));
+        EXPECT_FALSE(vector::sim::RadarSystem::IsInCone(sine, cosine, wideCosine, 10.0, -100.0));
+
+        // all round
+        EXPECT_TRUE(vector::sim::RadarSystem::IsInCone(sine, cosine, -1.0, 0.0, -100.0));
+    }
+
+    TEST(TestRadarSystem, TestSweep)
+    {
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        vector::sim::RadarSystem radar;
+        vector::sim::MoverParams radarParams;
+        radarParams.radarRange = 10000.0;
+        radarParams.radarHalfAngle = 45;
+        vector::sim::MoverParams noRadarParams;
+        noRadarParams.radarRange = 0.0;
+
+        const vector::sim::coord centre = vector::sim::X_COORD_MAX / 2;
+        // 0: team 1 looking north, 1: team 2 ahead in range, 2: team 2 ahead out of range,
+        // 3: team 2 behind looking north, 4: team 1 ahead (friendly), 5: team 2 with no radar, beyond 1
+        std::vector<vector::sim::team_ID> teams = {1, 2, 2, 2, 1, 2};
+        std::vector<vector::sim::InertialData> positions = {
+            MakeInertialData(centre, centre, 0),
+            MakeInertialData(centre, centre + 5000.0, 90),
+            MakeInertialData(centre, centre + 20000.0, 180),
+            MakeInertialData(centre, centre - 5000.0, 0),
+            MakeInertialData(centre + 1000.0, centre + 4000.0, 0),
+            MakeInertialData(centre, centre + 6000.0, 0),
+        };
+
+        for(uint32_t i = 0; i < teams.size(); ++i)
+        {
+            grid.Update(i, positions[i].xCoord, positions[i].yCoord);
+            radar.AddEmitter(i, teams[i], positions[i], (i == 5) ? noRadarParams : radarParams);
+        }
+        radar.Sweep(grid, teams, nullptr);
+
+        // team 1 sees 1 and 5 ahead of 0 but not 3 behind it, team 2's 3 sees 0 and 4 ahead of it
+        const std::vector<vector::sim::RadarSystem::Contact>& teamOneContacts = radar.GetContacts(1);
+        ASSERT_EQ(2, teamOneContacts.size());
+        EXPECT_EQ(1, teamOneContacts.at(0).index);
+        EXPECT_EQ(5, teamOneContacts.at(1).index);
+        EXPECT_TRUE(radar.IsContact(2, 0));
+        EXPECT_TRUE(radar.IsContact(2, 4));
+        EXPECT_FALSE(radar.IsContact(1, 2));
+        EXPECT_FALSE(radar.IsContact(1, 3));
+        EXPECT_TRUE(radar.GetContacts(3).empty());
+
+        // identification sticks while the contact is held and is lost with it
+        EXPECT_FALSE(radar.Identify(1, 3));
+        EXPECT_TRUE(radar.Identify(1, 1));
+        radar.Sweep(grid, teams, nullptr);
+        EXPECT_TRUE(radar.GetContacts(1).at(0).identified);
+        EXPECT_FALSE(radar.GetContacts(1).at(1).identified);
+
+        grid.Remove(1);
+        radar.Sweep(grid, teams, nullptr);
+        grid.Update(1, positions[1].xCoord, positions[1].yCoord);
+        radar.Sweep(grid, teams, nullptr);
+        ASSERT_TRUE(radar.IsContact(1, 1));
+        EXPECT_FALSE(radar.GetContacts(1).at(0).identified);
+    }
+
+    TEST(TestRadarSystem, TestSweepEveryTeam)
+    {
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        vector::sim::RadarSystem radar;
+        vector::sim::MoverParams radarParams;
+        radarParams.radarRange = 1500.0;
+        radarParams.radarHalfAngle = vector::sim::HEADING_HALF_CIRCLE;
+
+        // one fighter on each of the 256 teams, in a line 1000 apart so each sees only its neighbours
+        std::vector<vector::sim::team_ID> teams;
+        for(uint32_t i = 0; i <= UINT8_MAX; ++i)
+        {
+            teams.push_back(static_cast<vector::sim::team_ID>(i));
+            const vector::sim::InertialData position = MakeInertialData(1000.0 + 1000.0 * i, vector::sim::Y_COORD_MAX / 2, 0);
+            grid.Update(i, position.xCoord, position.yCoord);
+            radar.AddEmitter(i, teams.back(), position, radarParams);
+        }
+        radar.Sweep(grid, teams, nullptr);
+
+        // the last team has a row of its own like any other
+        ASSERT_EQ(1, radar.GetContacts(UINT8_MAX).size());
+        EXPECT_EQ(UINT8_MAX - 1, radar.GetContacts(UINT8_MAX).at(0).index);
+        ASSERT_EQ(2, radar.GetContacts(UINT8_MAX - 1).size());
+        ASSERT_EQ(1, radar.GetContacts(0).size());
+        EXPECT_EQ(1, radar.GetContacts(0).at(0).index);
+    }
+
+    TEST(TestRadarSystem, TestParallelSweepMatchesSerial)
+    {
+        constexpr uint32_t NUM_MOVERS = 3000;
+        std::mt19937 generator(99);
+        std::uniform_real_distribution<vector::sim::coord> coordDistribution(vector::sim::X_COORD_MIN, vector::sim::X_COORD_MAX);
+        std::uniform_int_distribution<int> headingDistribution(vector::sim::HEADING_MIN, vector::sim::HEADING_MAX);
+
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        vector::sim::RadarSystem serialRadar;
+        vector::sim::RadarSystem parallelRadar;
+        vector::util::ThreadPool pool(4);
+        vector::sim::MoverParams radarParams;
+        radarParams.radarRange = 30000.0;
+
+        std::vector<vector::sim::team_ID> teams(NUM_MOVERS);
+        for(uint32_t i = 0; i < NUM_MOVERS; ++i)
+        {
+            teams[i] = 1 + i % 3;
+            vector::sim::InertialData inertialData = MakeInertialData(coordDistribution(generator), coordDistribution(generator),
+                                                                        static_cast<vector::sim::angle>(headingDistribution(generator)));
+            grid.Update(i, inertialData.xCoord, inertialData.yCoord);
+            serialRadar.AddEmitter(i, teams[i], inertialData, radarParams);
+            parallelRadar.AddEmitter(i, teams[i], inertialData, radarParams);
+        }
+
+        serialRadar.Sweep(grid, teams, nullptr);
+        parallelRadar.Sweep(grid, teams, &pool);
+
+        for(vector::sim::team_ID teamID = 1; teamID <= 3; ++teamID)
+        {
+            const auto& serialContacts = serialRadar.GetContacts(teamID);
+            const auto& parallelContacts = parallelRadar.GetContacts(teamID);
+            EXPECT_FALSE(serialContacts.empty());
+            ASSERT_EQ(serialContacts.size(), parallelContacts.size());
+            for(size_t i = 0; i < serialContacts.size(); ++i)
+            {
+                EXPECT_EQ(serialContacts[i].index, parallelContacts[i].index);
+                EXPECT_NE(teamID, teams[serialContacts[i].index]);
+            }
+        }
+    }
+} // namespace
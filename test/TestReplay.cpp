@@ -0,0 +1,328 @@
+#include "gtest/gtest.h"
+
+#include "sim/EngineCheckpoint.h"
+#include "sim/GameEngine.h"
+#include "sim/ReplayPlayer.h"
+#include "sim/ReplayRecorder.h"
+#include "sim/SimConstants.h"
+#include "sim/SimParams.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const uint64_t NUM_TICKS = 60;
+    const uint64_t KEYFRAME_INTERVAL = 10;
+
+    void ExpectSameGameState(const vector::sim::GameState& expected, const vector::sim::GameState& actual)
+    {
+        ASSERT_EQ(expected.moverList.size(), actual.moverList.size());
+
+        for(size_t i = 0; i < expected.moverList.size(); ++i)
+        {
+            EXPECT_EQ(expected.moverList.at(i).handle, actual.moverList.at(i).handle);
+            EXPECT_EQ(expected.moverList.at(i).ID, actual.moverList.at(i).ID);
+            EXPECT_EQ(expected.moverList.at(i).teamID, actual.moverList.at(i).teamID);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.curHeading, actual.moverList.at(i).inertialData.curHeading);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.curSpeed, actual.moverList.at(i).inertialData.curSpeed);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.xCoord, actual.moverList.at(i).inertialData.xCoord);
+            EXPECT_EQ(expected.moverList.at(i).inertialData.yCoord, actual.moverList.at(i).inertialData.yCoord);
+        }
+    }
+
+    void ExpectSameEngine(vector::sim::GameEngine& expected, vector::sim::GameEngine& actual)
+    {
+        ExpectSameGameState(*expected.GetGameStateSnapshot(), *actual.GetGameStateSnapshot());
+
+        vector::sim::EngineCheckpoint expectedCheckpoint;
+        vector::sim::EngineCheckpoint actualCheckpoint;
+        ASSERT_TRUE(expected.GetCheckpoint(expectedCheckpoint));
+        ASSERT_TRUE(actual.GetCheckpoint(actualCheckpoint));
+        EXPECT_EQ(expectedCheckpoint.ticks, actualCheckpoint.ticks);
+        EXPECT_EQ(expectedCheckpoint.numMissilesLaunched, actualCheckpoint.numMissilesLaunched);
+        EXPECT_EQ(expectedCheckpoint.freeEntries, actualCheckpoint.freeEntries);
+        EXPECT_EQ(expectedCheckpoint.storeOrder, actualCheckpoint.storeOrder);
+        EXPECT_EQ(expectedCheckpoint.missileEntries, actualCheckpoint.missileEntries);
+
+        ASSERT_EQ(expectedCheckpoint.entries.size(), actualCheckpoint.entries.size());
+        for(size_t i = 0; i < expectedCheckpoint.entries.size(); ++i)
+        {
+            const vector::sim::EntryCheckpoint& expectedEntry = expectedCheckpoint.entries.at(i);
+            const vector::sim::EntryCheckpoint& actualEntry = actualCheckpoint.entries.at(i);
+            EXPECT_EQ(expectedEntry.type, actualEntry.type);
+            EXPECT_EQ(expectedEntry.generation, actualEntry.generation);
+            if(expectedEntry.type == vector::sim::CHECKPOINT_ENTRY_TYPE::FREE)
+            {
+                continue;
+            }
+
+            EXPECT_EQ(expectedEntry.desiredHeading, actualEntry.desiredHeading);
+            EXPECT_EQ(expectedEntry.status, actualEntry.status);
+            EXPECT_EQ(expectedEntry.lockedTarget, actualEntry.lockedTarget);
+            EXPECT_EQ(expectedEntry.missilesRemaining, actualEntry.missilesRemaining);
+            EXPECT_EQ(expectedEntry.target, actualEntry.target);
+            EXPECT_EQ(expectedEntry.fuelTicks, actualEntry.fuelTicks);
+        }
+
+        for(vector::sim::team_ID teamID = 1; teamID <= 2; ++teamID)
+        {
+            std::vector<vector::sim::RadarContact> expectedContacts;
+            std::vector<vector::sim::RadarContact> actualContacts;
+            expected.GetTeamContacts(teamID, expectedContacts);
+            actual.GetTeamContacts(teamID, actualContacts);
+            ASSERT_EQ(expectedContacts.size(), actualContacts.size());
+            for(size_t i = 0; i < expectedContacts.size(); ++i)
+            {
+                EXPECT_EQ(expectedContacts.at(i).handle, actualContacts.at(i).handle);
+                EXPECT_EQ(expectedContacts.at(i).identified, actualContacts.at(i).identified);
+            }
+        }
+    }
+
+    /**
+     * @brief Record a match in which fighters turn, identify, lock, and launch a missile that destroys its target,
+     * keeping the GameState after every tick
+     *
+     */
+    std::vector<vector::sim::GameState> RecordMatch(const std::string& path)
+    {
+        vector::sim::GameEngine engine;
+        vector::sim::MoverParams perfValues;
+        vector::sim::ReplayRecorder recorder(KEYFRAME_INTERVAL);
+        EXPECT_TRUE(recorder.Open(path));
+
+        vector::sim::InertialData initialPos;
+        initialPos.curSpeed = vector::sim::SPEED_MAX;
+        initialPos.xCoord = 50000.0;
+        initialPos.yCoord = 50000.0;
+        const vector::sim::MoverHandle brotHandle = engine.AddFighter("brot", 1, perfValues);
+        engine.GetMover(brotHandle)->SetInitialInertialData(initialPos);
+
+        initialPos.xCoord += 2000.0;
+        const vector::sim::MoverHandle gnarHandle = engine.AddFighter("gnar", 1, perfValues);
+        engine.GetMover(gnarHandle)->SetInitialInertialData(initialPos);
+
+        initialPos.yCoord += 30000.0;
+        initialPos.curHeading = vector::sim::HEADING_HALF_CIRCLE;
+        const vector::sim::MoverHandle marmHandle = engine.AddFighter("marm", 2, perfValues);
+        engine.GetMover(marmHandle)->SetInitialInertialData(initialPos);
+
+        const std::shared_ptr<const vector::sim::GameState> initialStatePtr = engine.GetGameStateSnapshot();
+        for(const auto& moverState : initialStatePtr->moverList)
+        {
+            std::shared_ptr<vector::sim::MoverInterface> moverPtr = engine.GetMover(moverState.handle);
+            recorder.RecordFighter(moverState.handle, moverState.ID, moverState.teamID,
+                                    moverPtr->GetPerformanceValues(), moverState.inertialData, moverPtr->GetDesiredHeading());
+        }
+        vector::sim::EngineCheckpoint checkpoint;
+        recorder.RecordKeyframe(*initialStatePtr);
+        EXPECT_TRUE(engine.GetCheckpoint(checkpoint));
+        recorder.RecordCheckpoint(checkpoint);
+
+        vector::util::Command vectorCmd;
+        vectorCmd.command = vector::util::COMMAND_TYPE::VECTOR;
+        vectorCmd.subject = "gnar";
+        vectorCmd.payload = vector::util::HeadingPayload{90};
+        vector::util::Command identifyCmd;
+        identifyCmd.command = vector::util::COMMAND_TYPE::IDENTIFY;
+        identifyCmd.subject = "brot";
+        identifyCmd.payload = vector::util::TargetPayload{"marm"};
+        vector::util::Command aquireCmd;
+        aquireCmd.command = vector::util::COMMAND_TYPE::AQUIRE;
+        aquireCmd.subject = "brot";
+        aquireCmd.payload = vector::util::TargetPayload{"marm"};
+        vector::util::Command launchCmd = aquireCmd;
+        launchCmd.command = vector::util::COMMAND_TYPE::LAUNCH;
+
+        std::vector<vector::sim::GameState> gameStates;
+        std::vector<vector::sim::TickCommand> drainedCommands;
+        for(uint64_t tick = 0; tick < NUM_TICKS; ++tick)
+        {
+            if(tick == 2)
+            {
+                engine.QueueCommand(gnarHandle, vectorCmd);
+                engine.QueueCommand(brotHandle, identifyCmd);
+                engine.QueueCommand(brotHandle, aquireCmd);
+            }
+            if(tick == 3)
+            {
+                engine.QueueCommand(brotHandle, launchCmd);
+            }
+
+            engine.Tick(drainedCommands);
+            recorder.RecordTick(drainedCommands);
+            drainedCommands.clear();
+            if(recorder.IsKeyframeDue())
+            {
+                recorder.RecordKeyframe(*engine.GetGameStateSnapshot());
+                EXPECT_TRUE(engine.GetCheckpoint(checkpoint));
+                recorder.RecordCheckpoint(checkpoint);
+            }
+            gameStates.push_back(*engine.GetGameStateSnapshot());
+        }
+
+        EXPECT_EQ(NUM_TICKS, recorder.GetNumTicks());
+        EXPECT_TRUE(recorder.Close());
+
+        return gameStates;
+    }
+
+    TEST(TestReplay, TestReplayReproducesMatch)
+    {
+        const std::string path = testing::TempDir() + "TestReplayReproducesMatch.vrl";
+        const std::vector<vector::sim::GameState> gameStates = RecordMatch(path);
+
+        // the missile hit marm and both were removed along the way
+        ASSERT_EQ(2, gameStates.back().moverList.size());
+
+        vector::sim::ReplayPlayer player;
+        ASSERT_TRUE(player.Open(path));
+        EXPECT_EQ(NUM_TICKS, player.GetNumTicks());
+        EXPECT_EQ(NUM_TICKS / KEYFRAME_INTERVAL + 1, player.GetNumKeyframes());
+        EXPECT_EQ(NUM_TICKS / KEYFRAME_INTERVAL + 1, player.GetNumCheckpoints());
+
+        for(uint64_t tick = 0; tick < NUM_TICKS; ++tick)
+        {
+            ASSERT_TRUE(player.Step());
+            ExpectSameGameState(gameStates.at(tick), *player.GetGameState());
+        }
+        EXPECT_FALSE(player.Step());
+        EXPECT_EQ(NUM_TICKS, player.GetTicksRun());
+        EXPECT_EQ(0, player.GetNumDivergences());
+    }
+
+    TEST(TestReplay, TestRunTo)
+    {
+        const std::string path = testing::TempDir() + "TestReplayRunTo.vrl";
+        const std::vector<vector::sim::GameState> gameStates = RecordMatch(path);
+
+        vector::sim::ReplayPlayer player;
+        ASSERT_TRUE(player.Open(path));
+
+        ASSERT_TRUE(player.RunTo(45));
+        ExpectSameGameState(gameStates.at(44), *player.GetGameState());
+
+        // back, which restores the checkpoint at the start and runs on from there
+        ASSERT_TRUE(player.RunTo(5));
+        EXPECT_EQ(5, player.GetTicksRun());
+        ExpectSameGameState(gameStates.at(4), *player.GetGameState());
+
+        EXPECT_FALSE(player.RunTo(NUM_TICKS + 1));
+        ASSERT_TRUE(player.RunTo(NUM_TICKS));
+        ExpectSameGameState(gameStates.back(), *player.GetGameState());
+        EXPECT_EQ(0, player.GetNumDivergences());
+    }
+
+    TEST(TestReplay, TestRunBackFromCheckpoint)
+    {
+        const std::string path = testing::TempDir() + "TestReplayRunBackFromCheckpoint.vrl";
+        RecordMatch(path);
+
+        vector::sim::ReplayPlayer seeking;
+        ASSERT_TRUE(seeking.Open(path));
+        ASSERT_TRUE(seeking.RunTo(NUM_TICKS));
+
+        // back to the missile in flight, and to after it and its target were removed; each restores the checkpoint
+        // before and runs on from it, to the same engine as running straight there from the start
+        for(const uint64_t ticks : {45, 12})
+        {
+            ASSERT_TRUE(seeking.RunTo(ticks));
+            EXPECT_EQ(ticks, seeking.GetTicksRun());
+            EXPECT_EQ(ticks == 12 ? 4 : 2, seeking.GetGameState()->moverList.size());
+
+            vector::sim::ReplayPlayer straight;
+            ASSERT_TRUE(straight.Open(path));
+            for(uint64_t tick = 0; tick < ticks; ++tick)
+            {
+                ASSERT_TRUE(straight.Step());
+            }
+            ExpectSameEngine(*straight.GetGameEngine(), *seeking.GetGameEngine());
+
+            while(straight.Step())
+            {
+                ASSERT_TRUE(seeking.Step());
+                ExpectSameEngine(*straight.GetGameEngine(), *seeking.GetGameEngine());
+            }
+            EXPECT_EQ(0, straight.GetNumDivergences());
+            EXPECT_EQ(0, seeking.GetNumDivergences());
+        }
+    }
+
+    TEST(TestReplay, TestGetKeyframe)
+    {
+        const std::string path = testing::TempDir() + "TestReplayGetKeyframe.vrl";
+        const std::vector<vector::sim::GameState> gameStates = RecordMatch(path);
+
+        vector::sim::ReplayPlayer player;
+        ASSERT_TRUE(player.Open(path));
+
+        // the nearest keyframe at or before, without running the match
+        vector::sim::GameState keyframe;
+        uint64_t keyframeTicks = 0;
+        ASSERT_TRUE(player.GetKeyframe(37, keyframe, keyframeTicks));
+        EXPECT_EQ(30, keyframeTicks);
+        ExpectSameGameState(gameStates.at(29), keyframe);
+        EXPECT_EQ(0, player.GetTicksRun());
+
+        ASSERT_TRUE(player.GetKeyframe(0, keyframe, keyframeTicks));
+        EXPECT_EQ(0, keyframeTicks);
+        EXPECT_EQ(3, keyframe.moverList.size());
+
+        ASSERT_TRUE(player.GetKeyframe(UINT64_MAX, keyframe, keyframeTicks));
+        EXPECT_EQ(NUM_TICKS, keyframeTicks);
+    }
+
+    TEST(TestReplay, TestTruncatedLog)
+    {
+        const std::string path = testing::TempDir() + "TestReplayTruncatedLog.vrl";
+        const std::vector<vector::sim::GameState> gameStates = RecordMatch(path);
+
+        std::ifstream input(path, std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        input.close();
+
+        // cut part way through the last record, as a crash mid-write would
+        const std::string truncatedPath = testing::TempDir() + "TestReplayTruncatedLog.cut.vrl";
+        std::ofstream output(truncatedPath, std::ios::binary | std::ios::trunc);
+        output.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 3));
+        output.close();
+
+        vector::sim::ReplayPlayer player;
+        ASSERT_TRUE(player.Open(truncatedPath));
+        EXPECT_EQ(NUM_TICKS, player.GetNumTicks());
+        EXPECT_EQ(NUM_TICKS / KEYFRAME_INTERVAL + 1, player.GetNumKeyframes());
+        EXPECT_EQ(NUM_TICKS / KEYFRAME_INTERVAL, player.GetNumCheckpoints());
+        ASSERT_TRUE(player.RunTo(NUM_TICKS));
+        ExpectSameGameState(gameStates.back(), *player.GetGameState());
+    }
+
+    TEST(TestReplay, TestRejectsBadLogs)
+    {
+        vector::sim::ReplayPlayer player;
+        EXPECT_FALSE(player.Open(testing::TempDir() + "TestReplayMissing.vrl"));
+        EXPECT_EQ(nullptr, player.GetGameEngine());
+        EXPECT_FALSE(player.Step());
+
+        const std::string path = testing::TempDir() + "TestReplayBadMagic.vrl";
+        RecordMatch(path);
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(0);
+        file.put('x');
+        file.close();
+        EXPECT_FALSE(player.Open(path));
+
+        // a recorder does not open a second log over its first
+        vector::sim::ReplayRecorder recorder(KEYFRAME_INTERVAL);
+        ASSERT_TRUE(recorder.Open(path));
+        EXPECT_FALSE(recorder.Open(path));
+        EXPECT_TRUE(recorder.Close());
+
+        // a log with no fighters and no ticks is an empty match
+        ASSERT_TRUE(player.Open(path));
+        EXPECT_EQ(0, player.GetNumTicks());
+        EXPECT_EQ(0, player.GetGameState()->moverList.size());
+    }
+} // namespace
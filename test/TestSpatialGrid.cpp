@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+
+#include "sim/SimConstants.h"
+#include "sim/SpatialGrid.h"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct Point
+    {
+        vector::sim::coord xCoord;
+        vector::sim::coord yCoord;
+    };
+
+    vector::sim::coord DistanceSquared(const Point& point, const vector::sim::coord xCoord, const vector::sim::coord yCoord)
+    {
+        return (point.xCoord - xCoord) * (point.xCoord - xCoord) + (point.yCoord - yCoord) * (point.yCoord - yCoord);
+    }
+
+    TEST(TestSpatialGrid, TestUpdateAndRemove)
+    {
+        vector::sim::SpatialGrid grid(5000.0);
+        std::vector<uint32_t> results;
+
+        grid.Update(3, 1000.0, 1000.0);
+        grid.Update(7, 1500.0, 1000.0);
+        EXPECT_EQ(2, grid.GetSize());
+        EXPECT_TRUE(grid.Contains(3));
+        EXPECT_FALSE(grid.Contains(4));
+
+        // moving within a cell and across cells
+        grid.Update(3, 1200.0, 1000.0);
+        grid.Update(7, 20000.0, 20000.0);
+        EXPECT_EQ(2, grid.GetSize());
+
+        grid.QueryRadius(1000.0, 1000.0, 500.0, results);
+        ASSERT_EQ(1, results.size());
+        EXPECT_EQ(3, results.at(0));
+
+        EXPECT_TRUE(grid.Remove(3));
+        EXPECT_FALSE(grid.Remove(3));
+        EXPECT_EQ(1, grid.GetSize());
+
+        results.clear();
+        grid.QueryRadius(1000.0, 1000.0, 500.0, results);
+        EXPECT_TRUE(results.empty());
+
+        // positions outside the arena are kept in the border cells
+        grid.Update(9, -100.0, vector::sim::Y_COORD_MAX + 100.0);
+        results.clear();
+        grid.QueryRadius(0.0, vector::sim::Y_COORD_MAX, 200.0, results);
+        ASSERT_EQ(1, results.size());
+        EXPECT_EQ(9, results.at(0));
+
+        grid.Clear();
+        EXPECT_EQ(0, grid.GetSize());
+        EXPECT_FALSE(grid.Contains(7));
+    }
+
+    TEST(TestSpatialGrid, TestQueriesMatchBruteForce)
+    {
+        constexpr uint32_t NUM_ITEMS = 2000;
+        std::mt19937 generator(1234);
+        std::uniform_real_distribution<vector::sim::coord> xDistribution(vector::sim::X_COORD_MIN, vector::sim::X_COORD_MAX);
+        std::uniform_real_distribution<vector::sim::coord> yDistribution(vector::sim::Y_COORD_MIN, vector::sim::Y_COORD_MAX);
+        std::uniform_real_distribution<vector::sim::coord> stepDistribution(-3000.0, 3000.0);
+
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        std::vector<Point> points(NUM_ITEMS);
+        for(uint32_t i = 0; i < NUM_ITEMS; ++i)
+        {
+            points[i] = {xDistribution(generator), yDistribution(generator)};
+            grid.Update(i, points[i].xCoord, points[i].yCoord);
+        }
+
+        // several rounds of movement, so items cross cells and cells are repacked
+        for(int round = 0; round < 5; ++round)
+        {
+            for(uint32_t i = 0; i < NUM_ITEMS; ++i)
+            {
+                points[i].xCoord += stepDistribution(generator);
+                points[i].yCoord += stepDistribution(generator);
+                grid.Update(i, points[i].xCoord, points[i].yCoord);
+            }
+
+            for(int query = 0; query < 20; ++query)
+            {
+                const vector::sim::coord xCoord = xDistribution(generator);
+                const vector::sim::coord yCoord = yDistribution(generator);
+                const vector::sim::coord radius = 2000.0 * (query + 1);
+
+                std::vector<uint32_t> expected;
+                for(uint32_t i = 0; i < NUM_ITEMS; ++i)
+                {
+                    if(DistanceSquared(points[i], xCoord, yCoord) <= radius * radius)
+                    {
+                        expected.push_back(i);
+                    }
+                }
+
+                std::vector<uint32_t> actual;
+                grid.QueryRadius(xCoord, yCoord, radius, actual);
+                std::sort(actual.begin(), actual.end());
+                EXPECT_EQ(expected, actual);
+
+                const size_t count = 1 + query;
+                std::vector<std::pair<vector::sim::coord, uint32_t>> byDistance;
+                for(uint32_t i = 0; i < NUM_ITEMS; ++i)
+                {
+                    byDistance.emplace_back(DistanceSquared(points[i], xCoord, yCoord), i);
+                }
+                std::sort(byDistance.begin(), byDistance.end());
+
+                std::vector<uint32_t> nearest;
+                grid.QueryNearest(xCoord, yCoord, count, nearest);
+                ASSERT_EQ(count, nearest.size());
+                for(size_t i = 0; i < count; ++i)
+                {
+                    EXPECT_EQ(byDistance[i].second, nearest[i]);
+                }
+            }
+        }
+    }
+
+    TEST(TestSpatialGrid, TestNearestWithFewItems)
+    {
+        vector::sim::SpatialGrid grid(vector::sim::SPATIAL_GRID_CELL_SIZE);
+        std::vector<uint32_t> results;
+
+        grid.QueryNearest(0.0, 0.0, 3, results);
+        EXPECT_TRUE(results.empty());
+
+        // far apart items are still found, and no more are returned than exist
+        grid.Update(0, vector::sim::X_COORD_MAX, vector::sim::Y_COORD_MAX);
+        grid.Update(1, vector::sim::X_COORD_MAX / 2, vector::sim::Y_COORD_MAX / 2);
+        grid.QueryNearest(0.0, 0.0, 3, results);
+        ASSERT_EQ(2, results.size());
+        EXPECT_EQ(1, results.at(0));
+        EXPECT_EQ(0, results.at(1));
+    }
+} // namespace
@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+
+#include "util/ThreadPool.h"
+
+#include <atomic>
+#include <vector>
+
+TEST(TestThreadPool, TestNumThreads)
+{
+    // the calling thread counts towards the pool's parallelism
+    vector::util::ThreadPool serialPool(1);
+    EXPECT_EQ(1, serialPool.GetNumThreads());
+
+    vector::util::ThreadPool parallelPool(4);
+    EXPECT_EQ(4, parallelPool.GetNumThreads());
+}
+
+TEST(TestThreadPool, TestParallelForRunsEveryTaskOnce)
+{
+    constexpr size_t NUM_TASKS = 1000;
+    vector::util::ThreadPool pool(4);
+    std::vector<std::atomic<int>> runCounts(NUM_TASKS);
+
+    // run several jobs back to back on the same pool
+    for(int job = 0; job < 10; ++job)
+    {
+        pool.ParallelFor(NUM_TASKS, [&runCounts](const size_t taskIndex)
+        {
+            runCounts[taskIndex]++;
+        });
+    }
+
+    for(size_t i = 0; i < NUM_TASKS; ++i)
+    {
+        EXPECT_EQ(10, runCounts[i].load());
+    }
+}
+
+TEST(TestThreadPool, TestParallelForNoTasks)
+{
+    vector::util::ThreadPool pool(2);
+    bool ran = false;
+
+    pool.ParallelFor(0, [&ran](const size_t)
+    {
+        ran = true;
+    });
+
+    EXPECT_FALSE(ran);
+}
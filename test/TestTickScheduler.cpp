@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+
+#include "util/TickScheduler.h"
+
+#include <chrono>
+#include <thread>
+
+TEST(TestTickScheduler, TestTickRateLimits)
+{
+    vector::util::TickScheduler scheduler(0, 0);
+    EXPECT_EQ(1, scheduler.GetTickRateHz());
+
+    scheduler.SetTickRateHz(60);
+    EXPECT_EQ(60, scheduler.GetTickRateHz());
+}
+
+TEST(TestTickScheduler, TestWorkDoesNotCauseDrift)
+{
+    constexpr int NUM_WAITS = 40;
+    vector::util::TickScheduler scheduler(200, 5);
+
+    auto start = std::chrono::steady_clock::now();
+    scheduler.Start();
+
+    size_t numTicks = 0;
+    for(int i = 0; i < NUM_WAITS; ++i)
+    {
+        numTicks += scheduler.WaitForNextTick();
+        // simulated work takes part of each 5ms period
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // the first tick is immediate, so the last wait returns 39 periods in; sleeping for a fixed time
+    // after the work would have taken at least 39 * 7ms
+    EXPECT_GE(elapsed, std::chrono::milliseconds(195));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(39 * 7));
+    EXPECT_EQ(numTicks, scheduler.GetNumTicks());
+}
+
+TEST(TestTickScheduler, TestCatchUpIsCapped)
+{
+    vector::util::TickScheduler scheduler(100, 2);
+
+    scheduler.Start();
+    EXPECT_EQ(1, scheduler.WaitForNextTick());
+    EXPECT_EQ(0, scheduler.GetNumOverruns());
+
+    // overrun by several 10ms periods: only two ticks are run to catch up and the rest are dropped
+    std::this_thread::sleep_for(std::chrono::milliseconds(55));
+    EXPECT_EQ(2, scheduler.WaitForNextTick());
+    EXPECT_EQ(1, scheduler.GetNumOverruns());
+    EXPECT_GE(scheduler.GetNumSkippedTicks(), 3);
+    EXPECT_EQ(3, scheduler.GetNumTicks());
+}
+
+TEST(TestTickScheduler, TestTakeDueTicksDoesNotSleep)
+{
+    vector::util::TickScheduler scheduler(20, 2);
+
+    scheduler.Start();
+    EXPECT_EQ(1, scheduler.TakeDueTicks());
+
+    // the next deadline is a period away, so nothing is due yet
+    const auto nextDeadline = scheduler.GetNextDeadline();
+    EXPECT_GT(nextDeadline, std::chrono::steady_clock::now());
+    EXPECT_EQ(0, scheduler.TakeDueTicks());
+    EXPECT_EQ(nextDeadline, scheduler.GetNextDeadline());
+
+    std::this_thread::sleep_until(nextDeadline);
+    EXPECT_EQ(1, scheduler.TakeDueTicks());
+    EXPECT_EQ(2, scheduler.GetNumTicks());
+    EXPECT_GT(scheduler.GetNextDeadline(), nextDeadline);
+}